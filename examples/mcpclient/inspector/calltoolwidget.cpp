@@ -150,7 +150,7 @@ CallToolWidget::Private::Private(::CallToolWidget *parent)
                     const auto imageContent = content.imageContent();
                     const auto mimeType = mimeDatabase.mimeTypeForName(imageContent.mimeType());
                     const auto suffix = mimeType.preferredSuffix().toUtf8();
-                    auto data = QByteArray::fromBase64(imageContent.data());
+                    auto data = imageContent.decodedData();
                     QBuffer buffer(&data);
                     buffer.open(QBuffer::ReadOnly);
                     QImage image;
@@ -131,8 +131,7 @@ void ReadResourceWidget::Private::readResource()
                 const auto blobResourceContents = content.blobResourceContents();
                 const auto mimeType = blobResourceContents.mimeType();
                 if (mimeType.startsWith("image/")) {
-                    const auto blob = blobResourceContents.blob();
-                    const auto image = QImage::fromData(QByteArray::fromBase64(blob), mimeType.mid(6).toUtf8().constData());
+                    const auto image = QImage::fromData(blobResourceContents.decodedBlob(), mimeType.mid(6).toUtf8().constData());
                     auto label = new QLabel;
                     label->setPixmap(QPixmap::fromImage(image));
                     contentsLayout->addRow(blobResourceContents.mimeType() + ":", label);
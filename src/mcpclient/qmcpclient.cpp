@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpclient.h"
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
 #include <QtCore/private/qfactoryloader_p.h>
 
@@ -9,6 +11,8 @@
 #include <QtMcpClient/qmcpclientbackendinterface.h>
 #include <QtMcpCommon>
 
+#include <optional>
+
 QT_BEGIN_NAMESPACE
 
 Q_GLOBAL_STATIC_WITH_ARGS(QFactoryLoader, backendLoader,
@@ -19,9 +23,14 @@ class QMcpClient::Private
 public:
     QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest; // Default to latest version
     const QList<QtMcp::ProtocolVersion> supportedVersions = {QtMcp::ProtocolVersion::v2024_11_05, QtMcp::ProtocolVersion::v2025_03_26};
+    bool cborEnabled = false;
+    bool gadgetArenaEnabled = false;
+    QtMcp::Encoding encoding = QtMcp::Encoding::Json;
 
     Private(const QString &type, QMcpClient *parent)
         : q(parent)
+        , requestHandlers(QMcpMethod::KnownCount)
+        , notificationHandlers(QMcpMethod::KnownCount)
     {
         backend = qLoadPlugin<QMcpClientBackendInterface, QMcpClientBackendPlugin>(backendLoader(), type);
         if (!backend) {
@@ -34,84 +43,168 @@ public:
         backend->setParent(q);
         connect(backend, &QMcpClientBackendInterface::started, q, &QMcpClient::started);
         connect(backend, &QMcpClientBackendInterface::errorOccurred, q, &QMcpClient::errorOccurred);
-        connect(backend, &QMcpClientBackendInterface::received, q, [this](const QJsonObject &object) {
-            if (object.contains("id"_L1)) {
-                const auto id = object.value("id"_L1);
-                if (object.contains("result"_L1)) {
-                    if (callbacks.contains(id)) {
-                        const auto result = object.value("result"_L1).toObject();
-                        callbacks.take(id)(result, {});
-                        return;
-                    }
-                } else if (object.contains("error"_L1)) {
-                    if (callbacks.contains(id)) {
-                        const auto error = object.value("error"_L1).toObject();
-                        callbacks.take(id)({}, error);
-                        return;
-                    }
+        if (auto *v2 = qobject_cast<QMcpClientBackendInterfaceV2 *>(backend)) {
+            backendV2 = v2;
+            connect(v2, &QMcpClientBackendInterfaceV2::messageReceived, q, [this](const QByteArray &message) {
+                receive(message);
+            });
+        } else {
+            // backends of the first interface parse the messages themselves
+            connect(backend, &QMcpClientBackendInterface::received, q, [this](const QJsonObject &object) {
+                dispatch(object);
+            });
+        }
+    }
+
+    void receive(const QByteArray &message)
+    {
+        QJsonObject object;
+        if (QMcpCbor::isCbor(message)) {
+            bool ok = false;
+            object = QMcpCbor::toJsonObject(message, &ok);
+            if (!ok)
+                return;
+        } else {
+            QJsonParseError error;
+            const auto document = QJsonDocument::fromJson(message, &error);
+            if (error.error != QJsonParseError::NoError) {
+                qWarning() << "JSON parse error:" << error.errorString();
+                return;
+            }
+            // the responses to a batch
+            if (document.isArray()) {
+                const auto array = document.array();
+                for (const auto &value : array)
+                    dispatch(value.toObject());
+                return;
+            }
+            object = document.object();
+        }
+        dispatch(object);
+    }
+
+    void dispatch(const QJsonObject &object)
+    {
+        // the gadgets of the message and its response share one arena
+        std::optional<QMcpGadgetArena> arena;
+        if (gadgetArenaEnabled)
+            arena.emplace();
+
+        if (object.contains("id"_L1)) {
+            const auto id = object.value("id"_L1);
+            if (object.contains("result"_L1)) {
+                if (callbacks.contains(id)) {
+                    const auto result = object.value("result"_L1).toObject();
+                    if (const auto callback = callbacks.take(id))
+                        callback(result, {});
+                    return;
+                }
+            } else if (object.contains("error"_L1)) {
+                if (callbacks.contains(id)) {
+                    const auto error = object.value("error"_L1).toObject();
+                    if (const auto callback = callbacks.take(id))
+                        callback({}, error);
+                    return;
                 }
             }
-            if (object.contains("method"_L1)) {
-                const auto method = object.value("method"_L1).toString();
-
-                // request
-                if (object.contains("id"_L1)) {
-                    const auto id = object.value("id"_L1);
-                    if (requestHandlers.contains(method)) {
-                        const auto handler = requestHandlers.value(method);
-                        QMcpJSONRPCErrorError error;
-                        const auto result = handler(object, &error);
-                        if (error.code() > 0) {
-                            QMcpJSONRPCError response;
-                            response.setId(id.toVariant());
-                            // Extract protocol version if available in the request
-                            QtMcp::ProtocolVersion reqVersion = protocolVersion;
-                            if (object.contains("params"_L1) && object.value("params"_L1).toObject().contains("protocolVersion"_L1)) {
-                                QString requestedVersionStr = object.value("params"_L1).toObject().value("protocolVersion"_L1).toString();
-                                QtMcp::ProtocolVersion requestedVersion = QtMcp::stringToProtocolVersion(requestedVersionStr);
-                                if (supportedVersions.contains(requestedVersion)) {
-                                    reqVersion = requestedVersion;
-                                }
-                            }
-                            response.setError(error);
-                            // Use the appropriate protocol version for the session
-                            q->send(response.toJsonObject(reqVersion));
-                        } else {
-                            q->send(result);
-                        }
-                    } else {
-                        // Respond with error
+            // nobody waits for it, the request was cancelled but the server
+            // answered before it saw the cancellation
+            if (object.contains("result"_L1) || object.contains("error"_L1))
+                return;
+        }
+        if (object.contains("method"_L1)) {
+            const auto method = methods.find(object.value("method"_L1).toString());
+
+            // request
+            if (object.contains("id"_L1)) {
+                const auto id = object.value("id"_L1);
+                if (method >= 0 && requestHandlers.at(method)) {
+                    const auto &handler = requestHandlers.at(method);
+                    QMcpJSONRPCErrorError error;
+                    const auto result = handler(object, &error);
+                    if (error.code() > 0) {
                         QMcpJSONRPCError response;
                         response.setId(id.toVariant());
-                        auto error = response.error();
-                        error.setMessage("Server doesn't handle the request"_L1);
+                        // Extract protocol version if available in the request
+                        QtMcp::ProtocolVersion reqVersion = protocolVersion;
+                        if (object.contains("params"_L1) && object.value("params"_L1).toObject().contains("protocolVersion"_L1)) {
+                            QString requestedVersionStr = object.value("params"_L1).toObject().value("protocolVersion"_L1).toString();
+                            QtMcp::ProtocolVersion requestedVersion = QtMcp::stringToProtocolVersion(requestedVersionStr);
+                            if (supportedVersions.contains(requestedVersion)) {
+                                reqVersion = requestedVersion;
+                            }
+                        }
                         response.setError(error);
                         // Use the appropriate protocol version for the session
-                        q->send(response.toJsonObject(protocolVersion));
+                        q->send(response.toJsonObject(reqVersion));
+                    } else {
+                        q->send(result);
                     }
-                    return;
+                } else {
+                    // Respond with error
+                    QMcpJSONRPCError response;
+                    response.setId(id.toVariant());
+                    auto error = response.takeError();
+                    error.setMessage("Server doesn't handle the request"_L1);
+                    response.setError(std::move(error));
+                    // Use the appropriate protocol version for the session
+                    q->send(response.toJsonObject(protocolVersion));
                 }
+                return;
+            }
 
-                if (notificationHandlers.contains(method)) {
-                    const auto handlers = notificationHandlers.values(method);
-                    for (auto &handler : handlers) {
-                        handler(object);
-                    }
-                    return;
-                }
+            if (method >= 0 && !notificationHandlers.at(method).isEmpty()) {
+                const auto &handlers = notificationHandlers.at(method);
+                for (qsizetype i = 0; i < handlers.size(); i++)
+                    handlers.at(i)(object);
+                return;
             }
+        }
+
+        qWarning() << "not handled" << object;
+    }
 
-            qWarning() << "not handled" << object;
-        });
+    void send(const QJsonObject &message)
+    {
+        if (batch) {
+            batch->append(message);
+            return;
+        }
+        // only backends of the second interface negotiate CBOR
+        if (encoding == QtMcp::Encoding::Cbor)
+            backendV2->writeMessage(QMcpJsonWriter::toCbor(message));
+        else if (backendV2)
+            backendV2->writeMessage(QMcpJsonWriter::toJson(message));
+        else
+            backend->send(message);
     }
 
 private:
     QMcpClient *q;
 public:
     QMcpClientBackendInterface *backend = nullptr;
+    // set if the backend exchanges raw messages
+    QMcpClientBackendInterfaceV2 *backendV2 = nullptr;
+    // one sequence of request IDs, initialize included
+    int nextId = 0;
+    // requests not answered yet, the callback may be empty
     QHash<QJsonValue, std::function<void(const QJsonObject &, const QJsonObject &)>> callbacks;
-    QHash<QString, std::function<QJsonObject(const QJsonObject &, QMcpJSONRPCErrorError *)>> requestHandlers;
-    QMultiHash<QString, std::function<void(const QJsonObject &)>> notificationHandlers;
+    // the messages of the batch being collected
+    std::optional<QJsonArray> batch;
+    // handlers indexed by method ID, called in place
+    QMcpMethodTable methods;
+    QList<std::function<QJsonObject(const QJsonObject &, QMcpJSONRPCErrorError *)>> requestHandlers;
+    QList<QList<std::function<void(const QJsonObject &)>>> notificationHandlers;
+
+    int intern(const QString &method)
+    {
+        const auto id = methods.intern(method);
+        if (id >= requestHandlers.size()) {
+            requestHandlers.resize(methods.size());
+            notificationHandlers.resize(methods.size());
+        }
+        return id;
+    }
 };
 
 QStringList QMcpClient::backends()
@@ -144,15 +237,44 @@ QList<QtMcp::ProtocolVersion> QMcpClient::supportedProtocolVersions() const
     return d->supportedVersions;
 }
 
+bool QMcpClient::isCborEnabled() const
+{
+    return d->cborEnabled;
+}
+
+void QMcpClient::setCborEnabled(bool enabled)
+{
+    if (d->cborEnabled == enabled) return;
+    d->cborEnabled = enabled;
+    emit cborEnabledChanged(enabled);
+}
+
+bool QMcpClient::isGadgetArenaEnabled() const
+{
+    return d->gadgetArenaEnabled;
+}
+
+void QMcpClient::setGadgetArenaEnabled(bool enabled)
+{
+    if (d->gadgetArenaEnabled == enabled) return;
+    d->gadgetArenaEnabled = enabled;
+    emit gadgetArenaEnabledChanged(enabled);
+}
+
+QtMcp::Encoding QMcpClient::encoding() const
+{
+    return d->encoding;
+}
+
 void QMcpClient::start(const QString &args)
 {
     if (!d->backend) return;
     d->backend->start(args);
 }
 
-void QMcpClient::send(const QJsonObject &request, std::function<void(const QJsonObject &, const QJsonObject &)> callback)
+QJsonValue QMcpClient::send(const QJsonObject &request, std::function<void(const QJsonObject &, const QJsonObject &)> callback)
 {
-    if (!d->backend) return;
+    if (!d->backend) return QJsonValue(QJsonValue::Undefined);
 
     // If this is an initialization request, ensure the protocol version is set
     if (request.contains("method"_L1) && request.value("method"_L1).toString() == "initialize"_L1) {
@@ -165,8 +287,20 @@ void QMcpClient::send(const QJsonObject &request, std::function<void(const QJson
             requestCopy.insert("params"_L1, params);
         }
 
+        // Announce CBOR, it is used once the server announces it as well
+        const bool offerCbor = d->cborEnabled && d->backendV2 && d->backendV2->supportsCbor();
+        if (offerCbor) {
+            auto capabilities = params.value("capabilities"_L1).toObject();
+            auto experimental = capabilities.value("experimental"_L1).toObject();
+            experimental.insert(QMcpCbor::capability(), QJsonObject());
+            capabilities.insert("experimental"_L1, experimental);
+            params.insert("capabilities"_L1, capabilities);
+            requestCopy.insert("params"_L1, params);
+        }
+        d->encoding = QtMcp::Encoding::Json;
+
         // Add a callback to handle the initialization response
-        auto initCallback = [this, callback](const QJsonObject &result, const QJsonObject &error) {
+        auto initCallback = [this, callback, offerCbor](const QJsonObject &result, const QJsonObject &error) {
             if (!error.isEmpty()) {
                 // If there was an error, pass it to the original callback
                 if (callback)
@@ -184,52 +318,92 @@ void QMcpClient::send(const QJsonObject &request, std::function<void(const QJson
                 }
             }
 
+            const auto experimental = result.value("capabilities"_L1).toObject().value("experimental"_L1).toObject();
+            if (offerCbor && experimental.contains(QMcpCbor::capability()))
+                d->encoding = QtMcp::Encoding::Cbor;
+
             // Call the original callback
             if (callback)
                 callback(result, error);
         };
 
         // Send with our wrapped callback
-        static int id = 0;
         if (requestCopy.contains("id"_L1) && requestCopy.value("id"_L1).isNull()) {
+            const int id = d->nextId++;
             auto request2 = requestCopy;
             request2.insert("id"_L1, id);
 
             d->callbacks.insert(id, initCallback);
-            id++;
-            d->backend->send(request2);
-        } else {
-            d->backend->send(requestCopy);
+            d->send(request2);
+            return id;
         }
-
-        return;
+        d->send(requestCopy);
+        return requestCopy.value("id"_L1);
     }
 
     // For non-initialization requests, use the standard flow
-    static int id = 0;
     if (request.contains("id"_L1) && request.value("id"_L1).isNull()) {
+        const int id = d->nextId++;
         auto request2 = request;
         request2.insert("id"_L1, id);
 
-        if (callback)
-            d->callbacks.insert(id, callback);
-        id++;
-        d->backend->send(request2);
+        d->callbacks.insert(id, std::move(callback));
+        d->send(request2);
+        return id;
+    }
+    d->send(request);
+    return request.value("id"_L1);
+}
+
+void QMcpClient::beginBatch()
+{
+    if (!d->batch)
+        d->batch.emplace();
+}
+
+void QMcpClient::endBatch()
+{
+    if (!d->batch)
+        return;
+    const auto batch = *std::exchange(d->batch, std::nullopt);
+    if (batch.isEmpty() || !d->backend)
+        return;
+
+    if (d->backendV2) {
+        d->backendV2->writeMessage(QJsonDocument(batch).toJson(QJsonDocument::Compact));
     } else {
-        d->backend->send(request);
+        // backends of the first interface take single objects
+        for (const auto &value : batch)
+            d->backend->send(value.toObject());
     }
 }
 
+bool QMcpClient::cancel(const QJsonValue &id, const QString &reason)
+{
+    // a late response finds no callback and is dropped
+    if (!d->callbacks.remove(id))
+        return false;
+
+    QMcpCancelledNotification notification;
+    auto params = notification.params();
+    params.setRequestId(id.toVariant());
+    if (!reason.isEmpty())
+        params.setReason(reason);
+    notification.setParams(params);
+    notify(notification);
+    return true;
+}
+
 void QMcpClient::registerRequestHandler(const QString &method, std::function<QJsonObject(const QJsonObject &, QMcpJSONRPCErrorError *)> callback)
 {
     qDebug() << method;
-    d->requestHandlers.insert(method, callback);
+    d->requestHandlers[d->intern(method)] = std::move(callback);
 }
 
 void QMcpClient::registerNotificationHandler(const QString &method, std::function<void(const QJsonObject &)> callback)
 {
     qDebug() << method;
-    d->notificationHandlers.insert(method, callback);
+    d->notificationHandlers[d->intern(method)].append(std::move(callback));
 }
 
 QT_END_NAMESPACE
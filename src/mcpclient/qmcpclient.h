@@ -5,6 +5,7 @@
 #define QMCPCLIENT_H
 
 #include <QtMcpClient/qmcpclientglobal.h>
+#include <QtMcpClient/qmcprequesthandle.h>
 #include <QtCore/QObject>
 #include <QtMcpCommon/QMcpRequest>
 #include <QtMcpCommon/QMcpResult>
@@ -73,6 +74,32 @@ class Q_MCPCLIENT_EXPORT QMcpClient : public QObject
     */
     Q_PROPERTY(QList<QtMcp::ProtocolVersion> supportedProtocolVersions READ supportedProtocolVersions CONSTANT FINAL)
 
+    /*!
+        \property QMcpClient::cborEnabled
+        This property holds whether the client announces the CBOR encoding.
+
+        When enabled and supported by the backend, the initialize request
+        announces the encoding, and the client switches to CBOR if the server
+        announces it as well. Otherwise JSON text is used. Disabled by
+        default, and only read when the initialize request is sent.
+
+        \sa QMcpCbor
+    */
+    Q_PROPERTY(bool cborEnabled READ isCborEnabled WRITE setCborEnabled NOTIFY cborEnabledChanged FINAL)
+
+    /*!
+        \property QMcpClient::gadgetArenaEnabled
+        This property holds whether the gadgets of a message are allocated
+        from a QMcpGadgetArena.
+
+        When enabled, the gadgets created while a message from the server is
+        dispatched share one arena. A gadget kept past the message keeps all
+        memory of the arena alive until it is destroyed. Disabled by default.
+
+        \sa QMcpGadgetArena::retainedSize()
+    */
+    Q_PROPERTY(bool gadgetArenaEnabled READ isGadgetArenaEnabled WRITE setGadgetArenaEnabled NOTIFY gadgetArenaEnabledChanged FINAL)
+
 public:
     /*!
         Returns a list of available backend implementations for the MCP client.
@@ -102,6 +129,22 @@ public:
     */
     QList<QtMcp::ProtocolVersion> supportedProtocolVersions() const;
 
+    /*!
+        Returns whether the client announces the CBOR encoding.
+    */
+    bool isCborEnabled() const;
+
+    /*!
+        Returns whether the gadgets of a message are allocated from an arena.
+    */
+    bool isGadgetArenaEnabled() const;
+
+    /*!
+        Returns the encoding of the messages sent to the server, which is
+        QtMcp::Encoding::Cbor once both sides agreed on it.
+    */
+    QtMcp::Encoding encoding() const;
+
     /*!
         \internal
         Helper struct for extracting callback argument types.
@@ -139,10 +182,11 @@ public:
 
         \param request Request object inheriting from QMcpRequest
         \param callback Callback function to handle the response
+        \return A handle to cancel the request with
     */
     template<typename Request, typename Callback>
         requires std::invocable<Callback, const CallbackResult<Callback> &, const QMcpJSONRPCErrorError *>
-    void request(const Request &request, Callback callback)
+    QMcpRequestHandle request(const Request &request, Callback callback)
     {
         using Result = CallbackResult<Callback>;
 
@@ -152,7 +196,7 @@ public:
         // For initialize requests, we'll handle protocol version negotiation in the send method
         // For all other requests, we use the current protocol version
         auto json = request.toJsonObject(protocolVersion());
-        send(json, [callback, this](const QJsonObject &json, const QJsonObject &error) {
+        const auto id = send(json, [callback, this](const QJsonObject &json, const QJsonObject &error) {
             // Use the negotiated protocol version from the response when available
             QtMcp::ProtocolVersion versionToUse = protocolVersion();
 
@@ -175,6 +219,7 @@ public:
                 callback(result, nullptr);
             }
         });
+        return QMcpRequestHandle(this, id);
     }
 
     /*!
@@ -183,17 +228,42 @@ public:
         This overload is useful for fire-and-forget requests where no response handling is needed.
 
         \param request Request object inheriting from QMcpRequest
+        \return A handle to cancel the request with
     */
     template<typename Request>
-    void request(const Request &request)
+    QMcpRequestHandle request(const Request &request)
     {
         static_assert(std::is_base_of<QMcpRequest, Request>::value, "Request must inherit from QMcpRequest");
 
         // Use the current protocol version for sending the request
         auto json = request.toJsonObject(protocolVersion());
-        send(json);
+        return QMcpRequestHandle(this, send(json));
     }
 
+    /*!
+        Starts collecting the requests and notifications sent from now on
+        into a JSON-RPC batch, which endBatch() sends as one message.
+
+        The server may answer the requests of a batch in any order, the
+        callbacks are called as usual. Batches are sent as JSON text even
+        if the CBOR encoding is used, and should not contain an initialize
+        request.
+
+        \code
+        client->beginBatch();
+        client->request(QMcpListToolsRequest(), onTools);
+        client->request(QMcpListPromptsRequest(), onPrompts);
+        client->endBatch();
+        \endcode
+    */
+    void beginBatch();
+
+    /*!
+        Sends the requests and notifications collected since beginBatch()
+        in one message. Does nothing if no batch was started.
+    */
+    void endBatch();
+
     /*!
         Sends a notification to the server.
 
@@ -336,6 +406,22 @@ public slots:
     */
     void setProtocolVersion(QtMcp::ProtocolVersion protocolVersion);
 
+    /*!
+        Sets whether the client announces the CBOR encoding.
+        This should be called before sending initialization requests.
+
+        \param enabled Whether to announce the encoding
+    */
+    void setCborEnabled(bool enabled);
+
+    /*!
+        Sets whether the gadgets of the messages received from now on are
+        allocated from an arena.
+
+        \param enabled Whether to use an arena per message
+    */
+    void setGadgetArenaEnabled(bool enabled);
+
     /*!
         Starts the MCP client with the given arguments.
 
@@ -350,6 +436,18 @@ signals:
     */
     void protocolVersionChanged(QtMcp::ProtocolVersion protocolVersion);
 
+    /*!
+        Emitted when announcing the CBOR encoding is enabled or disabled.
+        \param enabled Whether the encoding is announced
+    */
+    void cborEnabledChanged(bool enabled);
+
+    /*!
+        Emitted when allocating gadgets from arenas is enabled or disabled.
+        \param enabled Whether an arena is used per message
+    */
+    void gadgetArenaEnabledChanged(bool enabled);
+
     /*!
         Emitted when the client has successfully started.
     */
@@ -368,7 +466,10 @@ signals:
     void received(const QJsonObject &object);
 
 private:
-    void send(const QJsonObject &message, std::function<void(const QJsonObject &, const QJsonObject &)> callback = nullptr);
+    friend class QMcpRequestHandle;
+    // returns the ID of a request
+    QJsonValue send(const QJsonObject &message, std::function<void(const QJsonObject &, const QJsonObject &)> callback = nullptr);
+    bool cancel(const QJsonValue &id, const QString &reason);
     void registerRequestHandler(const QString &method, std::function<QJsonObject(const QJsonObject &, QMcpJSONRPCErrorError *)>);
     void registerNotificationHandler(const QString &method, std::function<void(const QJsonObject &)>);
 
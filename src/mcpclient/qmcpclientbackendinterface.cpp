@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpclientbackendinterface.h"
+#include <QtMcpCommon/qmcpjsonwriter.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -38,4 +39,23 @@ void QMcpClientBackendInterface::request(const QJsonObject &request, std::functi
     }
 }
 
+QMcpClientBackendInterfaceV2::QMcpClientBackendInterfaceV2(QObject *parent)
+    : QMcpClientBackendInterface(parent)
+{}
+
+bool QMcpClientBackendInterfaceV2::supportsCbor() const
+{
+    return false;
+}
+
+void QMcpClientBackendInterfaceV2::send(const QJsonObject &object)
+{
+    writeMessage(QMcpJsonWriter::toJson(object));
+}
+
+void QMcpClientBackendInterfaceV2::notify(const QJsonObject &object)
+{
+    writeMessage(QMcpJsonWriter::toJson(object));
+}
+
 QT_END_NAMESPACE
@@ -102,6 +102,69 @@ private:
     QHash<QJsonValue, std::function<void(const QJsonObject &)>> callbacks;
 };
 
+/*!
+    \class QMcpClientBackendInterfaceV2
+    \inmodule QtMcpClient
+    \brief The QMcpClientBackendInterfaceV2 class is the interface for MCP client backends exchanging raw messages.
+
+    A backend implementing this interface does not parse or serialize
+    messages. It emits messageReceived() with the bytes of every complete
+    message it reads, JSON text or CBOR, and QMcpClient parses them. In the
+    other direction QMcpClient hands the serialized messages to
+    writeMessage(), moving the buffer so the backend can queue it without a
+    copy.
+
+    The QJsonObject based slots of QMcpClientBackendInterface are
+    implemented on top of writeMessage(), and received() and result() are
+    not emitted. Backends implementing only QMcpClientBackendInterface keep
+    working; QMcpClient talks to them through the QJsonObject API.
+
+    QMcpClientBackendInterface is frozen so that backend plugins built
+    against it keep loading; everything added since is declared here.
+*/
+class Q_MCPCLIENT_EXPORT QMcpClientBackendInterfaceV2 : public QMcpClientBackendInterface
+{
+    Q_OBJECT
+public:
+    /*!
+        Constructs a client backend interface with the given parent.
+        \param parent The parent object
+    */
+    explicit QMcpClientBackendInterfaceV2(QObject *parent = nullptr);
+
+    /*!
+        Writes the complete message \a message to the server.
+        Must be implemented by backend classes.
+
+        The message is compact JSON text without a trailing newline, or CBOR
+        once the encoding was negotiated, which QMcpCbor::isCbor() tells.
+        The backend takes over \a message and adds whatever framing its
+        transport needs.
+    */
+    virtual void writeMessage(QByteArray &&message) = 0;
+
+    /*!
+        Returns \c true if the backend can carry messages encoded as CBOR in
+        both directions. The client only announces the CBOR encoding through
+        such backends, see QMcpCbor.
+
+        The default implementation returns \c false.
+    */
+    virtual bool supportsCbor() const;
+
+public slots:
+    void send(const QJsonObject &object) final;
+    void notify(const QJsonObject &object) final;
+
+signals:
+    /*!
+        Emitted when a complete message was read from the server.
+        \a message holds the JSON text or CBOR of exactly one message,
+        without framing.
+    */
+    void messageReceived(const QByteArray &message);
+};
+
 QT_END_NAMESPACE
 
 #endif // QMCPCLIENTBACKENDINTERFACE_H
@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcprequesthandle.h"
+#include "qmcpclient.h"
+
+QT_BEGIN_NAMESPACE
+
+QMcpRequestHandle::QMcpRequestHandle(QMcpClient *client, const QJsonValue &id)
+    : client(client)
+    , requestId(id)
+{}
+
+bool QMcpRequestHandle::isValid() const
+{
+    return client && !requestId.isUndefined();
+}
+
+QJsonValue QMcpRequestHandle::id() const
+{
+    return requestId;
+}
+
+bool QMcpRequestHandle::cancel(const QString &reason) const
+{
+    if (!isValid())
+        return false;
+    return client->cancel(requestId, reason);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPREQUESTHANDLE_H
+#define QMCPREQUESTHANDLE_H
+
+#include <QtCore/QJsonValue>
+#include <QtCore/QPointer>
+#include <QtMcpClient/qmcpclientglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+class QMcpClient;
+
+/*!
+    \class QMcpRequestHandle
+    \inmodule QtMcpClient
+    \brief The QMcpRequestHandle class refers to a request sent with
+    QMcpClient::request().
+
+    \code
+    auto handle = client->request(request, [](const QMcpCallToolResult &result,
+                                              const QMcpJSONRPCErrorError *error) {
+        // not called once the request is cancelled
+    });
+    ...
+    handle.cancel("No longer needed"_L1);
+    \endcode
+
+    \sa QMcpCancelledNotification
+*/
+class Q_MCPCLIENT_EXPORT QMcpRequestHandle
+{
+public:
+    /*!
+        Constructs an invalid handle.
+    */
+    QMcpRequestHandle() = default;
+
+    /*!
+        Returns whether the handle refers to a request of a client that
+        still exists.
+    */
+    bool isValid() const;
+
+    /*!
+        Returns the JSON-RPC ID of the request.
+    */
+    QJsonValue id() const;
+
+    /*!
+        Cancels the request: sends \c notifications/cancelled with the
+        optional \a reason to the server, and drops its response, so the
+        callback is not called.
+
+        Returns false if the request was answered or cancelled already.
+        An initialize request must not be cancelled.
+    */
+    bool cancel(const QString &reason = QString()) const;
+
+private:
+    friend class QMcpClient;
+    QMcpRequestHandle(QMcpClient *client, const QJsonValue &id);
+
+    QPointer<QMcpClient> client;
+    QJsonValue requestId;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPREQUESTHANDLE_H
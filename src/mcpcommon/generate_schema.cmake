@@ -0,0 +1,500 @@
+# Copyright (C) 2025 Signal Slot Inc.
+# SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+# Generates the field tables behind QMcpSchema from the MCP JSON schemas.
+#
+#   cmake -DOUTPUT=<header> -DSCHEMAS=<version>=<schema.json>;...
+#         [-DSERIALIZERS=<header> -DHEADER_DIR=<dir>] -P generate_schema.cmake
+#
+# Every object definition becomes a type named like the gadget class without
+# the QMcp prefix. Inline objects of a property are named after the owning
+# type followed by the capitalized property key, e.g. CallToolRequestParams,
+# matching the hand-written gadget classes.
+#
+# With SERIALIZERS, the gadget headers in HEADER_DIR are read as well and
+# toJsonObject() and writeJson() functions are generated per class and
+# version, see "Serializers" below.
+
+cmake_minimum_required(VERSION 3.19)
+
+if(NOT OUTPUT OR NOT SCHEMAS OR (SERIALIZERS AND NOT HEADER_DIR))
+    message(FATAL_ERROR "usage: cmake -DOUTPUT=<header> -DSCHEMAS=<version>=<schema.json>;... [-DSERIALIZERS=<header> -DHEADER_DIR=<dir>] -P ${CMAKE_CURRENT_LIST_FILE}")
+endif()
+
+# JSON type of a property, following one $ref into the definitions
+function(mcp_schema_json_type json property out_var)
+    string(JSON ref ERROR_VARIABLE error GET "${property}" "$ref")
+    if(NOT error)
+        string(REPLACE "#/definitions/" "" ref "${ref}")
+        string(JSON property GET "${json}" definitions "${ref}")
+    endif()
+    string(JSON type_kind ERROR_VARIABLE error TYPE "${property}" type)
+    if(error OR NOT type_kind STREQUAL "STRING")
+        # anyOf or a list of types
+        set(${out_var} "Any" PARENT_SCOPE)
+        return()
+    endif()
+    string(JSON type GET "${property}" type)
+    if(type STREQUAL "object")
+        set(result Object)
+    elseif(type STREQUAL "array")
+        set(result Array)
+    elseif(type STREQUAL "string")
+        set(result String)
+    elseif(type STREQUAL "number")
+        set(result Number)
+    elseif(type STREQUAL "integer")
+        set(result Integer)
+    elseif(type STREQUAL "boolean")
+        set(result Boolean)
+    else()
+        set(result Any)
+    endif()
+    set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
+
+# appends "<type> <key> <jsonType> <required> [<const>]" for each property of
+# the object to out_var, recursing into inline objects
+function(mcp_schema_collect json type_name object out_var)
+    set(entries ${${out_var}})
+
+    set(required_keys "")
+    string(JSON required_count ERROR_VARIABLE error LENGTH "${object}" required)
+    if(NOT error AND required_count GREATER 0)
+        math(EXPR last "${required_count} - 1")
+        foreach(i RANGE ${last})
+            string(JSON key GET "${object}" required ${i})
+            list(APPEND required_keys "${key}")
+        endforeach()
+    endif()
+
+    string(JSON property_count ERROR_VARIABLE error LENGTH "${object}" properties)
+    if(error OR property_count EQUAL 0)
+        set(${out_var} "${entries}" PARENT_SCOPE)
+        return()
+    endif()
+
+    math(EXPR last "${property_count} - 1")
+    foreach(i RANGE ${last})
+        string(JSON key MEMBER "${object}" properties ${i})
+        string(JSON property GET "${object}" properties "${key}")
+        mcp_schema_json_type("${json}" "${property}" json_type)
+
+        if(key IN_LIST required_keys)
+            set(required true)
+        else()
+            set(required false)
+        endif()
+
+        set(entry "${type_name} ${key} ${json_type} ${required}")
+        string(JSON constant ERROR_VARIABLE error GET "${property}" const)
+        if(NOT error)
+            string(APPEND entry " ${constant}")
+        endif()
+        list(APPEND entries "${entry}")
+
+        # inline objects, directly or as array elements, are types of their own
+        set(nested "${property}")
+        if(json_type STREQUAL "Array")
+            string(JSON nested ERROR_VARIABLE error GET "${property}" items)
+            if(error)
+                continue()
+            endif()
+        endif()
+        string(JSON nested_type ERROR_VARIABLE error GET "${nested}" type)
+        string(JSON nested_properties ERROR_VARIABLE properties_error GET "${nested}" properties)
+        if(NOT error AND NOT properties_error AND nested_type STREQUAL "object")
+            string(REGEX REPLACE "^_+" "" nested_key "${key}")
+            string(SUBSTRING "${nested_key}" 0 1 first)
+            string(SUBSTRING "${nested_key}" 1 -1 rest)
+            string(TOUPPER "${first}" first)
+            mcp_schema_collect("${json}" "${type_name}${first}${rest}" "${nested}" entries)
+        endif()
+    endforeach()
+
+    set(${out_var} "${entries}" PARENT_SCOPE)
+endfunction()
+
+set(content "// This file is generated by generate_schema.cmake from the MCP JSON schemas.\n")
+string(APPEND content "// Do not edit.\n\n")
+set(version_entries "")
+set(version_ids "")
+
+foreach(schema IN LISTS SCHEMAS)
+    string(REGEX MATCH "^([^=]+)=(.+)$" match "${schema}")
+    if(NOT match)
+        message(FATAL_ERROR "invalid schema argument: ${schema}")
+    endif()
+    set(version "${CMAKE_MATCH_1}")
+    set(file "${CMAKE_MATCH_2}")
+    string(REPLACE "-" "_" version_id "${version}")
+    list(APPEND version_ids "${version_id}")
+    file(READ "${file}" json)
+
+    set(entries "")
+    string(JSON definition_count LENGTH "${json}" definitions)
+    math(EXPR last "${definition_count} - 1")
+    foreach(i RANGE ${last})
+        string(JSON name MEMBER "${json}" definitions ${i})
+        string(JSON definition GET "${json}" definitions "${name}")
+        mcp_schema_collect("${json}" "${name}" "${definition}" entries)
+    endforeach()
+    # the lookup does a binary search over the type names
+    list(SORT entries)
+
+    string(APPEND content "static constexpr QMcpSchema::Field fields_${version_id}[] = {\n")
+    foreach(entry IN LISTS entries)
+        string(REPLACE " " ";" fields "${entry}")
+        list(GET fields 0 type_name)
+        list(GET fields 1 key)
+        list(GET fields 2 json_type)
+        list(GET fields 3 required)
+        list(APPEND schema_${version_id}_${type_name} "${key}")
+        list(LENGTH fields field_count)
+        if(field_count GREATER 4)
+            list(GET fields 4 constant)
+            set(constant "\"${constant}\"")
+        else()
+            set(constant "nullptr")
+        endif()
+        string(APPEND content "    { \"${type_name}\", \"${key}\", QMcpSchema::${json_type}, ${required}, ${constant} },\n")
+    endforeach()
+    string(APPEND content "};\n\n")
+    string(APPEND version_entries "    { QtMcp::ProtocolVersion::v${version_id}, fields_${version_id} },\n")
+endforeach()
+
+string(APPEND content "static constexpr QMcpSchemaVersion versions[] = {\n${version_entries}};\n")
+
+# keeps the timestamp when nothing changed to avoid rebuilds
+function(mcp_write_if_changed output content)
+    file(WRITE "${output}.tmp" "${content}")
+    configure_file("${output}.tmp" "${output}" COPYONLY)
+    file(REMOVE "${output}.tmp")
+endfunction()
+
+mcp_write_if_changed("${OUTPUT}" "${content}")
+
+if(NOT SERIALIZERS)
+    return()
+endif()
+
+# Serializers
+#
+# A class gets generated functions when it and its base classes up to
+# QMcpGadget track modifications, do not declare QMcpSince, do not reimplement
+# the JSON conversion and only have properties of the types handled by
+# mcp_serializer_kind(). The functions read the properties through their
+# getters instead of QMetaProperty and QVariant. QMcpGadgetPlan checks the
+# property list of each function against its own before using it.
+
+# reads the gadget classes of the headers
+set(gadget_classes "")
+file(GLOB headers "${HEADER_DIR}/qmcp*.h")
+list(SORT headers)
+foreach(header IN LISTS headers)
+    get_filename_component(header_name "${header}" NAME)
+    file(READ "${header}" text)
+    # one list element per line
+    foreach(character ";" "[" "]" "\\")
+        string(REPLACE "${character}" "" text "${text}")
+    endforeach()
+    string(REPLACE "\n" ";" lines "${text}")
+
+    set(class "")
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^class Q_MCPCOMMON_EXPORT (QMcp[A-Za-z0-9_]+) *: *public (QMcp[A-Za-z0-9_]+)")
+            set(class "${CMAKE_MATCH_1}")
+            list(APPEND gadget_classes "${class}")
+            set(${class}_base "${CMAKE_MATCH_2}")
+            set(${class}_header "${header_name}")
+            set(${class}_properties "")
+            set(${class}_base64 "")
+            set(${class}_tracking false)
+            set(${class}_custom false)
+        elseif(class STREQUAL "")
+            continue()
+        elseif(line MATCHES "^}")
+            set(class "")
+        elseif(line MATCHES "Q_PROPERTY\\((.+) ([A-Za-z_][A-Za-z0-9_]*) READ ([A-Za-z_][A-Za-z0-9_]*)(.*)\\)")
+            string(STRIP "${CMAKE_MATCH_1}" type)
+            set(name "${CMAKE_MATCH_2}")
+            set(getter "${CMAKE_MATCH_3}")
+            set(required false)
+            if(CMAKE_MATCH_4 MATCHES " REQUIRED")
+                set(required true)
+            endif()
+            list(APPEND ${class}_properties "${name}|${getter}|${required}|${type}")
+        elseif(line MATCHES "Q_CLASSINFO\\(\"([^\"]+)\", *\"([^\"]*)\"\\)")
+            set(info_name "${CMAKE_MATCH_1}")
+            set(info_value "${CMAKE_MATCH_2}")
+            if(info_name STREQUAL "QMcpModifiedTracking" AND info_value STREQUAL "true")
+                set(${class}_tracking true)
+            elseif(info_name MATCHES "^QMcpSince:")
+                set(${class}_custom true)
+            elseif(info_name MATCHES "^QMcpBase64:(.+)$" AND info_value STREQUAL "true")
+                list(APPEND ${class}_base64 "${CMAKE_MATCH_1}")
+            endif()
+        elseif(line MATCHES "(writeJsonProperty|toJsonObject|writeJson|fromJsonObject)\\(")
+            set(${class}_custom true)
+        endif()
+    endforeach()
+endforeach()
+if(NOT gadget_classes)
+    message(FATAL_ERROR "no gadget classes found in ${HEADER_DIR}")
+endif()
+
+function(mcp_is_gadget class out_var)
+    while(class IN_LIST gadget_classes)
+        set(class "${${class}_base}")
+    endwhile()
+    if(class STREQUAL "QMcpGadget")
+        set(${out_var} true PARENT_SCOPE)
+    else()
+        set(${out_var} false PARENT_SCOPE)
+    endif()
+endfunction()
+
+# the kind of generated code for a property type, empty when unsupported
+function(mcp_serializer_kind type out_var)
+    set(kind "")
+    if(type MATCHES "^QList<(.+)>$")
+        set(element "${CMAKE_MATCH_1}")
+        mcp_is_gadget("${element}" is_gadget)
+        if(element STREQUAL "QString")
+            set(kind StringList)
+        elseif(is_gadget)
+            set(kind GadgetList)
+        endif()
+    elseif(type STREQUAL "bool")
+        set(kind Bool)
+    elseif(type STREQUAL "int")
+        set(kind Int)
+    elseif(type STREQUAL "qreal" OR type STREQUAL "double")
+        set(kind Double)
+    elseif(type STREQUAL "QString")
+        set(kind String)
+    elseif(type STREQUAL "QByteArray")
+        set(kind ByteArray)
+    elseif(type STREQUAL "QUrl")
+        set(kind Url)
+    elseif(type STREQUAL "QJsonObject")
+        set(kind JsonObject)
+    elseif(type STREQUAL "QJsonValue")
+        set(kind JsonValue)
+    else()
+        mcp_is_gadget("${type}" is_gadget)
+        if(is_gadget)
+            set(kind Gadget)
+        endif()
+    endif()
+    set(${out_var} "${kind}" PARENT_SCOPE)
+endfunction()
+
+# the statements converting a property, each line starting with @I@ in place
+# of the indentation
+function(mcp_serializer_code kind getter name base64 out_object out_writer)
+    set(key "\"${name}\"_L1")
+    set(value "g->${getter}()")
+    set(object "")
+    set(writer "@I@writer.writeKey(${key});\n")
+    if(kind STREQUAL "Bool")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeBool(${value});\n")
+    elseif(kind STREQUAL "Int")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeInteger(${value});\n")
+    elseif(kind STREQUAL "Double")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeDouble(${value});\n")
+    elseif(kind STREQUAL "String")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeString(${value});\n")
+    elseif(kind STREQUAL "ByteArray")
+        string(APPEND object "@I@ret.insert(${key}, QString::fromUtf8(${value}));\n")
+        if(base64)
+            string(APPEND writer "@I@writer.writeBase64Encoded(${value});\n")
+        else()
+            string(APPEND writer "@I@writer.writeUtf8String(${value});\n")
+        endif()
+    elseif(kind STREQUAL "Url")
+        string(APPEND object "@I@ret.insert(${key}, ${value}.toString());\n")
+        string(APPEND writer "@I@writer.writeString(${value}.toString());\n")
+    elseif(kind STREQUAL "JsonObject")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeObject(${value});\n")
+    elseif(kind STREQUAL "JsonValue")
+        string(APPEND object "@I@ret.insert(${key}, ${value});\n")
+        string(APPEND writer "@I@writer.writeValue(${value});\n")
+    elseif(kind STREQUAL "Gadget")
+        string(APPEND object "@I@ret.insert(${key}, ${value}.toJsonObject(protocolVersion));\n")
+        string(APPEND writer "@I@${value}.writeJson(writer, protocolVersion);\n")
+    elseif(kind STREQUAL "StringList")
+        string(APPEND object "@I@ret.insert(${key}, QJsonArray::fromStringList(${value}));\n")
+        string(APPEND writer "@I@const auto list = ${value};\n")
+        string(APPEND writer "@I@writer.beginArray();\n")
+        string(APPEND writer "@I@for (const auto &item : list)\n")
+        string(APPEND writer "@I@    writer.writeString(item);\n")
+        string(APPEND writer "@I@writer.endArray();\n")
+    elseif(kind STREQUAL "GadgetList")
+        string(APPEND object "@I@QJsonArray array;\n")
+        string(APPEND object "@I@const auto list = ${value};\n")
+        string(APPEND object "@I@for (const auto &item : list)\n")
+        string(APPEND object "@I@    array.append(item.toJsonObject(protocolVersion));\n")
+        string(APPEND object "@I@ret.insert(${key}, array);\n")
+        string(APPEND writer "@I@const auto list = ${value};\n")
+        string(APPEND writer "@I@writer.beginArray();\n")
+        string(APPEND writer "@I@for (const auto &item : list)\n")
+        string(APPEND writer "@I@    item.writeJson(writer, protocolVersion);\n")
+        string(APPEND writer "@I@writer.endArray();\n")
+    endif()
+    set(${out_object} "${object}" PARENT_SCOPE)
+    set(${out_writer} "${writer}" PARENT_SCOPE)
+endfunction()
+
+# only required or modified properties are serialized; lists get a block of
+# their own for their local variable
+function(mcp_serializer_block code required index out_var)
+    if(NOT required)
+        string(REPLACE "@I@" "        " code "${code}")
+        set(code "    if (modified & (quint64(1) << ${index})) {\n${code}    }\n")
+    elseif(code MATCHES "const auto list")
+        string(REPLACE "@I@" "        " code "${code}")
+        set(code "    {\n${code}    }\n")
+    else()
+        string(REPLACE "@I@" "    " code "${code}")
+    endif()
+    set(${out_var} "${code}" PARENT_SCOPE)
+endfunction()
+
+set(includes "")
+set(functions "")
+set(serializer_entries "")
+foreach(class IN LISTS gadget_classes)
+    # the classes from QMcpGadget down to the class
+    set(chain "")
+    set(base64 "")
+    set(eligible true)
+    set(current "${class}")
+    while(NOT current STREQUAL "QMcpGadget")
+        if(NOT current IN_LIST gadget_classes OR ${current}_custom
+           OR (NOT "${${current}_properties}" STREQUAL "" AND NOT ${current}_tracking))
+            set(eligible false)
+            break()
+        endif()
+        list(PREPEND chain "${current}")
+        list(APPEND base64 ${${current}_base64})
+        set(current "${${current}_base}")
+    endwhile()
+    if(NOT eligible)
+        continue()
+    endif()
+
+    # "<index>|<name>|<getter>|<required>|<kind>|<owner>" in the order of the
+    # property indexes
+    set(properties "")
+    set(index 0)
+    foreach(owner IN LISTS chain)
+        foreach(property IN LISTS ${owner}_properties)
+            string(REPLACE "|" ";" fields "${property}")
+            list(GET fields 0 name)
+            list(GET fields 1 getter)
+            list(GET fields 2 required)
+            list(GET fields 3 type)
+            mcp_serializer_kind("${type}" kind)
+            if(NOT kind)
+                set(eligible false)
+                break()
+            endif()
+            # a property redeclared by a subclass shadows the one of the base class
+            list(FILTER properties EXCLUDE REGEX "^[0-9]+\\|${name}\\|")
+            list(APPEND properties "${index}|${name}|${getter}|${required}|${kind}|${owner}")
+            math(EXPR index "${index} + 1")
+        endforeach()
+    endforeach()
+    # the modified bits are a quint64
+    if(NOT eligible OR index GREATER 64)
+        continue()
+    endif()
+
+    list(APPEND includes "${${class}_header}")
+    string(SUBSTRING "${class}" 4 -1 class_type)
+    foreach(version_id IN LISTS version_ids)
+        set(fields_code "")
+        set(object_code "")
+        set(writer_code "")
+        foreach(property IN LISTS properties)
+            string(REPLACE "|" ";" fields "${property}")
+            list(GET fields 0 index)
+            list(GET fields 1 name)
+            list(GET fields 2 getter)
+            list(GET fields 3 required)
+            list(GET fields 4 kind)
+            list(GET fields 5 owner)
+
+            # left out when the schema of the version lacks a field that the
+            # schema of another version has, as in existsInVersion()
+            string(SUBSTRING "${owner}" 4 -1 type)
+            if(NOT "${schema_${version_id}_${type}}" STREQUAL "" AND NOT name IN_LIST schema_${version_id}_${type})
+                set(exists true)
+                foreach(other IN LISTS version_ids)
+                    if(NOT other STREQUAL version_id AND name IN_LIST schema_${other}_${type})
+                        set(exists false)
+                    endif()
+                endforeach()
+                if(NOT exists)
+                    continue()
+                endif()
+            endif()
+
+            if(name IN_LIST base64)
+                set(is_base64 true)
+            else()
+                set(is_base64 false)
+            endif()
+            mcp_serializer_code(${kind} ${getter} ${name} ${is_base64} object writer)
+            mcp_serializer_block("${object}" ${required} ${index} object)
+            mcp_serializer_block("${writer}" ${required} ${index} writer)
+            string(APPEND fields_code "    { \"${name}\", ${index}, ${required} },\n")
+            string(APPEND object_code "${object}")
+            string(APPEND writer_code "${writer}")
+        endforeach()
+
+        set(suffix "${class_type}_${version_id}")
+        set(prologue "")
+        if(fields_code STREQUAL "")
+            set(fields_name "{}")
+            string(APPEND prologue "    Q_UNUSED(gadget);\n")
+        else()
+            set(fields_name "fields_${suffix}")
+            string(APPEND functions "const QMcpGadgetPlan::SerializedProperty ${fields_name}[] = {\n${fields_code}};\n\n")
+            string(APPEND prologue "    const auto *g = static_cast<const ${class} *>(gadget);\n")
+        endif()
+        if(NOT "${object_code}" MATCHES "modified")
+            string(APPEND prologue "    Q_UNUSED(modified);\n")
+        endif()
+        if(NOT "${object_code}" MATCHES "protocolVersion")
+            string(APPEND prologue "    Q_UNUSED(protocolVersion);\n")
+        endif()
+
+        string(APPEND functions "QJsonObject toJsonObject_${suffix}(const QMcpGadget *gadget, quint64 modified, QtMcp::ProtocolVersion protocolVersion)\n{\n")
+        string(APPEND functions "${prologue}    QJsonObject ret;\n${object_code}    return ret;\n}\n\n")
+        string(APPEND functions "void writeJson_${suffix}(const QMcpGadget *gadget, quint64 modified, QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion)\n{\n")
+        string(APPEND functions "${prologue}    writer.beginObject();\n${writer_code}    writer.endObject();\n}\n\n")
+        string(APPEND serializer_entries "    { &${class}::staticMetaObject, QtMcp::ProtocolVersion::v${version_id}, ${fields_name}, toJsonObject_${suffix}, writeJson_${suffix} },\n")
+    endforeach()
+endforeach()
+
+set(content "// This file is generated by generate_schema.cmake from the gadget headers\n")
+string(APPEND content "// and the MCP JSON schemas.\n")
+string(APPEND content "// Do not edit.\n\n")
+string(APPEND content "#include <QtCore/qjsonarray.h>\n")
+string(APPEND content "#include <QtMcpCommon/qmcpjsonwriter.h>\n")
+list(REMOVE_DUPLICATES includes)
+foreach(include IN LISTS includes)
+    string(APPEND content "#include <QtMcpCommon/${include}>\n")
+endforeach()
+string(APPEND content "\nQT_BEGIN_NAMESPACE\n\nnamespace {\n\n${functions}")
+string(APPEND content "const QMcpGadgetPlan::Serializer serializers[] = {\n${serializer_entries}};\n\n")
+string(APPEND content "}\n\nQT_END_NAMESPACE\n")
+
+mcp_write_if_changed("${SERIALIZERS}" "${content}")
@@ -17,6 +17,9 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpAnnotated : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
+    // annotations are not sent to 2024-11-05 clients
+    Q_CLASSINFO("QMcpSince:annotations", "2025-03-26")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
 
@@ -30,19 +33,43 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
     }
 
-    QJsonObject toJsonObject(QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const override;
-    bool fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) override;
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
+    }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
 private:
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpAnnotations annotations;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), annotations);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpAnnotations : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpAnnotations::audience
@@ -47,6 +48,18 @@ public:
     void setAudience(const QList<QMcpRole::QMcpRole> &audience) {
         if (this->audience() == audience) return;
         d<Private>()->audience = audience;
+        setModified(audienceIndex());
+    }
+
+    void setAudience(QList<QMcpRole::QMcpRole> &&audience) {
+        if (!isModified(audienceIndex()) && this->audience() == audience) return;
+        d<Private>()->audience = std::move(audience);
+        setModified(audienceIndex());
+    }
+
+    QList<QMcpRole::QMcpRole> takeAudience() {
+        clearModified(audienceIndex());
+        return std::exchange(d<Private>()->audience, QList<QMcpRole::QMcpRole>());
     }
 
     qreal priority() const {
@@ -58,6 +71,7 @@ public:
         qreal clampedPriority = qBound(0.0, priority, 1.0);
         if (this->priority() == clampedPriority) return;
         d<Private>()->priority = clampedPriority;
+        setModified(priorityIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -65,10 +79,30 @@ public:
     }
 
 private:
+    static int audienceIndex() {
+        static const int index = staticMetaObject.indexOfProperty("audience");
+        return index;
+    }
+    static int priorityIndex() {
+        static const int index = staticMetaObject.indexOfProperty("priority");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QList<QMcpRole::QMcpRole> audience;
         qreal priority = 0;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && audience == that.audience
+                && priority == that.priority;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), audience, priority);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
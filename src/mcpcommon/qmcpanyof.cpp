@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpanyof.h"
+#include "qmcpgadget_p.h"
+#include "qmcpjsonwriter.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -10,30 +12,35 @@ bool QMcpAnyOf::fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion
     const auto mo = metaObject();
     int propertyIndex = d<Private>()->findPropertyIndex(object);
     if (propertyIndex < 0) {
-        auto typeMatches = [&object](const QMcpGadget *gadget) -> bool {
-            auto keys = object.keys();
-            const auto mo = gadget->metaObject();
-            for (int j = 0; j < mo->propertyCount(); j++) {
-                const auto property = mo->property(j);
-                const auto propertyName = QString::fromLatin1(property.name());
-                const auto isConstant = property.isConstant();
-                const auto isRequired = property.isRequired();
-                if (keys.contains(propertyName)) {
-                    keys.removeOne(propertyName);
-                } else if (isRequired) {
+        // "method" of requests and notifications, "type" of contents
+        const auto *plan = QMcpGadgetPlan::get(mo, protocolVersion);
+        if (!plan->discriminator.isEmpty()) {
+            const auto it = object.constFind(plan->discriminator);
+            if (it != object.constEnd() && it.value().isString())
+                propertyIndex = plan->alternatives.value(it.value().toString(), -1);
+        }
+    }
+    if (propertyIndex < 0) {
+        auto typeMatches = [&object, protocolVersion](const QMcpGadget *gadget) -> bool {
+            const auto *plan = QMcpGadgetPlan::get(gadget->metaObject(), protocolVersion);
+            qsizetype found = 0;
+            for (const auto &property : plan->properties) {
+                if (object.contains(property.key)) {
+                    found++;
+                } else if (property.required) {
                     // object must contain required property
                     return false;
-                } else if (isConstant) {
+                } else if (property.constant) {
                     // const property must match
-                    const auto propertyValue = property.readOnGadget(gadget);
-                    if (object.value(propertyName).toVariant() != propertyValue) {
-                        qWarning() << mo->className() << propertyName << object.value(propertyName) << propertyValue;
+                    const auto propertyValue = property.metaProperty.readOnGadget(gadget);
+                    if (object.value(property.key).toVariant() != propertyValue) {
+                        qWarning() << gadget->metaObject()->className() << property.key << object.value(property.key) << propertyValue;
                         return false;
                     }
                 }
             }
             // if object contains unknown property, return false
-            return keys.isEmpty();
+            return found == object.size();
         };
 
         QList<int> matched;
@@ -69,38 +76,33 @@ bool QMcpAnyOf::fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion
     auto propertyValue = property.readOnGadget(this);
     if (propertyValue.canConvert<QMcpGadget>()) {
         auto *gadget = reinterpret_cast<QMcpGadget *>(propertyValue.data());
-        const auto mo = gadget->metaObject();
-        for (int i = 0; i < mo->propertyCount(); i++) {
-            const auto property = mo->property(i);
-            if (property.isConstant())
+        const auto *plan = QMcpGadgetPlan::get(gadget->metaObject(), protocolVersion);
+        for (const auto &property : plan->properties) {
+            if (property.constant)
                 continue;
 
-            const auto propertyType = property.typeName();
-            const auto propertyName = QString::fromLatin1(property.name());
-            if (!object.contains(propertyName))
+            const auto it = object.constFind(property.key);
+            if (it == object.constEnd())
                 continue;
 
-            const auto value = object.value(propertyName);
+            const auto value = it.value();
             if (value.isUndefined())
                 continue;
 
             if (value.isObject()) {
-                auto propertyValue = property.readOnGadget(gadget);
-                
-                if (propertyValue.canConvert<QMcpGadget>()) {
-                    auto *newGadget = reinterpret_cast<QMcpGadget *>(propertyValue.data());
-                    if (!newGadget->fromJsonObject(value.toObject(), protocolVersion))
+                if (property.kind == QMcpGadgetPlan::Kind::Gadget
+                        || property.kind == QMcpGadgetPlan::Kind::JsonObject) {
+                    if (!property.fromJson(property, gadget, value, protocolVersion))
                         return false;
-                    if (!property.writeOnGadget(gadget, propertyValue))
-                        qFatal() << gadget;
-                } else if (property.typeId() == QMetaType::QJsonObject) {
-                    property.writeOnGadget(gadget, value.toObject());
                 } else {
-                    qFatal() << propertyType << "not supporeted for" << mo->className() <<  propertyName << propertyValue;
+                    qFatal() << property.metaProperty.typeName() << "not supporeted for" << gadget->metaObject()->className() << property.key;
                 }
+            } else if (value.isArray() && property.kind == QMcpGadgetPlan::Kind::List) {
+                if (!property.fromJson(property, gadget, value, protocolVersion))
+                    return false;
             } else {
                 // Handle non-object properties
-                if (!property.writeOnGadget(gadget, value.toVariant()))
+                if (!property.metaProperty.writeOnGadget(gadget, value.toVariant()))
                     qFatal() << value;
             }
         }
@@ -128,4 +130,24 @@ QJsonObject QMcpAnyOf::toJsonObject(QtMcp::ProtocolVersion protocolVersion) cons
     return {};
 }
 
+void QMcpAnyOf::writeJson(QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion) const
+{
+    const auto mo = metaObject();
+    for (int i = 0; i < mo->propertyCount(); i++) {
+        const auto mp = mo->property(i);
+        if (refType() != mp.name())
+            continue;
+        auto value = mp.readOnGadget(this);
+        if (value.canConvert<QMcpGadget>()) {
+            const auto *gadget = reinterpret_cast<const QMcpGadget *>(value.constData());
+            gadget->writeJson(writer, protocolVersion);
+            return;
+        } else {
+            qFatal();
+        }
+    }
+    qWarning() << refType() << "not found";
+    writer.writeObject({});
+}
+
 QT_END_NAMESPACE
@@ -5,6 +5,7 @@
 #define QMCPANYOF_H
 
 #include <QtCore/QByteArray>
+#include <QtCore/QVariant>
 #include <QtMcpCommon/qmcpgadget.h>
 #include <QtMcpCommon/qtmcpnamespace.h>
 
@@ -40,13 +41,51 @@ protected:
         d<Private>()->refType = refType;
     }
 
+    // Returns the alternative stored as \a name, or a default constructed
+    // value if another alternative is active
+    template <typename T>
+    T alternative(const char *name) const {
+        const auto *p = d<Private>();
+        if (p->refType != name)
+            return T();
+        return p->alternative.value<T>();
+    }
+
+    template <typename T>
+    void setAlternative(const QByteArray &name, const T &value) {
+        if (refType() == name && alternative<T>(name.constData()) == value) return;
+        auto *p = d<Private>();
+        p->refType = name;
+        p->alternative = QVariant::fromValue(value);
+    }
+
 public:
     bool fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) override;
     QJsonObject toJsonObject(QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const override;
+    void writeJson(QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const override;
 
 protected:
     struct Private : public QMcpGadget::Private {
         QByteArray refType;
+        // only the active alternative is stored
+        QVariant alternative;
+
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && refType == that.refType
+                && alternative == that.alternative;
+        }
+
+        size_t hash(size_t seed) const override {
+            seed = qHashMulti(QMcpGadget::Private::hash(seed), refType);
+            // every alternative is a gadget
+            const auto *mo = alternative.metaType().metaObject();
+            if (mo && mo->inherits(&QMcpGadget::staticMetaObject))
+                seed = qHash(*static_cast<const QMcpGadget *>(alternative.constData()), seed);
+            return seed;
+        }
+
         Private *clone() const override { return new Private(*this); }
 
         virtual int findPropertyIndex(const QJsonObject &object) const {
@@ -8,6 +8,7 @@
 #include <QtCore/QByteArray>
 #include <QtMcpCommon/qmcpgadget.h>
 #include <QtMcpCommon/qmcpannotations.h>
+#include <QtMcpCommon/qmcpbase64.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -18,6 +19,8 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpAudioContent : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
+    Q_CLASSINFO("QMcpBase64:data", "true")
 
     /*!
         \property QMcpAudioContent::type
@@ -54,9 +57,25 @@ public:
         return d<Private>()->data;
     }
 
+    QByteArray decodedData() const {
+        return QMcpBase64::decode(data());
+    }
+
     void setData(const QByteArray &data) {
         if (this->data() == data) return;
         d<Private>()->data = data;
+        setModified(dataIndex());
+    }
+
+    void setData(QByteArray &&data) {
+        if (!isModified(dataIndex()) && this->data() == data) return;
+        d<Private>()->data = std::move(data);
+        setModified(dataIndex());
+    }
+
+    QByteArray takeData() {
+        clearModified(dataIndex());
+        return std::exchange(d<Private>()->data, QByteArray());
     }
 
     QString mimeType() const {
@@ -66,6 +85,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QMcpAnnotations annotations() const {
@@ -75,6 +106,18 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     const QMetaObject* metaObject() const override {
@@ -82,11 +125,36 @@ public:
     }
 
 private:
+    static int dataIndex() {
+        static const int index = staticMetaObject.indexOfProperty("data");
+        return index;
+    }
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QByteArray data;
         QString mimeType;
         QMcpAnnotations annotations;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && data == that.data
+                && mimeType == that.mimeType
+                && annotations == that.annotations;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), data, mimeType, annotations);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
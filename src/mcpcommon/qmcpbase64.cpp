@@ -0,0 +1,441 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpbase64.h"
+
+#include <QtCore/private/qsimd_p.h>
+
+#if defined(__ARM_NEON) && defined(Q_PROCESSOR_ARM_64)
+#include <arm_neon.h>
+#define QMCPBASE64_NEON
+#endif
+
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS(SSSE3)
+#define QMCPBASE64_SSSE3
+#endif
+
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS(AVX2)
+#define QMCPBASE64_AVX2
+#endif
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr uchar invalid = 0xff;
+
+struct DecodeTable
+{
+    constexpr DecodeTable()
+    {
+        for (auto &value : values)
+            value = invalid;
+        for (int i = 0; i < 64; i++)
+            values[uchar(alphabet[i])] = uchar(i);
+    }
+    uchar values[256] = {};
+};
+constexpr DecodeTable decodeTable;
+
+// The vectorized kernels below only handle whole blocks. They return the
+// number of input bytes consumed and leave the rest to the scalar code.
+// Decoding kernels stop before a block containing a character outside the
+// alphabet, so the scalar code reports the error.
+
+void encodeScalar(const uchar *in, qsizetype size, char *out)
+{
+    qsizetype i = 0;
+    for (; i + 3 <= size; i += 3) {
+        const uint triple = uint(in[i]) << 16 | uint(in[i + 1]) << 8 | in[i + 2];
+        *out++ = alphabet[triple >> 18];
+        *out++ = alphabet[(triple >> 12) & 0x3f];
+        *out++ = alphabet[(triple >> 6) & 0x3f];
+        *out++ = alphabet[triple & 0x3f];
+    }
+    if (size - i == 1) {
+        const uint triple = uint(in[i]) << 16;
+        *out++ = alphabet[triple >> 18];
+        *out++ = alphabet[(triple >> 12) & 0x3f];
+        *out++ = '=';
+        *out++ = '=';
+    } else if (size - i == 2) {
+        const uint triple = uint(in[i]) << 16 | uint(in[i + 1]) << 8;
+        *out++ = alphabet[triple >> 18];
+        *out++ = alphabet[(triple >> 12) & 0x3f];
+        *out++ = alphabet[(triple >> 6) & 0x3f];
+        *out++ = '=';
+    }
+}
+
+// decodes unpadded input; returns the number of bytes written or -1
+qsizetype decodeScalar(const uchar *in, qsizetype size, uchar *out)
+{
+    uchar *begin = out;
+    qsizetype i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const uint a = decodeTable.values[in[i]];
+        const uint b = decodeTable.values[in[i + 1]];
+        const uint c = decodeTable.values[in[i + 2]];
+        const uint d = decodeTable.values[in[i + 3]];
+        if ((a | b | c | d) & 0x80)
+            return -1;
+        const uint triple = a << 18 | b << 12 | c << 6 | d;
+        *out++ = uchar(triple >> 16);
+        *out++ = uchar(triple >> 8);
+        *out++ = uchar(triple);
+    }
+    const qsizetype rest = size - i;
+    if (rest == 1)
+        return -1;
+    if (rest > 1) {
+        const uint a = decodeTable.values[in[i]];
+        const uint b = decodeTable.values[in[i + 1]];
+        const uint c = rest == 3 ? decodeTable.values[in[i + 2]] : 0;
+        if ((a | b | c) & 0x80)
+            return -1;
+        const uint triple = a << 18 | b << 12 | c << 6;
+        *out++ = uchar(triple >> 16);
+        if (rest == 3)
+            *out++ = uchar(triple >> 8);
+    }
+    return out - begin;
+}
+
+#ifdef QMCPBASE64_SSSE3
+// Vector algorithms by Wojciech Muła, see http://0x80.pl/articles/index.html#base64-algorithm-new
+
+// spreads 12 bytes into 16 lanes of 6 bits each
+QT_FUNCTION_TARGET(SSSE3)
+inline __m128i encodeReshuffle(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+// maps 6-bit values to the alphabet by adding a per-range offset
+QT_FUNCTION_TARGET(SSSE3)
+inline __m128i encodeTranslate(__m128i in)
+{
+    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m128i indices = _mm_subs_epu8(in, _mm_set1_epi8(51));
+    indices = _mm_sub_epi8(indices, _mm_cmpgt_epi8(in, _mm_set1_epi8(25)));
+    return _mm_add_epi8(in, _mm_shuffle_epi8(offsets, indices));
+}
+
+// maps the alphabet to 6-bit values; returns false for other characters
+QT_FUNCTION_TARGET(SSSE3)
+inline bool decodeTranslate(__m128i *str)
+{
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2f);
+
+    const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(*str, 4), mask2F);
+    const __m128i loNibbles = _mm_and_si128(*str, mask2F);
+    const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+    const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())))
+        return false;
+    const __m128i eq2F = _mm_cmpeq_epi8(*str, mask2F);
+    const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+    *str = _mm_add_epi8(*str, roll);
+    return true;
+}
+
+// packs 16 lanes of 6 bits into the low 12 bytes
+QT_FUNCTION_TARGET(SSSE3)
+inline __m128i decodeReshuffle(__m128i in)
+{
+    const __m128i mergeAbAndBc = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+    const __m128i out = _mm_madd_epi16(mergeAbAndBc, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+// reads 16 bytes per 12 encoded
+QT_FUNCTION_TARGET(SSSE3)
+qsizetype encodeSsse3(const uchar *in, qsizetype size, char *out)
+{
+    qsizetype i = 0;
+    for (; i + 16 <= size; i += 12, out += 16) {
+        const __m128i str = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), encodeTranslate(encodeReshuffle(str)));
+    }
+    return i;
+}
+
+// writes 16 bytes per 12 decoded
+QT_FUNCTION_TARGET(SSSE3)
+qsizetype decodeSsse3(const uchar *in, qsizetype size, uchar *out)
+{
+    qsizetype i = 0;
+    for (; i + 16 <= size; i += 16, out += 12) {
+        __m128i str = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        if (!decodeTranslate(&str))
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), decodeReshuffle(str));
+    }
+    return i;
+}
+#endif // QMCPBASE64_SSSE3
+
+#ifdef QMCPBASE64_AVX2
+// the 256-bit versions of the SSSE3 helpers, working on each 128-bit lane
+QT_FUNCTION_TARGET(AVX2)
+inline __m256i encodeReshuffle(__m256i in)
+{
+    in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t1, t3);
+}
+
+QT_FUNCTION_TARGET(AVX2)
+inline __m256i encodeTranslate(__m256i in)
+{
+    const __m256i offsets = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m256i indices = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+    indices = _mm256_sub_epi8(indices, _mm256_cmpgt_epi8(in, _mm256_set1_epi8(25)));
+    return _mm256_add_epi8(in, _mm256_shuffle_epi8(offsets, indices));
+}
+
+QT_FUNCTION_TARGET(AVX2)
+inline bool decodeTranslate(__m256i *str)
+{
+    const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+                                           0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                           0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                             0, 0, 0, 0, 0, 0, 0, 0,
+                                             0, 16, 19, 4, -65, -65, -71, -71,
+                                             0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2f);
+
+    const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(*str, 4), mask2F);
+    const __m256i loNibbles = _mm256_and_si256(*str, mask2F);
+    const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+    const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+    if (!_mm256_testz_si256(lo, hi))
+        return false;
+    const __m256i eq2F = _mm256_cmpeq_epi8(*str, mask2F);
+    const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+    *str = _mm256_add_epi8(*str, roll);
+    return true;
+}
+
+// packs each lane into 12 bytes and moves them next to each other
+QT_FUNCTION_TARGET(AVX2)
+inline __m256i decodeReshuffle(__m256i in)
+{
+    const __m256i mergeAbAndBc = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+    __m256i out = _mm256_madd_epi16(mergeAbAndBc, _mm256_set1_epi32(0x00011000));
+    out = _mm256_shuffle_epi8(out, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+}
+
+// reads 28 bytes per 24 encoded
+QT_FUNCTION_TARGET(AVX2)
+qsizetype encodeAvx2(const uchar *in, qsizetype size, char *out)
+{
+    qsizetype i = 0;
+    for (; i + 28 <= size; i += 24, out += 32) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 12));
+        const __m256i str = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), encodeTranslate(encodeReshuffle(str)));
+    }
+    return i;
+}
+
+// writes 32 bytes per 24 decoded
+QT_FUNCTION_TARGET(AVX2)
+qsizetype decodeAvx2(const uchar *in, qsizetype size, uchar *out)
+{
+    qsizetype i = 0;
+    for (; i + 32 <= size; i += 32, out += 24) {
+        __m256i str = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        if (!decodeTranslate(&str))
+            break;
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), decodeReshuffle(str));
+    }
+    return i;
+}
+#endif // QMCPBASE64_AVX2
+
+#ifdef QMCPBASE64_NEON
+inline uint8x16x4_t loadTable(const uchar *table)
+{
+    return { vld1q_u8(table), vld1q_u8(table + 16), vld1q_u8(table + 32), vld1q_u8(table + 48) };
+}
+
+qsizetype encodeNeon(const uchar *in, qsizetype size, char *out)
+{
+    const uint8x16x4_t table = loadTable(reinterpret_cast<const uchar *>(alphabet));
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+    qsizetype i = 0;
+    for (; i + 48 <= size; i += 48, out += 64) {
+        const uint8x16x3_t str = vld3q_u8(in + i);
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(str.val[0], 2);
+        indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(str.val[0], 4), vshrq_n_u8(str.val[1], 4)), mask);
+        indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(str.val[1], 2), vshrq_n_u8(str.val[2], 6)), mask);
+        indices.val[3] = vandq_u8(str.val[2], mask);
+        uint8x16x4_t chars;
+        for (int j = 0; j < 4; j++)
+            chars.val[j] = vqtbl4q_u8(table, indices.val[j]);
+        vst4q_u8(reinterpret_cast<uchar *>(out), chars);
+    }
+    return i;
+}
+
+qsizetype decodeNeon(const uchar *in, qsizetype size, uchar *out)
+{
+    // the ASCII range is looked up in two halves of 64 entries
+    const uint8x16x4_t tableLo = loadTable(decodeTable.values);
+    const uint8x16x4_t tableHi = loadTable(decodeTable.values + 64);
+    const uint8x16_t high = vdupq_n_u8(0x40);
+    qsizetype i = 0;
+    for (; i + 64 <= size; i += 64, out += 48) {
+        const uint8x16x4_t str = vld4q_u8(in + i);
+        uint8x16x4_t values;
+        uint8x16_t errors = vdupq_n_u8(0);
+        for (int j = 0; j < 4; j++) {
+            values.val[j] = vorrq_u8(vqtbl4q_u8(tableLo, str.val[j]),
+                                     vqtbl4q_u8(tableHi, veorq_u8(str.val[j], high)));
+            errors = vorrq_u8(errors, vorrq_u8(values.val[j], vandq_u8(str.val[j], vdupq_n_u8(0x80))));
+        }
+        if (vmaxvq_u8(errors) >= 0x40)
+            break;
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(out, bytes);
+    }
+    return i;
+}
+#endif // QMCPBASE64_NEON
+
+// consumes as much of the input as the vector units allow
+qsizetype encodeVector(const uchar *in, qsizetype size, char *out)
+{
+    qsizetype done = 0;
+#ifdef QMCPBASE64_AVX2
+    if (qCpuHasFeature(AVX2))
+        done += encodeAvx2(in, size, out);
+#endif
+#ifdef QMCPBASE64_SSSE3
+    if (qCpuHasFeature(SSSE3))
+        done += encodeSsse3(in + done, size - done, out + done / 3 * 4);
+#endif
+#ifdef QMCPBASE64_NEON
+    done += encodeNeon(in, size, out);
+#endif
+    Q_UNUSED(in);
+    Q_UNUSED(size);
+    Q_UNUSED(out);
+    return done;
+}
+
+qsizetype decodeVector(const uchar *in, qsizetype size, uchar *out)
+{
+    qsizetype done = 0;
+#ifdef QMCPBASE64_AVX2
+    if (qCpuHasFeature(AVX2))
+        done += decodeAvx2(in, size, out);
+#endif
+#ifdef QMCPBASE64_SSSE3
+    if (qCpuHasFeature(SSSE3))
+        done += decodeSsse3(in + done, size - done, out + done / 4 * 3);
+#endif
+#ifdef QMCPBASE64_NEON
+    done += decodeNeon(in, size, out);
+#endif
+    Q_UNUSED(in);
+    Q_UNUSED(size);
+    Q_UNUSED(out);
+    return done;
+}
+
+// the vector decoders store whole registers past the last decoded byte
+constexpr qsizetype decodeSlack = 32;
+}
+
+/*!
+    Returns \a data encoded as base64.
+*/
+QByteArray QMcpBase64::encode(QByteArrayView data)
+{
+    QByteArray out;
+    encode(data, &out);
+    return out;
+}
+
+/*!
+    Appends \a data encoded as base64 to \a out.
+*/
+void QMcpBase64::encode(QByteArrayView data, QByteArray *out)
+{
+    Q_ASSERT(out);
+    const qsizetype offset = out->size();
+    out->resize(offset + encodedSize(data.size()));
+    const auto *in = reinterpret_cast<const uchar *>(data.data());
+    char *dest = out->data() + offset;
+
+    const qsizetype done = encodeVector(in, data.size(), dest);
+    encodeScalar(in + done, data.size() - done, dest + done / 3 * 4);
+}
+
+/*!
+    Returns the binary data encoded in \a base64.
+
+    If \a base64 is not valid base64, an empty byte array is returned and
+    \a ok, if not null, is set to \c false.
+*/
+QByteArray QMcpBase64::decode(QByteArrayView base64, bool *ok)
+{
+    if (ok)
+        *ok = false;
+
+    qsizetype size = base64.size();
+    qsizetype padding = 0;
+    while (padding < 2 && size > 0 && base64.at(size - 1) == '=') {
+        size--;
+        padding++;
+    }
+    if ((padding > 0 && base64.size() % 4 != 0) || size % 4 == 1)
+        return QByteArray();
+
+    QByteArray out(size / 4 * 3 + 2 + decodeSlack, Qt::Uninitialized);
+    const auto *in = reinterpret_cast<const uchar *>(base64.data());
+    auto *dest = reinterpret_cast<uchar *>(out.data());
+
+    const qsizetype done = decodeVector(in, size, dest);
+    const qsizetype written = decodeScalar(in + done, size - done, dest + done / 4 * 3);
+    if (written < 0)
+        return QByteArray();
+
+    out.truncate(done / 4 * 3 + written);
+    if (ok)
+        *ok = true;
+    return out;
+}
+
+QT_END_NAMESPACE
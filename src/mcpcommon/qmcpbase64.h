@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPBASE64_H
+#define QMCPBASE64_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpBase64
+    \inmodule QtMcpCommon
+    \brief Encodes and decodes the base64 payload of binary content.
+
+    Image, audio and blob resource content carry their payload as base64
+    text. QMcpBase64 converts between the binary and the text form using
+    vectorized code paths (SSSE3 or AVX2 on x86, NEON on AArch64) selected
+    at runtime, with a scalar fallback on other CPUs.
+
+    The output is identical to QByteArray::toBase64() with the default
+    options. decode() accepts input with or without padding and rejects
+    anything outside the base64 alphabet, like
+    QByteArray::fromBase64Encoding() with
+    QByteArray::AbortOnBase64DecodingErrors.
+*/
+class Q_MCPCOMMON_EXPORT QMcpBase64
+{
+public:
+    static constexpr qsizetype encodedSize(qsizetype size) { return (size + 2) / 3 * 4; }
+
+    static QByteArray encode(QByteArrayView data);
+    static void encode(QByteArrayView data, QByteArray *out);
+    static QByteArray decode(QByteArrayView base64, bool *ok = nullptr);
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPBASE64_H
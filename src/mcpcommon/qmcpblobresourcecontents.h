@@ -7,6 +7,7 @@
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 #include <QtCore/QUrl>
+#include <QtMcpCommon/qmcpbase64.h>
 #include <QtMcpCommon/qmcpgadget.h>
 #include <QtMcpCommon/qmcpresource.h>
 
@@ -18,6 +19,8 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpBlobResourceContents : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
+    Q_CLASSINFO("QMcpBase64:blob", "true")
 
     /*!
         \property QMcpBlobResourceContents::blob
@@ -44,19 +47,35 @@ public:
     QMcpBlobResourceContents(const QMcpResource &resource, const QByteArray &blob)
         : QMcpGadget(new Private)
     {
-        d<Private>()->mimeType = resource.mimeType();
-        d<Private>()->blob = blob;
-        d<Private>()->uri = resource.uri();
-        d<Private>()->name = resource.name();
+        setMimeType(resource.mimeType());
+        setBlob(blob);
+        setUri(resource.uri());
+        setName(resource.name());
     }
 
     QByteArray blob() const {
         return d<Private>()->blob;
     }
 
+    QByteArray decodedBlob() const {
+        return QMcpBase64::decode(blob());
+    }
+
     void setBlob(const QByteArray &blob) {
         if (this->blob() == blob) return;
         d<Private>()->blob = blob;
+        setModified(blobIndex());
+    }
+
+    void setBlob(QByteArray &&blob) {
+        if (!isModified(blobIndex()) && this->blob() == blob) return;
+        d<Private>()->blob = std::move(blob);
+        setModified(blobIndex());
+    }
+
+    QByteArray takeBlob() {
+        clearModified(blobIndex());
+        return std::exchange(d<Private>()->blob, QByteArray());
     }
 
     QString mimeType() const {
@@ -66,6 +85,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QUrl uri() const {
@@ -75,6 +106,18 @@ public:
     void setUri(const QUrl &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QUrl &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QUrl takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QUrl());
     }
 
     QString name() const {
@@ -84,6 +127,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -91,6 +146,23 @@ public:
     }
 
 private:
+    static int blobIndex() {
+        static const int index = staticMetaObject.indexOfProperty("blob");
+        return index;
+    }
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
     public:
         QByteArray blob;
@@ -98,6 +170,19 @@ private:
         QUrl uri;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && blob == that.blob
+                && mimeType == that.mimeType
+                && uri == that.uri
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), blob, mimeType, uri, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPBUILDER_H
+#define QMCPBUILDER_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+
+#include <type_traits>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpBuilder
+    \inmodule QtMcpCommon
+    \brief Builds a gadget by moving values into it.
+
+    QMcpBuilder chains the rvalue setters, append mutators and take
+    accessors of a gadget, so a result is constructed without copying or
+    comparing values:
+
+    \code
+    auto tool = QMcpBuilder<QMcpTool>()
+        .set(&QMcpTool::setName, u"echo"_s)
+        .edit(&QMcpTool::takeInputSchema, &QMcpTool::setInputSchema, [](QMcpToolInputSchema &schema) {
+            schema.appendRequired(u"text"_s);
+        })
+        .build();
+    \endcode
+
+    set() picks the rvalue overload of a setter when there is one, and the
+    only overload otherwise. The builder holds the only reference to the
+    gadget, so nothing is detached while it is built.
+*/
+template <typename T>
+class QMcpBuilder
+{
+    // keeps an argument out of the deduction of the setter's parameter type
+    template <typename U>
+    using NonDeduced = std::enable_if_t<true, U>;
+
+public:
+    QMcpBuilder() = default;
+    explicit QMcpBuilder(T gadget)
+        : gadget(std::move(gadget))
+    {}
+
+    /*!
+        Moves \a value into the gadget with \a setter, a setter or an
+        append mutator taking an rvalue.
+    */
+    template <typename Class, typename Value>
+    QMcpBuilder &set(void (Class::*setter)(Value &&), NonDeduced<Value> &&value) {
+        static_assert(std::is_base_of_v<Class, T>);
+        (gadget.*setter)(std::move(value));
+        return *this;
+    }
+
+    /*!
+        Passes \a value to \a setter, which has a single overload.
+    */
+    template <typename Class, typename Value>
+    QMcpBuilder &set(void (Class::*setter)(Value), NonDeduced<Value> value) {
+        static_assert(std::is_base_of_v<Class, T>);
+        (gadget.*setter)(std::forward<Value>(value));
+        return *this;
+    }
+
+    /*!
+        Takes a nested gadget out with \a take, passes it to \a edit and
+        moves it back with \a setter.
+    */
+    template <typename Class, typename Value, typename Edit>
+    QMcpBuilder &edit(Value (Class::*take)(), void (Class::*setter)(Value &&), Edit &&edit) {
+        static_assert(std::is_base_of_v<Class, T>);
+        auto value = (gadget.*take)();
+        std::forward<Edit>(edit)(value);
+        (gadget.*setter)(std::move(value));
+        return *this;
+    }
+
+    /*!
+        Moves the gadget out of the builder.
+    */
+    T build() {
+        return std::move(gadget);
+    }
+
+private:
+    T gadget;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPBUILDER_H
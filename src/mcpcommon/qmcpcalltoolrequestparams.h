@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCallToolRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QJsonObject arguments READ arguments WRITE setArguments)
     Q_PROPERTY(QString name READ name WRITE setName REQUIRED)
@@ -30,6 +31,18 @@ public:
     void setArguments(const QJsonObject &arguments) {
         if (this->arguments() == arguments) return;
         d<Private>()->arguments = arguments;
+        setModified(argumentsIndex());
+    }
+
+    void setArguments(QJsonObject &&arguments) {
+        if (!isModified(argumentsIndex()) && this->arguments() == arguments) return;
+        d<Private>()->arguments = std::move(arguments);
+        setModified(argumentsIndex());
+    }
+
+    QJsonObject takeArguments() {
+        clearModified(argumentsIndex());
+        return std::exchange(d<Private>()->arguments, QJsonObject());
     }
 
     QString name() const {
@@ -39,6 +52,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -46,11 +71,31 @@ public:
     }
 
 private:
+    static int argumentsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("arguments");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
     public:
         QJsonObject arguments;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && arguments == that.arguments
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), arguments, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPCALLTOOLREQUESTPARAMSVIEW_H
+#define QMCPCALLTOOLREQUESTPARAMSVIEW_H
+
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpcalltoolrequestparams.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpCallToolRequestParamsView
+    \inmodule QtMcpCommon
+    \brief Read-only view over the JSON of a \l QMcpCallToolRequestParams.
+*/
+class QMcpCallToolRequestParamsView : public QMcpJsonView
+{
+public:
+    using Gadget = QMcpCallToolRequestParams;
+    using QMcpJsonView::QMcpJsonView;
+
+    QJsonObject arguments() const {
+        return object("arguments"_L1);
+    }
+
+    QString name() const {
+        return string("name"_L1);
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPCALLTOOLREQUESTPARAMSVIEW_H
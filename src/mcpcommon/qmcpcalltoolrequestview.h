@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPCALLTOOLREQUESTVIEW_H
+#define QMCPCALLTOOLREQUESTVIEW_H
+
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpcalltoolrequest.h>
+#include <QtMcpCommon/qmcpcalltoolrequestparamsview.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpCallToolRequestView
+    \inmodule QtMcpCommon
+    \brief Read-only view over the JSON of a \l QMcpCallToolRequest.
+*/
+class QMcpCallToolRequestView : public QMcpJsonRequestView<QMcpCallToolRequestParamsView>
+{
+public:
+    using Gadget = QMcpCallToolRequest;
+    using QMcpJsonRequestView::QMcpJsonRequestView;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPCALLTOOLREQUESTVIEW_H
@@ -26,6 +26,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCallToolResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QList<QMcpCallToolResultContent> content READ content WRITE setContent REQUIRED)
     /*!
@@ -50,6 +51,34 @@ public:
     void setContent(const QList<QMcpCallToolResultContent> &content) {
         if (this->content() == content) return;
         d<Private>()->content = content;
+        setModified(contentIndex());
+    }
+
+    void setContent(QList<QMcpCallToolResultContent> &&content) {
+        if (!isModified(contentIndex()) && this->content() == content) return;
+        d<Private>()->content = std::move(content);
+        setModified(contentIndex());
+    }
+
+    QList<QMcpCallToolResultContent> takeContent() {
+        clearModified(contentIndex());
+        return std::exchange(d<Private>()->content, QList<QMcpCallToolResultContent>());
+    }
+
+    void appendContent(const QMcpCallToolResultContent &value) {
+        d<Private>()->content.append(value);
+        setModified(contentIndex());
+    }
+
+    void appendContent(QMcpCallToolResultContent &&value) {
+        d<Private>()->content.append(std::move(value));
+        setModified(contentIndex());
+    }
+
+    template <typename... Args>
+    QMcpCallToolResultContent &emplaceContent(Args &&...args) {
+        setModified(contentIndex());
+        return d<Private>()->content.emplaceBack(std::forward<Args>(args)...);
     }
 
     bool isError() const {
@@ -59,6 +88,7 @@ public:
     void setIsError(bool isError) {
         if (this->isError() == isError) return;
         d<Private>()->isError = isError;
+        setModified(isErrorIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -66,10 +96,30 @@ public:
     }
 
 private:
+    static int contentIndex() {
+        static const int index = staticMetaObject.indexOfProperty("content");
+        return index;
+    }
+    static int isErrorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("isError");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QList<QMcpCallToolResultContent> content;
         bool isError = false;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && content == that.content
+                && isError == that.isError;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), content, isError);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
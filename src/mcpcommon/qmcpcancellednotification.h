@@ -22,6 +22,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCancelledNotification : public QMcpNotification
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpCancelledNotificationParams params READ params WRITE setParams REQUIRED)
 
@@ -39,6 +40,18 @@ public:
     void setParams(const QMcpCancelledNotificationParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpCancelledNotificationParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpCancelledNotificationParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpCancelledNotificationParams());
     }
 
     const QMetaObject* metaObject() const override {
@@ -46,9 +59,24 @@ public:
     }
 
 private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
     struct Private : public QMcpNotification::Private {
         QMcpCancelledNotificationParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotification::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotification::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
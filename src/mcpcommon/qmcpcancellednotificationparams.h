@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCancelledNotificationParams : public QMcpNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpCancelledNotificationParams::reason
@@ -41,6 +42,18 @@ public:
     void setReason(const QString &reason) {
         if (this->reason() == reason) return;
         d<Private>()->reason = reason;
+        setModified(reasonIndex());
+    }
+
+    void setReason(QString &&reason) {
+        if (!isModified(reasonIndex()) && this->reason() == reason) return;
+        d<Private>()->reason = std::move(reason);
+        setModified(reasonIndex());
+    }
+
+    QString takeReason() {
+        clearModified(reasonIndex());
+        return std::exchange(d<Private>()->reason, QString());
     }
 
     QMcpRequestId requestId() const {
@@ -50,6 +63,18 @@ public:
     void setRequestId(const QMcpRequestId &requestId) {
         if (this->requestId() == requestId) return;
         d<Private>()->requestId = requestId;
+        setModified(requestIdIndex());
+    }
+
+    void setRequestId(QMcpRequestId &&requestId) {
+        if (!isModified(requestIdIndex()) && this->requestId() == requestId) return;
+        d<Private>()->requestId = std::move(requestId);
+        setModified(requestIdIndex());
+    }
+
+    QMcpRequestId takeRequestId() {
+        clearModified(requestIdIndex());
+        return std::exchange(d<Private>()->requestId, QMcpRequestId());
     }
 
     const QMetaObject* metaObject() const override {
@@ -57,10 +82,30 @@ public:
     }
 
 private:
+    static int reasonIndex() {
+        static const int index = staticMetaObject.indexOfProperty("reason");
+        return index;
+    }
+    static int requestIdIndex() {
+        static const int index = staticMetaObject.indexOfProperty("requestId");
+        return index;
+    }
+
     struct Private : public QMcpNotificationParams::Private {
         QString reason;
         QMcpRequestId requestId;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotificationParams::Private::equals(other)
+                && reason == that.reason
+                && requestId == that.requestId;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotificationParams::Private::hash(seed), reason);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,232 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpcbor.h"
+#include "qmcpbase64.h"
+
+#include <QtCore/qcborstreamreader.h>
+#include <QtCore/qdebug.h>
+#include <QtCore/qjsonarray.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// deeper nesting is rejected rather than risking the stack
+constexpr int maxDepth = 256;
+
+QJsonValue readValue(QCborStreamReader &reader, int depth);
+
+QString readText(QCborStreamReader &reader)
+{
+    QString text;
+    auto chunk = reader.readString();
+    while (chunk.status == QCborStreamReader::Ok) {
+        text += chunk.data;
+        chunk = reader.readString();
+    }
+    return chunk.status == QCborStreamReader::EndOfString ? text : QString();
+}
+
+QByteArray readBytes(QCborStreamReader &reader)
+{
+    QByteArray bytes;
+    auto chunk = reader.readByteArray();
+    while (chunk.status == QCborStreamReader::Ok) {
+        bytes += chunk.data;
+        chunk = reader.readByteArray();
+    }
+    return chunk.status == QCborStreamReader::EndOfString ? bytes : QByteArray();
+}
+
+QJsonObject readMap(QCborStreamReader &reader, int depth)
+{
+    QJsonObject object;
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        // JSON only knows text keys
+        if (!reader.isString()) {
+            reader.skipToNext();
+            reader.skipToNext();
+            continue;
+        }
+        const auto key = readText(reader);
+        object.insert(key, readValue(reader, depth + 1));
+    }
+    if (reader.lastError() == QCborError::NoError)
+        reader.leaveContainer();
+    return object;
+}
+
+QJsonArray readArray(QCborStreamReader &reader, int depth)
+{
+    QJsonArray array;
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext())
+        array.append(readValue(reader, depth + 1));
+    if (reader.lastError() == QCborError::NoError)
+        reader.leaveContainer();
+    return array;
+}
+
+QJsonValue readValue(QCborStreamReader &reader, int depth)
+{
+    if (depth > maxDepth) {
+        reader.skipToNext();
+        return QJsonValue();
+    }
+
+    switch (reader.type()) {
+    case QCborStreamReader::UnsignedInteger: {
+        const auto value = reader.toUnsignedInteger();
+        reader.next();
+        return value <= quint64(std::numeric_limits<qint64>::max()) ? QJsonValue(qint64(value)) : QJsonValue(double(value));
+    }
+    case QCborStreamReader::NegativeInteger: {
+        // the magnitude of the value, 0 standing for 2^64
+        const auto magnitude = quint64(reader.toNegativeInteger());
+        reader.next();
+        if (magnitude != 0 && magnitude <= quint64(1) << 63)
+            return qint64(~magnitude + 1);
+        return magnitude ? -double(magnitude) : -18446744073709551616.0;
+    }
+    case QCborStreamReader::ByteArray:
+        // binary data is base64 text in JSON
+        return QString::fromLatin1(QMcpBase64::encode(readBytes(reader)));
+    case QCborStreamReader::String:
+        return readText(reader);
+    case QCborStreamReader::Array:
+        return readArray(reader, depth);
+    case QCborStreamReader::Map:
+        return readMap(reader, depth);
+    case QCborStreamReader::Tag:
+        // tags carry no meaning for MCP, the tagged value is read as is
+        reader.next();
+        return readValue(reader, depth);
+    case QCborStreamReader::SimpleType: {
+        const auto type = reader.toSimpleType();
+        reader.next();
+        switch (type) {
+        case QCborSimpleType::False:
+            return false;
+        case QCborSimpleType::True:
+            return true;
+        default:
+            return QJsonValue();
+        }
+    }
+    case QCborStreamReader::Float16: {
+        const auto value = reader.toFloat16();
+        reader.next();
+        return double(value);
+    }
+    case QCborStreamReader::Float: {
+        const auto value = reader.toFloat();
+        reader.next();
+        return double(value);
+    }
+    case QCborStreamReader::Double: {
+        const auto value = reader.toDouble();
+        reader.next();
+        return value;
+    }
+    default:
+        break;
+    }
+    reader.next();
+    return QJsonValue();
+}
+}
+
+/*!
+    Returns the name of the experimental capability announcing the CBOR
+    encoding.
+*/
+QLatin1StringView QMcpCbor::capability()
+{
+    return "qtmcp/cbor"_L1;
+}
+
+/*!
+    Returns \c true if \a data starts with a CBOR message.
+*/
+bool QMcpCbor::isCbor(QByteArrayView data)
+{
+    // major type 5, a map
+    return !data.isEmpty() && (uchar(data.front()) & 0xe0) == 0xa0;
+}
+
+/*!
+    Returns the size of the CBOR message at the start of \a data, skipping
+    over its items without decoding them.
+
+    Returns 0 if \a data does not hold a complete message yet, and -1 if it
+    is not valid CBOR or not a map.
+*/
+qsizetype QMcpCbor::messageSize(QByteArrayView data)
+{
+    if (data.isEmpty())
+        return 0;
+
+    QCborStreamReader reader(data.data(), data.size());
+    if (!reader.isMap()) {
+        qWarning() << "CBOR message is not a map";
+        return -1;
+    }
+    reader.next(maxDepth);
+    const auto error = reader.lastError();
+    if (error == QCborError::EndOfFile)
+        return 0;
+    if (error != QCborError::NoError) {
+        qWarning() << "CBOR parse error:" << error.toString();
+        return -1;
+    }
+    return qsizetype(reader.currentOffset());
+}
+
+/*!
+    Reads the CBOR message at the start of \a data into \a message and
+    returns the number of bytes it took.
+
+    Returns 0 if \a data does not hold a complete message yet, and -1 if it
+    is not valid CBOR or not a map. In that case the rest of the stream can
+    not be read reliably anymore.
+*/
+qsizetype QMcpCbor::read(QByteArrayView data, QJsonObject *message)
+{
+    Q_ASSERT(message);
+    if (data.isEmpty())
+        return 0;
+
+    QCborStreamReader reader(data.data(), data.size());
+    if (!reader.isMap()) {
+        qWarning() << "CBOR message is not a map";
+        return -1;
+    }
+    auto object = readMap(reader, 0);
+    const auto error = reader.lastError();
+    if (error == QCborError::EndOfFile)
+        return 0;
+    if (error != QCborError::NoError) {
+        qWarning() << "CBOR parse error:" << error.toString();
+        return -1;
+    }
+    *message = std::move(object);
+    return qsizetype(reader.currentOffset());
+}
+
+/*!
+    Returns the CBOR message in \a data as a JSON object. If \a ok is not
+    null, it is set to whether \a data held exactly one complete message.
+*/
+QJsonObject QMcpCbor::toJsonObject(QByteArrayView data, bool *ok)
+{
+    QJsonObject message;
+    const auto size = read(data, &message);
+    if (ok)
+        *ok = size == data.size();
+    return message;
+}
+
+QT_END_NAMESPACE
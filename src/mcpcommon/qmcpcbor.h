@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPCBOR_H
+#define QMCPCBOR_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qjsonobject.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpCbor
+    \inmodule QtMcpCommon
+    \brief Reads and detects MCP messages encoded as CBOR.
+
+    When both ends of a connection use QtMcp, they can exchange the messages
+    as CBOR instead of JSON text. The encoding is negotiated during
+    initialization: a client that allows it lists capability() in the
+    experimental capabilities of its initialize request, and a server that
+    allows it answers with the same entry in its own experimental
+    capabilities. The client switches once it has received the result, the
+    server once it has received the initialized notification. If either
+    side does not advertise it, both keep using JSON.
+
+    A CBOR message is a map holding the same members as the JSON message.
+    Binary data, such as the blob of a resource or the data of image and
+    audio content, is a byte string instead of base64 text. Messages are
+    written with QMcpJsonWriter in QtMcp::Encoding::Cbor and read back into
+    a QJsonObject with read(), which turns byte strings into base64 text.
+
+    A CBOR message always starts with a byte between 0xa0 and 0xbf, while a
+    JSON message starts with a brace or whitespace. Backends use isCbor() to
+    tell the two apart on a stream carrying both, and need no framing for
+    CBOR since every message tells where it ends; messageSize() finds the
+    end without decoding the message.
+*/
+class Q_MCPCOMMON_EXPORT QMcpCbor
+{
+public:
+    static QLatin1StringView capability();
+
+    static bool isCbor(QByteArrayView data);
+    static qsizetype messageSize(QByteArrayView data);
+    static qsizetype read(QByteArrayView data, QJsonObject *message);
+    static QJsonObject toJsonObject(QByteArrayView data, bool *ok = nullptr);
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPCBOR_H
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpClientCapabilities : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpClientCapabilities::experimental
@@ -47,6 +48,18 @@ public:
     void setExperimental(const QMcpClientCapabilitiesExperimental &experimental) {
         if (this->experimental() == experimental) return;
         d<Private>()->experimental = experimental;
+        setModified(experimentalIndex());
+    }
+
+    void setExperimental(QMcpClientCapabilitiesExperimental &&experimental) {
+        if (!isModified(experimentalIndex()) && this->experimental() == experimental) return;
+        d<Private>()->experimental = std::move(experimental);
+        setModified(experimentalIndex());
+    }
+
+    QMcpClientCapabilitiesExperimental takeExperimental() {
+        clearModified(experimentalIndex());
+        return std::exchange(d<Private>()->experimental, QMcpClientCapabilitiesExperimental());
     }
 
     QMcpClientCapabilitiesRoots roots() const {
@@ -56,6 +69,18 @@ public:
     void setRoots(const QMcpClientCapabilitiesRoots &roots) {
         if (this->roots() == roots) return;
         d<Private>()->roots = roots;
+        setModified(rootsIndex());
+    }
+
+    void setRoots(QMcpClientCapabilitiesRoots &&roots) {
+        if (!isModified(rootsIndex()) && this->roots() == roots) return;
+        d<Private>()->roots = std::move(roots);
+        setModified(rootsIndex());
+    }
+
+    QMcpClientCapabilitiesRoots takeRoots() {
+        clearModified(rootsIndex());
+        return std::exchange(d<Private>()->roots, QMcpClientCapabilitiesRoots());
     }
 
     QMcpClientCapabilitiesSampling sampling() const {
@@ -65,6 +90,18 @@ public:
     void setSampling(const QMcpClientCapabilitiesSampling &sampling) {
         if (this->sampling() == sampling) return;
         d<Private>()->sampling = sampling;
+        setModified(samplingIndex());
+    }
+
+    void setSampling(QMcpClientCapabilitiesSampling &&sampling) {
+        if (!isModified(samplingIndex()) && this->sampling() == sampling) return;
+        d<Private>()->sampling = std::move(sampling);
+        setModified(samplingIndex());
+    }
+
+    QMcpClientCapabilitiesSampling takeSampling() {
+        clearModified(samplingIndex());
+        return std::exchange(d<Private>()->sampling, QMcpClientCapabilitiesSampling());
     }
 
     const QMetaObject* metaObject() const override {
@@ -72,11 +109,36 @@ public:
     }
 
 private:
+    static int experimentalIndex() {
+        static const int index = staticMetaObject.indexOfProperty("experimental");
+        return index;
+    }
+    static int rootsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("roots");
+        return index;
+    }
+    static int samplingIndex() {
+        static const int index = staticMetaObject.indexOfProperty("sampling");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpClientCapabilitiesExperimental experimental;
         QMcpClientCapabilitiesRoots roots;
         QMcpClientCapabilitiesSampling sampling;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && experimental == that.experimental
+                && roots == that.roots
+                && sampling == that.sampling;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), experimental, roots, sampling);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpClientCapabilitiesExperimental : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QJsonObject additionalProperties READ additionalProperties WRITE setAdditionalProperties)
 
@@ -29,6 +30,18 @@ public:
     void setAdditionalProperties(const QJsonObject &props) {
         if (this->additionalProperties() == props) return;
         d<Private>()->additionalProperties = props;
+        setModified(additionalPropertiesIndex());
+    }
+
+    void setAdditionalProperties(QJsonObject &&props) {
+        if (!isModified(additionalPropertiesIndex()) && this->additionalProperties() == props) return;
+        d<Private>()->additionalProperties = std::move(props);
+        setModified(additionalPropertiesIndex());
+    }
+
+    QJsonObject takeAdditionalProperties() {
+        clearModified(additionalPropertiesIndex());
+        return std::exchange(d<Private>()->additionalProperties, QJsonObject());
     }
 
     const QMetaObject* metaObject() const override {
@@ -36,9 +49,24 @@ public:
     }
 
 private:
+    static int additionalPropertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("additionalProperties");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QJsonObject additionalProperties;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && additionalProperties == that.additionalProperties;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), additionalProperties);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpClientCapabilitiesRoots : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpClientCapabilitiesRoots::listChanged
@@ -34,6 +35,7 @@ public:
     void setListChanged(bool changed) {
         if (this->listChanged() == changed) return;
         d<Private>()->listChanged = changed;
+        setModified(listChangedIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -41,9 +43,24 @@ public:
     }
 
 private:
+    static int listChangedIndex() {
+        static const int index = staticMetaObject.indexOfProperty("listChanged");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         bool listChanged = false;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && listChanged == that.listChanged;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), listChanged);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -26,52 +26,39 @@ public:
     QMcpClientNotification() : QMcpAnyOf(new Private) {}
 
     QMcpCancelledNotification cancelledNotification() const {
-        return d<Private>()->cancelledNotification;
+        return alternative<QMcpCancelledNotification>("cancelledNotification");
     }
 
     void setCancelledNotification(const QMcpCancelledNotification &cancelledNotification) {
-        if (this->cancelledNotification() == cancelledNotification) return;
-        setRefType("cancelledNotification"_ba);
-        d<Private>()->cancelledNotification = cancelledNotification;
+        setAlternative("cancelledNotification"_ba, cancelledNotification);
     }
 
     QMcpInitializedNotification initializedNotification() const {
-        return d<Private>()->initializedNotification;
+        return alternative<QMcpInitializedNotification>("initializedNotification");
     }
 
     void setInitializedNotification(const QMcpInitializedNotification &initializedNotification) {
-        if (this->initializedNotification() == initializedNotification) return;
-        setRefType("initializedNotification"_ba);
-        d<Private>()->initializedNotification = initializedNotification;
+        setAlternative("initializedNotification"_ba, initializedNotification);
     }
 
     QMcpProgressNotification progressNotification() const {
-        return d<Private>()->progressNotification;
+        return alternative<QMcpProgressNotification>("progressNotification");
     }
 
     void setProgressNotification(const QMcpProgressNotification &progressNotification) {
-        if (this->progressNotification() == progressNotification) return;
-        setRefType("progressNotification"_ba);
-        d<Private>()->progressNotification = progressNotification;
+        setAlternative("progressNotification"_ba, progressNotification);
     }
 
     QMcpRootsListChangedNotification rootsListChangedNotification() const {
-        return d<Private>()->rootsListChangedNotification;
+        return alternative<QMcpRootsListChangedNotification>("rootsListChangedNotification");
     }
 
     void setRootsListChangedNotification(const QMcpRootsListChangedNotification &rootsListChangedNotification) {
-        if (this->rootsListChangedNotification() == rootsListChangedNotification) return;
-        setRefType("rootsListChangedNotification"_ba);
-        d<Private>()->rootsListChangedNotification = rootsListChangedNotification;
+        setAlternative("rootsListChangedNotification"_ba, rootsListChangedNotification);
     }
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpCancelledNotification cancelledNotification;
-        QMcpInitializedNotification initializedNotification;
-        QMcpProgressNotification progressNotification;
-        QMcpRootsListChangedNotification rootsListChangedNotification;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
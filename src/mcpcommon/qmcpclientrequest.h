@@ -46,151 +46,111 @@ public:
     }
 
     QMcpInitializeRequest initializeRequest() const {
-        return d<Private>()->initializeRequest;
+        return alternative<QMcpInitializeRequest>("initializeRequest");
     }
 
     void setInitializeRequest(const QMcpInitializeRequest &initializeRequest) {
-        if (this->initializeRequest() == initializeRequest) return;
-        setRefType("initializeRequest"_ba);
-        d<Private>()->initializeRequest = initializeRequest;
+        setAlternative("initializeRequest"_ba, initializeRequest);
     }
 
     QMcpPingRequest pingRequest() const {
-        return d<Private>()->pingRequest;
+        return alternative<QMcpPingRequest>("pingRequest");
     }
 
     void setPingRequest(const QMcpPingRequest &pingRequest) {
-        if (this->pingRequest() == pingRequest) return;
-        setRefType("pingRequest"_ba);
-        d<Private>()->pingRequest = pingRequest;
+        setAlternative("pingRequest"_ba, pingRequest);
     }
 
     QMcpListResourcesRequest listResourcesRequest() const {
-        return d<Private>()->listResourcesRequest;
+        return alternative<QMcpListResourcesRequest>("listResourcesRequest");
     }
 
     void setListResourcesRequest(const QMcpListResourcesRequest &listResourcesRequest) {
-        if (this->listResourcesRequest() == listResourcesRequest) return;
-        setRefType("listResourcesRequest"_ba);
-        d<Private>()->listResourcesRequest = listResourcesRequest;
+        setAlternative("listResourcesRequest"_ba, listResourcesRequest);
     }
 
     QMcpListResourceTemplatesRequest listResourceTemplatesRequest() const {
-        return d<Private>()->listResourceTemplatesRequest;
+        return alternative<QMcpListResourceTemplatesRequest>("listResourceTemplatesRequest");
     }
 
     void setListResourceTemplatesRequest(const QMcpListResourceTemplatesRequest &listResourceTemplatesRequest) {
-        if (this->listResourceTemplatesRequest() == listResourceTemplatesRequest) return;
-        setRefType("listResourceTemplatesRequest"_ba);
-        d<Private>()->listResourceTemplatesRequest = listResourceTemplatesRequest;
+        setAlternative("listResourceTemplatesRequest"_ba, listResourceTemplatesRequest);
     }
 
     QMcpReadResourceRequest readResourceRequest() const {
-        return d<Private>()->readResourceRequest;
+        return alternative<QMcpReadResourceRequest>("readResourceRequest");
     }
 
     void setReadResourceRequest(const QMcpReadResourceRequest &readResourceRequest) {
-        if (this->readResourceRequest() == readResourceRequest) return;
-        setRefType("readResourceRequest"_ba);
-        d<Private>()->readResourceRequest = readResourceRequest;
+        setAlternative("readResourceRequest"_ba, readResourceRequest);
     }
 
     QMcpSubscribeRequest subscribeRequest() const {
-        return d<Private>()->subscribeRequest;
+        return alternative<QMcpSubscribeRequest>("subscribeRequest");
     }
 
     void setSubscribeRequest(const QMcpSubscribeRequest &subscribeRequest) {
-        if (this->subscribeRequest() == subscribeRequest) return;
-        setRefType("subscribeRequest"_ba);
-        d<Private>()->subscribeRequest = subscribeRequest;
+        setAlternative("subscribeRequest"_ba, subscribeRequest);
     }
 
     QMcpUnsubscribeRequest unsubscribeRequest() const {
-        return d<Private>()->unsubscribeRequest;
+        return alternative<QMcpUnsubscribeRequest>("unsubscribeRequest");
     }
 
     void setUnsubscribeRequest(const QMcpUnsubscribeRequest &unsubscribeRequest) {
-        if (this->unsubscribeRequest() == unsubscribeRequest) return;
-        setRefType("unsubscribeRequest"_ba);
-        d<Private>()->unsubscribeRequest = unsubscribeRequest;
+        setAlternative("unsubscribeRequest"_ba, unsubscribeRequest);
     }
 
     QMcpListPromptsRequest listPromptsRequest() const {
-        return d<Private>()->listPromptsRequest;
+        return alternative<QMcpListPromptsRequest>("listPromptsRequest");
     }
 
     void setListPromptsRequest(const QMcpListPromptsRequest &listPromptsRequest) {
-        if (this->listPromptsRequest() == listPromptsRequest) return;
-        setRefType("listPromptsRequest"_ba);
-        d<Private>()->listPromptsRequest = listPromptsRequest;
+        setAlternative("listPromptsRequest"_ba, listPromptsRequest);
     }
 
     QMcpGetPromptRequest getPromptRequest() const {
-        return d<Private>()->getPromptRequest;
+        return alternative<QMcpGetPromptRequest>("getPromptRequest");
     }
 
     void setGetPromptRequest(const QMcpGetPromptRequest &getPromptRequest) {
-        if (this->getPromptRequest() == getPromptRequest) return;
-        setRefType("getPromptRequest"_ba);
-        d<Private>()->getPromptRequest = getPromptRequest;
+        setAlternative("getPromptRequest"_ba, getPromptRequest);
     }
 
     QMcpListToolsRequest listToolsRequest() const {
-        return d<Private>()->listToolsRequest;
+        return alternative<QMcpListToolsRequest>("listToolsRequest");
     }
 
     void setListToolsRequest(const QMcpListToolsRequest &listToolsRequest) {
-        if (this->listToolsRequest() == listToolsRequest) return;
-        setRefType("listToolsRequest"_ba);
-        d<Private>()->listToolsRequest = listToolsRequest;
+        setAlternative("listToolsRequest"_ba, listToolsRequest);
     }
 
     QMcpCallToolRequest callToolRequest() const {
-        return d<Private>()->callToolRequest;
+        return alternative<QMcpCallToolRequest>("callToolRequest");
     }
 
     void setCallToolRequest(const QMcpCallToolRequest &callToolRequest) {
-        if (this->callToolRequest() == callToolRequest) return;
-        setRefType("callToolRequest"_ba);
-        d<Private>()->callToolRequest = callToolRequest;
+        setAlternative("callToolRequest"_ba, callToolRequest);
     }
 
     QMcpSetLevelRequest setLevelRequest() const {
-        return d<Private>()->setLevelRequest;
+        return alternative<QMcpSetLevelRequest>("setLevelRequest");
     }
 
     void setSetLevelRequest(const QMcpSetLevelRequest &setLevelRequest) {
-        if (this->setLevelRequest() == setLevelRequest) return;
-        setRefType("setLevelRequest"_ba);
-        d<Private>()->setLevelRequest = setLevelRequest;
+        setAlternative("setLevelRequest"_ba, setLevelRequest);
     }
 
     QMcpCompleteRequest completeRequest() const {
-        return d<Private>()->completeRequest;
+        return alternative<QMcpCompleteRequest>("completeRequest");
     }
 
     void setCompleteRequest(const QMcpCompleteRequest &completeRequest) {
-        if (this->completeRequest() == completeRequest) return;
-        setRefType("completeRequest"_ba);
-        d<Private>()->completeRequest = completeRequest;
+        setAlternative("completeRequest"_ba, completeRequest);
     }
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpInitializeRequest initializeRequest;
-        QMcpPingRequest pingRequest;
-        QMcpListResourcesRequest listResourcesRequest;
-        QMcpListResourceTemplatesRequest listResourceTemplatesRequest;
-        QMcpReadResourceRequest readResourceRequest;
-        QMcpSubscribeRequest subscribeRequest;
-        QMcpUnsubscribeRequest unsubscribeRequest;
-        QMcpListPromptsRequest listPromptsRequest;
-        QMcpGetPromptRequest getPromptRequest;
-        QMcpListToolsRequest listToolsRequest;
-        QMcpCallToolRequest callToolRequest;
-        QMcpSetLevelRequest setLevelRequest;
-        QMcpCompleteRequest completeRequest;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
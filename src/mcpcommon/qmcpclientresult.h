@@ -26,41 +26,31 @@ public:
     }
 
     QMcpResult result() const {
-        return d<Private>()->result;
+        return alternative<QMcpResult>("result");
     }
 
     void setResult(const QMcpResult &result) {
-        if (this->result() == result) return;
-        setRefType("result"_ba);
-        d<Private>()->result = result;
+        setAlternative("result"_ba, result);
     }
 
     QMcpCreateMessageResult createMessageResult() const {
-        return d<Private>()->createMessageResult;
+        return alternative<QMcpCreateMessageResult>("createMessageResult");
     }
 
     void setCreateMessageResult(const QMcpCreateMessageResult &createMessageResult) {
-        if (this->createMessageResult() == createMessageResult) return;
-        setRefType("createMessageResult"_ba);
-        d<Private>()->createMessageResult = createMessageResult;
+        setAlternative("createMessageResult"_ba, createMessageResult);
     }
 
     QMcpListRootsResult listRootsResult() const {
-        return d<Private>()->listRootsResult;
+        return alternative<QMcpListRootsResult>("listRootsResult");
     }
 
     void setListRootsResult(const QMcpListRootsResult &listRootsResult) {
-        if (this->listRootsResult() == listRootsResult) return;
-        setRefType("listRootsResult"_ba);
-        d<Private>()->listRootsResult = listRootsResult;
+        setAlternative("listRootsResult"_ba, listRootsResult);
     }
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpResult result;
-        QMcpCreateMessageResult createMessageResult;
-        QMcpListRootsResult listRootsResult;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
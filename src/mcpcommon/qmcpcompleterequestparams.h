@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCompleteRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpCompleteRequestParams::argument
@@ -34,6 +35,18 @@ public:
     void setArgument(const QMcpCompleteRequestParamsArgument &argument) {
         if (this->argument() == argument) return;
         d<Private>()->argument = argument;
+        setModified(argumentIndex());
+    }
+
+    void setArgument(QMcpCompleteRequestParamsArgument &&argument) {
+        if (!isModified(argumentIndex()) && this->argument() == argument) return;
+        d<Private>()->argument = std::move(argument);
+        setModified(argumentIndex());
+    }
+
+    QMcpCompleteRequestParamsArgument takeArgument() {
+        clearModified(argumentIndex());
+        return std::exchange(d<Private>()->argument, QMcpCompleteRequestParamsArgument());
     }
 
     QMcpCompleteRequestParamsRef ref() const {
@@ -43,6 +56,18 @@ public:
     void setRef(const QMcpCompleteRequestParamsRef &ref) {
         if (this->ref() == ref) return;
         d<Private>()->ref = ref;
+        setModified(refIndex());
+    }
+
+    void setRef(QMcpCompleteRequestParamsRef &&ref) {
+        if (!isModified(refIndex()) && this->ref() == ref) return;
+        d<Private>()->ref = std::move(ref);
+        setModified(refIndex());
+    }
+
+    QMcpCompleteRequestParamsRef takeRef() {
+        clearModified(refIndex());
+        return std::exchange(d<Private>()->ref, QMcpCompleteRequestParamsRef());
     }
 
     const QMetaObject* metaObject() const override {
@@ -50,10 +75,30 @@ public:
     }
 
 private:
+    static int argumentIndex() {
+        static const int index = staticMetaObject.indexOfProperty("argument");
+        return index;
+    }
+    static int refIndex() {
+        static const int index = staticMetaObject.indexOfProperty("ref");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpCompleteRequestParamsArgument argument;
         QMcpCompleteRequestParamsRef ref;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && argument == that.argument
+                && ref == that.ref;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), argument, ref);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCompleteRequestParamsArgument : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpCompleteRequestParamsArgument::name
@@ -39,6 +40,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     QString value() const {
@@ -48,6 +61,18 @@ public:
     void setValue(const QString &value) {
         if (this->value() == value) return;
         d<Private>()->value = value;
+        setModified(valueIndex());
+    }
+
+    void setValue(QString &&value) {
+        if (!isModified(valueIndex()) && this->value() == value) return;
+        d<Private>()->value = std::move(value);
+        setModified(valueIndex());
+    }
+
+    QString takeValue() {
+        clearModified(valueIndex());
+        return std::exchange(d<Private>()->value, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -55,10 +80,30 @@ public:
     }
 
 private:
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+    static int valueIndex() {
+        static const int index = staticMetaObject.indexOfProperty("value");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString name;
         QString value;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && name == that.name
+                && value == that.value;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), name, value);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -24,29 +24,22 @@ public:
     }
 
     QMcpPromptReference promptReference() const {
-        return d<Private>()->promptReference;
+        return alternative<QMcpPromptReference>("promptReference");
     }
 
     void setPromptReference(const QMcpPromptReference &promptReference) {
-        if (this->promptReference() == promptReference) return;
-        setRefType("promptReference"_ba);
-        d<Private>()->promptReference = promptReference;
+        setAlternative("promptReference"_ba, promptReference);
     }
 
     QMcpResourceReference resourceReference() const {
-        return d<Private>()->resourceReference;
+        return alternative<QMcpResourceReference>("resourceReference");
     }
 
     void setResourceReference(const QMcpResourceReference &resourceReference) {
-        if (this->resourceReference() == resourceReference) return;
-        setRefType("resourceReference"_ba);
-        d<Private>()->resourceReference = resourceReference;
+        setAlternative("resourceReference"_ba, resourceReference);
     }
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpPromptReference promptReference;
-        QMcpResourceReference resourceReference;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCompleteResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpCompleteResultCompletion completion READ completion WRITE setCompletion REQUIRED)
 
@@ -29,6 +30,18 @@ public:
     void setCompletion(const QMcpCompleteResultCompletion &completion) {
         if (this->completion() == completion) return;
         d<Private>()->completion = completion;
+        setModified(completionIndex());
+    }
+
+    void setCompletion(QMcpCompleteResultCompletion &&completion) {
+        if (!isModified(completionIndex()) && this->completion() == completion) return;
+        d<Private>()->completion = std::move(completion);
+        setModified(completionIndex());
+    }
+
+    QMcpCompleteResultCompletion takeCompletion() {
+        clearModified(completionIndex());
+        return std::exchange(d<Private>()->completion, QMcpCompleteResultCompletion());
     }
 
     const QMetaObject* metaObject() const override {
@@ -36,9 +49,24 @@ public:
     }
 
 private:
+    static int completionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("completion");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QMcpCompleteResultCompletion completion;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && completion == that.completion;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), completion);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
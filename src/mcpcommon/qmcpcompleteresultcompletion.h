@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCompleteResultCompletion : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpCompleteResultCompletion::hasMore
@@ -49,6 +50,7 @@ public:
     void setHasMore(bool hasMore) {
         if (this->hasMore() == hasMore) return;
         d<Private>()->hasMore = hasMore;
+        setModified(hasMoreIndex());
     }
 
     int total() const {
@@ -58,6 +60,7 @@ public:
     void setTotal(int total) {
         if (this->total() == total) return;
         d<Private>()->total = total;
+        setModified(totalIndex());
     }
 
     QList<QString> values() const {
@@ -67,6 +70,34 @@ public:
     void setValues(const QList<QString> &values) {
         if (this->values() == values) return;
         d<Private>()->values = values;
+        setModified(valuesIndex());
+    }
+
+    void setValues(QList<QString> &&values) {
+        if (!isModified(valuesIndex()) && this->values() == values) return;
+        d<Private>()->values = std::move(values);
+        setModified(valuesIndex());
+    }
+
+    QList<QString> takeValues() {
+        clearModified(valuesIndex());
+        return std::exchange(d<Private>()->values, QList<QString>());
+    }
+
+    void appendValue(const QString &value) {
+        d<Private>()->values.append(value);
+        setModified(valuesIndex());
+    }
+
+    void appendValue(QString &&value) {
+        d<Private>()->values.append(std::move(value));
+        setModified(valuesIndex());
+    }
+
+    template <typename... Args>
+    QString &emplaceValue(Args &&...args) {
+        setModified(valuesIndex());
+        return d<Private>()->values.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -74,11 +105,36 @@ public:
     }
 
 private:
+    static int hasMoreIndex() {
+        static const int index = staticMetaObject.indexOfProperty("hasMore");
+        return index;
+    }
+    static int totalIndex() {
+        static const int index = staticMetaObject.indexOfProperty("total");
+        return index;
+    }
+    static int valuesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("values");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         bool hasMore = false;
         int total = 0;
         QList<QString> values;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && hasMore == that.hasMore
+                && total == that.total
+                && values == that.values;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), hasMore, total, values);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCreateMessageRequest : public QMcpRequest
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpCreateMessageRequestParams params READ params WRITE setParams REQUIRED)
 
@@ -31,6 +32,18 @@ public:
     void setParams(const QMcpCreateMessageRequestParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpCreateMessageRequestParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpCreateMessageRequestParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpCreateMessageRequestParams());
     }
 
     const QMetaObject* metaObject() const override {
@@ -38,9 +51,24 @@ public:
     }
 
 private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
     struct Private : public QMcpRequest::Private {
         QMcpCreateMessageRequestParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpRequest::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpRequest::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -21,6 +21,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCreateMessageRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpCreateMessageRequestParams::includeContext
@@ -69,48 +70,154 @@ public:
     void setIncludeContext(const QString &value) {
         if (includeContext() == value) return;
         d<Private>()->includeContext = value;
+        setModified(includeContextIndex());
+    }
+
+    void setIncludeContext(QString &&value) {
+        if (!isModified(includeContextIndex()) && includeContext() == value) return;
+        d<Private>()->includeContext = std::move(value);
+        setModified(includeContextIndex());
+    }
+
+    QString takeIncludeContext() {
+        clearModified(includeContextIndex());
+        return std::exchange(d<Private>()->includeContext, QString());
     }
 
     int maxTokens() const { return d<Private>()->maxTokens; }
     void setMaxTokens(int value) {
         if (maxTokens() == value) return;
         d<Private>()->maxTokens = value;
+        setModified(maxTokensIndex());
     }
 
     QList<QMcpSamplingMessage> messages() const { return d<Private>()->messages; }
     void setMessages(const QList<QMcpSamplingMessage> &value) {
         if (messages() == value) return;
         d<Private>()->messages = value;
+        setModified(messagesIndex());
+    }
+
+    void setMessages(QList<QMcpSamplingMessage> &&value) {
+        if (!isModified(messagesIndex()) && messages() == value) return;
+        d<Private>()->messages = std::move(value);
+        setModified(messagesIndex());
+    }
+
+    QList<QMcpSamplingMessage> takeMessages() {
+        clearModified(messagesIndex());
+        return std::exchange(d<Private>()->messages, QList<QMcpSamplingMessage>());
+    }
+
+    void appendMessage(const QMcpSamplingMessage &message) {
+        d<Private>()->messages.append(message);
+        setModified(messagesIndex());
+    }
+
+    void appendMessage(QMcpSamplingMessage &&message) {
+        d<Private>()->messages.append(std::move(message));
+        setModified(messagesIndex());
+    }
+
+    template <typename... Args>
+    QMcpSamplingMessage &emplaceMessage(Args &&...args) {
+        setModified(messagesIndex());
+        return d<Private>()->messages.emplaceBack(std::forward<Args>(args)...);
     }
 
     QMcpCreateMessageRequestParamsMetadata metadata() const { return d<Private>()->metadata; }
     void setMetadata(const QMcpCreateMessageRequestParamsMetadata &value) {
         if (metadata() == value) return;
         d<Private>()->metadata = value;
+        setModified(metadataIndex());
+    }
+
+    void setMetadata(QMcpCreateMessageRequestParamsMetadata &&value) {
+        if (!isModified(metadataIndex()) && metadata() == value) return;
+        d<Private>()->metadata = std::move(value);
+        setModified(metadataIndex());
+    }
+
+    QMcpCreateMessageRequestParamsMetadata takeMetadata() {
+        clearModified(metadataIndex());
+        return std::exchange(d<Private>()->metadata, QMcpCreateMessageRequestParamsMetadata());
     }
 
     QMcpModelPreferences modelPreferences() const { return d<Private>()->modelPreferences; }
     void setModelPreferences(const QMcpModelPreferences &value) {
         if (modelPreferences() == value) return;
         d<Private>()->modelPreferences = value;
+        setModified(modelPreferencesIndex());
+    }
+
+    void setModelPreferences(QMcpModelPreferences &&value) {
+        if (!isModified(modelPreferencesIndex()) && modelPreferences() == value) return;
+        d<Private>()->modelPreferences = std::move(value);
+        setModified(modelPreferencesIndex());
+    }
+
+    QMcpModelPreferences takeModelPreferences() {
+        clearModified(modelPreferencesIndex());
+        return std::exchange(d<Private>()->modelPreferences, QMcpModelPreferences());
     }
 
     QList<QString> stopSequences() const { return d<Private>()->stopSequences; }
     void setStopSequences(const QList<QString> &value) {
         if (stopSequences() == value) return;
         d<Private>()->stopSequences = value;
+        setModified(stopSequencesIndex());
+    }
+
+    void setStopSequences(QList<QString> &&value) {
+        if (!isModified(stopSequencesIndex()) && stopSequences() == value) return;
+        d<Private>()->stopSequences = std::move(value);
+        setModified(stopSequencesIndex());
+    }
+
+    QList<QString> takeStopSequences() {
+        clearModified(stopSequencesIndex());
+        return std::exchange(d<Private>()->stopSequences, QList<QString>());
+    }
+
+    void appendStopSequence(const QString &stopSequence) {
+        d<Private>()->stopSequences.append(stopSequence);
+        setModified(stopSequencesIndex());
+    }
+
+    void appendStopSequence(QString &&stopSequence) {
+        d<Private>()->stopSequences.append(std::move(stopSequence));
+        setModified(stopSequencesIndex());
+    }
+
+    template <typename... Args>
+    QString &emplaceStopSequence(Args &&...args) {
+        setModified(stopSequencesIndex());
+        return d<Private>()->stopSequences.emplaceBack(std::forward<Args>(args)...);
     }
 
     QString systemPrompt() const { return d<Private>()->systemPrompt; }
     void setSystemPrompt(const QString &value) {
         if (systemPrompt() == value) return;
         d<Private>()->systemPrompt = value;
+        setModified(systemPromptIndex());
+    }
+
+    void setSystemPrompt(QString &&value) {
+        if (!isModified(systemPromptIndex()) && systemPrompt() == value) return;
+        d<Private>()->systemPrompt = std::move(value);
+        setModified(systemPromptIndex());
+    }
+
+    QString takeSystemPrompt() {
+        clearModified(systemPromptIndex());
+        return std::exchange(d<Private>()->systemPrompt, QString());
     }
 
     qreal temperature() const { return d<Private>()->temperature; }
     void setTemperature(qreal value) {
         if (temperature() == value) return;
         d<Private>()->temperature = value;
+        setModified(temperatureIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -118,6 +225,39 @@ public:
     }
 
 private:
+    static int includeContextIndex() {
+        static const int index = staticMetaObject.indexOfProperty("includeContext");
+        return index;
+    }
+    static int maxTokensIndex() {
+        static const int index = staticMetaObject.indexOfProperty("maxTokens");
+        return index;
+    }
+    static int messagesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("messages");
+        return index;
+    }
+    static int metadataIndex() {
+        static const int index = staticMetaObject.indexOfProperty("metadata");
+        return index;
+    }
+    static int modelPreferencesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("modelPreferences");
+        return index;
+    }
+    static int stopSequencesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("stopSequences");
+        return index;
+    }
+    static int systemPromptIndex() {
+        static const int index = staticMetaObject.indexOfProperty("systemPrompt");
+        return index;
+    }
+    static int temperatureIndex() {
+        static const int index = staticMetaObject.indexOfProperty("temperature");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString includeContext;
         int maxTokens = 0;
@@ -128,6 +268,23 @@ private:
         QString systemPrompt;
         qreal temperature = 0;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && includeContext == that.includeContext
+                && maxTokens == that.maxTokens
+                && messages == that.messages
+                && metadata == that.metadata
+                && modelPreferences == that.modelPreferences
+                && stopSequences == that.stopSequences
+                && systemPrompt == that.systemPrompt
+                && temperature == that.temperature;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), includeContext, maxTokens, messages, metadata, modelPreferences, stopSequences, systemPrompt, temperature);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
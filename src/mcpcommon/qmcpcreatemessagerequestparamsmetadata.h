@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCreateMessageRequestParamsMetadata : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QJsonObject additionalProperties READ additionalProperties WRITE setAdditionalProperties)
 
@@ -26,6 +27,18 @@ public:
     void setAdditionalProperties(const QJsonObject &value) {
         if (additionalProperties() == value) return;
         d<Private>()->additionalProperties = value;
+        setModified(additionalPropertiesIndex());
+    }
+
+    void setAdditionalProperties(QJsonObject &&value) {
+        if (!isModified(additionalPropertiesIndex()) && additionalProperties() == value) return;
+        d<Private>()->additionalProperties = std::move(value);
+        setModified(additionalPropertiesIndex());
+    }
+
+    QJsonObject takeAdditionalProperties() {
+        clearModified(additionalPropertiesIndex());
+        return std::exchange(d<Private>()->additionalProperties, QJsonObject());
     }
 
     const QMetaObject* metaObject() const override {
@@ -33,9 +46,24 @@ public:
     }
 
 private:
+    static int additionalPropertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("additionalProperties");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QJsonObject additionalProperties;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && additionalProperties == that.additionalProperties;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), additionalProperties);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpCreateMessageResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpCreateMessageResultContent content READ content WRITE setContent REQUIRED)
 
@@ -42,24 +43,61 @@ public:
     void setContent(const QMcpCreateMessageResultContent &value) {
         if (content() == value) return;
         d<Private>()->content = value;
+        setModified(contentIndex());
+    }
+
+    void setContent(QMcpCreateMessageResultContent &&value) {
+        if (!isModified(contentIndex()) && content() == value) return;
+        d<Private>()->content = std::move(value);
+        setModified(contentIndex());
+    }
+
+    QMcpCreateMessageResultContent takeContent() {
+        clearModified(contentIndex());
+        return std::exchange(d<Private>()->content, QMcpCreateMessageResultContent());
     }
 
     QString model() const { return d<Private>()->model; }
     void setModel(const QString &value) {
         if (model() == value) return;
         d<Private>()->model = value;
+        setModified(modelIndex());
+    }
+
+    void setModel(QString &&value) {
+        if (!isModified(modelIndex()) && model() == value) return;
+        d<Private>()->model = std::move(value);
+        setModified(modelIndex());
+    }
+
+    QString takeModel() {
+        clearModified(modelIndex());
+        return std::exchange(d<Private>()->model, QString());
     }
 
     QMcpRole::QMcpRole role() const { return d<Private>()->role; }
     void setRole(const QMcpRole::QMcpRole &value) {
         if (role() == value) return;
         d<Private>()->role = value;
+        setModified(roleIndex());
     }
 
     QString stopReason() const { return d<Private>()->stopReason; }
     void setStopReason(const QString &value) {
         if (stopReason() == value) return;
         d<Private>()->stopReason = value;
+        setModified(stopReasonIndex());
+    }
+
+    void setStopReason(QString &&value) {
+        if (!isModified(stopReasonIndex()) && stopReason() == value) return;
+        d<Private>()->stopReason = std::move(value);
+        setModified(stopReasonIndex());
+    }
+
+    QString takeStopReason() {
+        clearModified(stopReasonIndex());
+        return std::exchange(d<Private>()->stopReason, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -67,12 +105,42 @@ public:
     }
 
 private:
+    static int contentIndex() {
+        static const int index = staticMetaObject.indexOfProperty("content");
+        return index;
+    }
+    static int modelIndex() {
+        static const int index = staticMetaObject.indexOfProperty("model");
+        return index;
+    }
+    static int roleIndex() {
+        static const int index = staticMetaObject.indexOfProperty("role");
+        return index;
+    }
+    static int stopReasonIndex() {
+        static const int index = staticMetaObject.indexOfProperty("stopReason");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QMcpCreateMessageResultContent content;
         QString model;
         QMcpRole::QMcpRole role;
         QString stopReason;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && content == that.content
+                && model == that.model
+                && role == that.role
+                && stopReason == that.stopReason;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), content, model, role, stopReason);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
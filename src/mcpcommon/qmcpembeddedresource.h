@@ -21,6 +21,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpEmbeddedResource : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
     Q_PROPERTY(QMcpEmbeddedResourceResource resource READ resource WRITE setResource REQUIRED)
@@ -36,6 +37,18 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     QMcpEmbeddedResourceResource resource() const {
@@ -45,6 +58,18 @@ public:
     void setResource(const QMcpEmbeddedResourceResource &resource) {
         if (this->resource() == resource) return;
         d<Private>()->resource = resource;
+        setModified(resourceIndex());
+    }
+
+    void setResource(QMcpEmbeddedResourceResource &&resource) {
+        if (!isModified(resourceIndex()) && this->resource() == resource) return;
+        d<Private>()->resource = std::move(resource);
+        setModified(resourceIndex());
+    }
+
+    QMcpEmbeddedResourceResource takeResource() {
+        clearModified(resourceIndex());
+        return std::exchange(d<Private>()->resource, QMcpEmbeddedResourceResource());
     }
 
     static QByteArray type() { return QByteArrayLiteral("resource"); }
@@ -54,11 +79,31 @@ public:
     }
 
 private:
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+    static int resourceIndex() {
+        static const int index = staticMetaObject.indexOfProperty("resource");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
     public:
         QMcpAnnotations annotations;
         QMcpEmbeddedResourceResource resource;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations
+                && resource == that.resource;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), annotations, resource);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -25,30 +25,23 @@ public:
     }
 
     QMcpTextResourceContents textResourceContents() const {
-        return d<Private>()->textResourceContents;
+        return alternative<QMcpTextResourceContents>("textResourceContents");
     }
 
     void setTextResourceContents(const QMcpTextResourceContents &textResourceContents) {
-        if (this->textResourceContents() == textResourceContents) return;
-        setRefType("textResourceContents"_ba);
-        d<Private>()->textResourceContents = textResourceContents;
+        setAlternative("textResourceContents"_ba, textResourceContents);
     }
 
     QMcpBlobResourceContents blobResourceContents() const {
-        return d<Private>()->blobResourceContents;
+        return alternative<QMcpBlobResourceContents>("blobResourceContents");
     }
 
     void setBlobResourceContents(const QMcpBlobResourceContents &blobResourceContents) {
-        if (this->blobResourceContents() == blobResourceContents) return;
-        setRefType("blobResourceContents"_ba);
-        d<Private>()->blobResourceContents = blobResourceContents;
+        setAlternative("blobResourceContents"_ba, blobResourceContents);
     }
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpTextResourceContents textResourceContents;
-        QMcpBlobResourceContents blobResourceContents;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
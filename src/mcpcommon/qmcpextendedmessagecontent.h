@@ -17,13 +17,11 @@ class Q_MCPCOMMON_EXPORT QMcpExtendedMessageContent : public QMcpMessageContentB
 
 public:
     QMcpEmbeddedResource embeddedResource() const {
-        return d<Private>()->embeddedResource;
+        return alternative<QMcpEmbeddedResource>("embeddedResource");
     }
 
     void setEmbeddedResource(const QMcpEmbeddedResource &embeddedResource) {
-        if (this->embeddedResource() == embeddedResource) return;
-        setRefType("embeddedResource"_ba);
-        d<Private>()->embeddedResource = embeddedResource;
+        setAlternative("embeddedResource"_ba, embeddedResource);
     }
 
 protected:
@@ -31,7 +29,6 @@ protected:
     QMcpExtendedMessageContent(Private *d) : QMcpMessageContentBase(d) {}
 
     struct Private : public QMcpMessageContentBase::Private {
-        QMcpEmbeddedResource embeddedResource;
     };
 };
 
@@ -2,324 +2,764 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpgadget.h"
+#include "qmcpgadget_p.h"
+#include "qmcpanyof.h"
+#include "qmcpjsonwriter.h"
+#include "qmcpschema_p.h"
+#include "qmcpgadgetserializers_p.h"
 
+#include <QtCore/qhash.h>
 #include <QtCore/qjsonarray.h>
+#include <QtCore/qreadwritelock.h>
+#include <QtCore/qsequentialiterable.h>
+#include <QtCore/qset.h>
+#include <QtCore/qurl.h>
 
 QT_BEGIN_NAMESPACE
 
-bool QMcpGadget::fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion protocolVersion)
+namespace {
+using Kind = QMcpGadgetPlan::Kind;
+using Property = QMcpGadgetPlan::Property;
+
+bool isListTypeName(const QByteArray &typeName)
 {
-    const auto mo = metaObject();
+    return typeName.startsWith("QList<"_ba) || typeName.endsWith("List"_ba);
+}
+
+QByteArray listElementTypeName(const QByteArray &typeName)
+{
+    if (typeName.startsWith("QList<"_ba) && typeName.endsWith('>'))
+        return typeName.mid(6).chopped(1).trimmed();
+    if (typeName.startsWith('Q') && typeName.endsWith("List"_ba))
+        return typeName.chopped(4);
+    return {};
+}
 
-    for (int i = 0; i < mo->propertyCount(); i++) {
-        const auto property = mo->property(i);
-        if (property.isConstant())
+QMetaEnum metaEnumFor(QMetaType metaType)
+{
+    const auto mo = metaType.metaObject();
+    if (!mo)
+        return {};
+    for (int i = 0; i < mo->enumeratorCount(); i++) {
+        const auto me = mo->enumerator(i);
+        if (metaType.name() == QByteArray(mo->className()) + "::" + me.enumName())
+            return me;
+    }
+    return {};
+}
+
+// Classes opt in with Q_CLASSINFO("QMcpModifiedTracking", "true") once their
+// setters call setModified(). Classes that do not declare properties are neutral.
+bool hasModifiedTracking(const QMetaObject *mo)
+{
+    for (; mo && mo != &QMcpGadget::staticMetaObject; mo = mo->superClass()) {
+        if (mo->propertyOffset() == mo->propertyCount())
             continue;
-        const auto propertyType = property.typeName();
-        const auto propertyName = QString::fromLatin1(property.name());
-        if (!object.contains(propertyName)) {
-            if (property.isRequired() && !property.isConstant())
+        if (mo->indexOfClassInfo("QMcpModifiedTracking") < mo->classInfoOffset())
+            return false;
+    }
+    return true;
+}
+
+// Whether the property exists in the protocol version. A class declares the
+// version that introduced a property with
+// Q_CLASSINFO("QMcpSince:<property>", "<version>"). Otherwise a property is
+// left out when the MCP schema of the version lacks a field that the schema
+// of another version has for the same type.
+bool existsInVersion(const QMetaObject *mo, const QMetaProperty &mp, QtMcp::ProtocolVersion protocolVersion)
+{
+    const auto since = mo->indexOfClassInfo("QMcpSince:"_ba + mp.name());
+    if (since >= 0) {
+        const auto version = QString::fromLatin1(mo->classInfo(since).value());
+        return protocolVersion >= QtMcp::stringToProtocolVersion(version);
+    }
+
+    auto type = QLatin1StringView(mp.enclosingMetaObject()->className());
+    if (!type.startsWith("QMcp"_L1))
+        return true;
+    type = type.sliced(4);
+    const auto key = QLatin1StringView(mp.name());
+    if (QMcpSchema::fields(protocolVersion, type).isEmpty() || QMcpSchema::field(protocolVersion, type, key))
+        return true;
+    const auto versions = QMcpSchema::protocolVersions();
+    for (const auto version : versions) {
+        if (version != protocolVersion && QMcpSchema::field(version, type, key))
+            return false;
+    }
+    return true;
+}
+
+// Whether a QByteArray property holds base64 text, declared with
+// Q_CLASSINFO("QMcpBase64:<property>", "true")
+bool isBase64(const QMetaObject *mo, const QMetaProperty &mp)
+{
+    const auto index = mo->indexOfClassInfo("QMcpBase64:"_ba + mp.name());
+    return index >= 0 && qstrcmp(mo->classInfo(index).value(), "true") == 0;
+}
+
+bool isMcpGadget(const QMetaObject *mo)
+{
+    return mo && mo->inherits(&QMcpGadget::staticMetaObject);
+}
+
+Kind kindOf(QMetaType metaType, const QByteArray &typeName, QMetaEnum *metaEnum)
+{
+    switch (metaType.id()) {
+    case QMetaType::Bool:
+        return Kind::Bool;
+    case QMetaType::Int:
+        return Kind::Int;
+    case QMetaType::Double:
+        return Kind::Double;
+    case QMetaType::QString:
+        return Kind::String;
+    case QMetaType::QByteArray:
+        return Kind::ByteArray;
+    case QMetaType::QUrl:
+        return Kind::Url;
+    case QMetaType::QJsonObject:
+        return Kind::JsonObject;
+    case QMetaType::QJsonValue:
+        return Kind::JsonValue;
+    case QMetaType::QVariant:
+        return Kind::Variant;
+    default:
+        break;
+    }
+    if (metaType.id() == qMetaTypeId<QtMcp::ProtocolVersion>())
+        return Kind::ProtocolVersion;
+    if (isListTypeName(typeName))
+        return Kind::List;
+    if (metaType.flags() & QMetaType::IsEnumeration) {
+        *metaEnum = metaEnumFor(metaType);
+        return Kind::Enum;
+    }
+    if ((metaType.flags() & QMetaType::PointerToGadget) && isMcpGadget(metaType.metaObject()))
+        return Kind::GadgetPointer;
+    if ((metaType.flags() & QMetaType::IsGadget) && isMcpGadget(metaType.metaObject()))
+        return Kind::Gadget;
+    return Kind::Other;
+}
+
+// to JSON
+
+QJsonValue genericToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toJsonValue();
+}
+
+QJsonValue boolToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toBool();
+}
+
+QJsonValue intToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toInt();
+}
+
+QJsonValue doubleToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toDouble();
+}
+
+QJsonValue stringToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toString();
+}
+
+QJsonValue byteArrayToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return QString::fromUtf8(value.toByteArray());
+}
+
+QJsonValue urlToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toUrl().toString();
+}
+
+QJsonValue jsonObjectToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return value.toJsonObject();
+}
+
+QJsonValue protocolVersionToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    return QtMcp::protocolVersionToString(value.value<QtMcp::ProtocolVersion>());
+}
+
+QJsonValue enumToJson(const Property &property, const QVariant &value, QtMcp::ProtocolVersion)
+{
+    if (!property.metaEnum.isValid())
+        return value.toJsonValue();
+    return QString::fromUtf8(property.metaEnum.valueToKey(value.toInt()));
+}
+
+QJsonValue gadgetToJson(const Property &, const QVariant &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    const auto *gadget = reinterpret_cast<const QMcpGadget *>(value.constData());
+    return gadget->toJsonObject(protocolVersion);
+}
+
+QJsonValue elementToJson(const Property &property, const QVariant &item, QtMcp::ProtocolVersion protocolVersion)
+{
+    switch (property.elementKind) {
+    case Kind::ByteArray:
+        return QString::fromUtf8(item.toByteArray());
+    case Kind::Enum:
+        return enumToJson(property, item, protocolVersion);
+    case Kind::Gadget:
+        return gadgetToJson(property, item, protocolVersion);
+    case Kind::GadgetPointer: {
+        const auto *gadget = *reinterpret_cast<QMcpGadget *const *>(item.constData());
+        return gadget ? QJsonValue(gadget->toJsonObject(protocolVersion)) : QJsonValue();
+    }
+    default:
+        break;
+    }
+    return item.toJsonValue();
+}
+
+QJsonValue listToJson(const Property &property, const QVariant &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    // Always convert to a JSON array even if the list is empty
+    if (property.elementKind == Kind::String)
+        return QJsonArray::fromStringList(value.toStringList());
+    QJsonArray array;
+    const QVariantList list = value.toList();
+    for (const auto &item : list)
+        array.append(elementToJson(property, item, protocolVersion));
+    return array;
+}
+
+// to JSON text
+
+void writeJsonValue(QMcpJsonWriter &writer, const Property &property, Kind kind, const QVariant &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    switch (kind) {
+    case Kind::Bool:
+        writer.writeBool(value.toBool());
+        break;
+    case Kind::Int:
+        writer.writeInteger(value.toInt());
+        break;
+    case Kind::Double:
+        writer.writeDouble(value.toDouble());
+        break;
+    case Kind::String:
+        writer.writeString(*reinterpret_cast<const QString *>(value.constData()));
+        break;
+    case Kind::ByteArray:
+        if (property.base64 && kind == property.kind)
+            writer.writeBase64Encoded(*reinterpret_cast<const QByteArray *>(value.constData()));
+        else
+            writer.writeUtf8String(*reinterpret_cast<const QByteArray *>(value.constData()));
+        break;
+    case Kind::Url:
+        writer.writeString(value.toUrl().toString());
+        break;
+    case Kind::JsonObject:
+        writer.writeObject(value.toJsonObject());
+        break;
+    case Kind::ProtocolVersion:
+        writer.writeString(QtMcp::protocolVersionToString(value.value<QtMcp::ProtocolVersion>()));
+        break;
+    case Kind::Enum:
+        if (property.metaEnum.isValid())
+            writer.writeUtf8String(property.metaEnum.valueToKey(value.toInt()));
+        else
+            writer.writeValue(value.toJsonValue());
+        break;
+    case Kind::Gadget:
+        reinterpret_cast<const QMcpGadget *>(value.constData())->writeJson(writer, protocolVersion);
+        break;
+    case Kind::GadgetPointer:
+        if (const auto *gadget = *reinterpret_cast<QMcpGadget *const *>(value.constData()))
+            gadget->writeJson(writer, protocolVersion);
+        else
+            writer.writeNull();
+        break;
+    case Kind::List: {
+        writer.beginArray();
+        const auto iterable = value.value<QSequentialIterable>();
+        for (auto it = iterable.constBegin(), end = iterable.constEnd(); it != end; ++it)
+            writeJsonValue(writer, property, property.elementKind, *it, protocolVersion);
+        writer.endArray();
+        break; }
+    default:
+        writer.writeValue(value.toJsonValue());
+        break;
+    }
+}
+
+// Reads the value of a property unless it is left out as unmodified
+bool readSerializedValue(const QMcpGadgetPlan *plan, const Property &property, quint64 modified, const QMcpGadget *gadget, QVariant *value)
+{
+    // only required or modified properties are serialized
+    if (!property.required && plan->tracksModified && !(modified & (quint64(1) << property.index)))
+        return false;
+    *value = property.metaProperty.readOnGadget(gadget);
+    if (!property.required && !plan->tracksModified && *value == property.defaultValue)
+        return false;
+    return true;
+}
+
+// from JSON
+
+bool writeProperty(const Property &property, QMcpGadget *gadget, const QVariant &value)
+{
+    if (!property.metaProperty.writeOnGadget(gadget, value))
+        qWarning() << property.metaProperty.typeName() << gadget->metaObject()->className() << property.key << value;
+    return true;
+}
+
+bool genericFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion)
+{
+    if (value.isObject() || value.isArray()) {
+        qWarning() << property.metaProperty.typeName() << "not supported for" << gadget->metaObject()->className() << property.key << value;
+        return true;
+    }
+    return writeProperty(property, gadget, value.toVariant());
+}
+
+bool jsonObjectFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    if (!value.isObject())
+        return genericFromJson(property, gadget, value, protocolVersion);
+    return writeProperty(property, gadget, value.toObject());
+}
+
+bool jsonValueFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion)
+{
+    return writeProperty(property, gadget, value);
+}
+
+bool protocolVersionFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    if (!value.isString())
+        return genericFromJson(property, gadget, value, protocolVersion);
+    const auto version = QtMcp::stringToProtocolVersion(value.toString());
+    return writeProperty(property, gadget, QVariant::fromValue(version));
+}
+
+bool gadgetFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    if (!value.isObject())
+        return genericFromJson(property, gadget, value, protocolVersion);
+    auto propertyValue = property.metaProperty.readOnGadget(gadget);
+    auto *child = reinterpret_cast<QMcpGadget *>(propertyValue.data());
+    if (!child->fromJsonObject(value.toObject(), protocolVersion))
+        return false;
+    return writeProperty(property, gadget, propertyValue);
+}
+
+bool listFromJson(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion protocolVersion)
+{
+    if (!value.isArray())
+        return genericFromJson(property, gadget, value, protocolVersion);
+    if (!property.elementType.isValid()) {
+        qWarning() << "Unknown type" << property.metaProperty.typeName() << property.key;
+        return true;
+    }
+
+    const auto array = value.toArray();
+    auto propertyValue = property.metaProperty.readOnGadget(gadget);
+    switch (property.elementKind) {
+    case Kind::Bool: {
+        auto *list = reinterpret_cast<QList<bool> *>(propertyValue.data());
+        for (const auto &v : array)
+            list->append(v.toBool());
+        break; }
+    case Kind::Int: {
+        auto *list = reinterpret_cast<QList<int> *>(propertyValue.data());
+        for (const auto &v : array)
+            list->append(v.toInt());
+        break; }
+    case Kind::ByteArray: {
+        auto *list = reinterpret_cast<QList<QByteArray> *>(propertyValue.data());
+        for (const auto &v : array) {
+            Q_ASSERT(v.isString());
+            list->append(v.toString().toLatin1());
+        }
+        break; }
+    case Kind::String: {
+        auto *list = reinterpret_cast<QList<QString> *>(propertyValue.data());
+        for (const auto &v : array) {
+            Q_ASSERT(v.isString());
+            list->append(v.toString());
+        }
+        break; }
+    case Kind::Enum: {
+        if (!property.metaEnum.isValid())
+            break;
+        auto *list = reinterpret_cast<QList<int> *>(propertyValue.data());
+        for (const auto &v : array) {
+            Q_ASSERT(v.isString());
+            list->append(property.metaEnum.keyToValue(v.toString().toLatin1().constData()));
+        }
+        break; }
+    case Kind::GadgetPointer: {
+        auto *list = reinterpret_cast<QList<QMcpGadget *> *>(propertyValue.data());
+        // Clear any existing items in the list first to avoid memory leaks
+        qDeleteAll(*list);
+        list->clear();
+        for (const auto &v : array) {
+            if (!v.isObject())
+                continue;
+            auto *child = static_cast<QMcpGadget *>(property.elementType.create());
+            if (!child->fromJsonObject(v.toObject(), protocolVersion)) {
+                property.elementType.destroy(child);
                 return false;
-            continue;
+            }
+            list->append(child);
+        }
+        break; }
+    case Kind::Gadget: {
+        auto iterable = propertyValue.view<QSequentialIterable>();
+        for (const auto &v : array) {
+            QVariant element(property.elementType);
+            auto *child = reinterpret_cast<QMcpGadget *>(element.data());
+            if (!child->fromJsonObject(v.toObject(), protocolVersion))
+                return false;
+            iterable.addValue(element);
         }
+        break; }
+    default: {
+        auto iterable = propertyValue.view<QSequentialIterable>();
+        for (const auto &v : array) {
+            QVariant element = v.toVariant();
+            if (!element.convert(property.elementType)) {
+                qWarning() << "Cannot convert" << v << "to" << property.elementType.name();
+                continue;
+            }
+            iterable.addValue(element);
+        }
+        break; }
+    }
+    return writeProperty(property, gadget, propertyValue);
+}
 
-        const auto value = object.value(propertyName);
-        if (value.isUndefined())
+void assignConverters(Property *property)
+{
+    switch (property->kind) {
+    case Kind::Bool:
+        property->toJson = boolToJson;
+        break;
+    case Kind::Int:
+        property->toJson = intToJson;
+        break;
+    case Kind::Double:
+        property->toJson = doubleToJson;
+        break;
+    case Kind::String:
+        property->toJson = stringToJson;
+        break;
+    case Kind::ByteArray:
+        property->toJson = byteArrayToJson;
+        break;
+    case Kind::Url:
+        property->toJson = urlToJson;
+        break;
+    case Kind::JsonObject:
+        property->toJson = jsonObjectToJson;
+        property->fromJson = jsonObjectFromJson;
+        break;
+    case Kind::JsonValue:
+        property->fromJson = jsonValueFromJson;
+        break;
+    case Kind::ProtocolVersion:
+        property->toJson = protocolVersionToJson;
+        property->fromJson = protocolVersionFromJson;
+        break;
+    case Kind::Enum:
+        property->toJson = enumToJson;
+        break;
+    case Kind::Gadget:
+        property->toJson = gadgetToJson;
+        property->fromJson = gadgetFromJson;
+        break;
+    case Kind::List:
+        property->toJson = listToJson;
+        property->fromJson = listFromJson;
+        break;
+    default:
+        break;
+    }
+    if (!property->toJson)
+        property->toJson = genericToJson;
+    if (!property->fromJson)
+        property->fromJson = genericFromJson;
+}
+
+// Returns the value of the constant property \a key of a default constructed
+// \a metaType, or a null string if there is none
+QString constantValue(QMetaType metaType, const QMcpGadgetPlan *plan, QStringView key)
+{
+    for (const auto &property : plan->properties) {
+        if (!property.constant || property.key != key)
             continue;
+        void *instance = metaType.create();
+        const auto value = property.metaProperty.readOnGadget(instance).toString();
+        metaType.destroy(instance);
+        return value;
+    }
+    return {};
+}
 
-        switch (value.type()) {
-        case QJsonValue::Array: {
-            const auto array = value.toArray();
-            auto propertyValue = property.readOnGadget(this);
-            // qDebug() << "Array" << propertyName << propertyValue << value.toArray();
-            QByteArray typeName = property.typeName();
-            if (typeName.startsWith('Q') && typeName.endsWith("List"_ba)) {
-                typeName = typeName.chopped(4);
-            } else if (typeName.startsWith("QList<"_ba) && typeName.endsWith('>')) {
-                typeName = typeName.mid(6).chopped(1);
-            } else {
-                qFatal() << typeName;
-            }
-            const auto mt = QMetaType::fromName(typeName);
-            if (!mt.isValid()) {
-                qWarning() << "Unknown type" << typeName << propertyValue;
-            } else {
-                switch (mt.id()) {
-                case QMetaType::Bool: {
-                    QList<bool> *list = reinterpret_cast<QList<bool> *>(propertyValue.data());
-                    for (const auto &v : array)
-                        list->append(v.toBool());
-                    break; }
-                case QMetaType::Int: {
-                    QList<int> *list = reinterpret_cast<QList<int> *>(propertyValue.data());
-                    for (const auto &v : array)
-                        list->append(v.toInt());
-                    break; }
-                case QMetaType::QByteArray: {
-                    QList<QByteArray> *list = reinterpret_cast<QList<QByteArray> *>(propertyValue.data());
-                    for (const auto &v : array) {
-                        Q_ASSERT(v.isString());
-                        list->append(v.toString().toLatin1());
-                    }
-                    break; }
-                case QMetaType::QString: {
-                    QList<QString> *list = reinterpret_cast<QList<QString> *>(propertyValue.data());
-                    for (const auto &v : array) {
-                        Q_ASSERT(v.isString());
-                        list->append(v.toString());
-                    }
-                    break; }
-                default: {
-                    const auto mo = mt.metaObject();
-                    if (mt.flags() & QMetaType::IsEnumeration) {
-                        for (int i = 0; i < mo->enumeratorCount(); i++) {
-                            const auto me = mo->enumerator(i);
-                            // qDebug() << i << typeName << mo->className() << me.name();
-                            if (typeName == QByteArray(mo->className()) + "::" + me.enumName()) {
-                                QList<int> *list = reinterpret_cast<QList<int> *>(propertyValue.data());
-                                for (const auto &str : array) {
-                                    Q_ASSERT(str.isString());
-                                    const auto string = str.toString();
-                                    auto bytearray = string.toLatin1();
-                                    const auto v = me.keyToValue(bytearray.constData());
-                                    list->append(v);
-                                }
-                                break;
-                            }
-                        }
-                    } else {
-                        // Check if this is a list of pointers to QMcpGadget objects
-                        if (typeName.endsWith('*')) {
-                            // Handle QList<QMcpGadget *> case
-                            QByteArray pointedTypeName = typeName.chopped(1).trimmed(); // Remove the * and any whitespace
-                            auto metaType = QMetaType::fromName(pointedTypeName);
-
-                            // Generic handling for lists of pointers to QMcpGadget subclasses
-                            QList<QMcpGadget *> *list = reinterpret_cast<QList<QMcpGadget *> *>(propertyValue.data());
-
-                            // Clear any existing items in the list first to avoid memory leaks
-                            qDeleteAll(*list);
-                            list->clear();
-
-                            for (const auto &v : array) {
-                                if (!v.isObject())
-                                    continue;
-
-                                // Create a new instance
-                                QMcpGadget *gadget = nullptr;
-
-                                if (metaType.isValid()) {
-                                    // Create using the meta-type if available
-                                    void *instance = metaType.create();
-                                    if (instance) {
-                                        gadget = static_cast<QMcpGadget *>(instance);
-                                    }
-                                }
-
-                                // If the meta-type approach failed, fall back to creating a generic instance
-                                if (!gadget) {
-                                    // As fallback, create a generic QMcpGadget instance
-                                    // since we can't know the exact type
-                                    gadget = new QMcpGadget();
-                                }
-
-                                // Populate it from JSON
-                                if (!gadget->fromJsonObject(v.toObject(), protocolVersion)) {
-                                    delete gadget;
-                                    return false;
-                                }
-
-                                // Add it to the list
-                                list->append(gadget);
-                            }
-                        } else {
-                            // Original code for handling QList<QMcpGadget>
-                            QList<QMcpGadget> *list = reinterpret_cast<QList<QMcpGadget> *>(propertyValue.data());
-                            for (const auto &v : array) {
-                                QMcpGadget base;
-                                auto *sub = static_cast<QMcpGadget *>(mt.construct(&base));
-                                if (!sub->fromJsonObject(v.toObject(), protocolVersion)) {
-                                    delete sub;
-                                    return false;
-                                }
-                                list->append(*sub);
-                            }
-                        }
-                    }
-                    break; }
-                }
-
-
-                if (!property.writeOnGadget(this, propertyValue))
-                    qFatal() << this;
-            }
-            break; }
-        case QJsonValue::Object: {
-            auto propertyValue = property.readOnGadget(this);
-            if (propertyValue.canConvert<QMcpGadget>()) {
-                auto *gadget = reinterpret_cast<QMcpGadget *>(propertyValue.data());
-                if (!gadget->fromJsonObject(value.toObject(), protocolVersion))
-                    return false;
-                if (!property.writeOnGadget(this, propertyValue))
-                    qFatal() << gadget;
-            } else {
-                switch (property.typeId()) {
-                case QMetaType::QJsonObject:
-                    property.writeOnGadget(this, value.toObject());
-                    break;
-                case QMetaType::QJsonValue:
-                    property.writeOnGadget(this, value);
-                    break;
-                default:
-                    qFatal() << propertyType << "not supporeted for" << mo->className() <<  propertyName << propertyValue;
-                    break;
-                }
-            }
-            break; }
-        case QJsonValue::String: {
-            // Special handling for QtMcp::ProtocolVersion
-            if (property.typeId() == qMetaTypeId<QtMcp::ProtocolVersion>()) {
-                // Convert string to enum
-                QtMcp::ProtocolVersion version = QtMcp::stringToProtocolVersion(value.toString());
-                if (!property.writeOnGadget(this, QVariant::fromValue(version))) {
-                    qWarning() << "Failed to write protocol version enum" << propertyType << mo->className() << propertyName << value;
-                }
-            } else {
-                // Default string handling
-                if (!property.writeOnGadget(this, value.toVariant())) {
-                    qWarning() << propertyType << mo->className() << propertyName << value;
-                }
-            }
-            break;
+void buildDiscriminatorIndex(QMcpGadgetPlan *plan)
+{
+    QList<QPair<const Property *, QMetaType>> candidates;
+    for (const auto &property : std::as_const(plan->properties)) {
+        if (property.kind == Kind::Gadget)
+            candidates.append({ &property, property.metaProperty.metaType() });
+    }
+
+    for (const auto key : { u"method"_s, u"type"_s }) {
+        QHash<QString, int> alternatives;
+        QSet<QString> ambiguous;
+        for (const auto &[property, metaType] : std::as_const(candidates)) {
+            const auto *alternative = QMcpGadgetPlan::get(metaType.metaObject(), plan->protocolVersion);
+            const auto value = constantValue(metaType, alternative, key);
+            if (value.isEmpty())
+                continue;
+            if (alternatives.contains(value))
+                ambiguous.insert(value);
+            alternatives.insert(value, property->index);
+        }
+        // values shared by several alternatives are left to the structural match
+        for (const auto &value : std::as_const(ambiguous))
+            alternatives.remove(value);
+        if (!alternatives.isEmpty()) {
+            plan->discriminator = key;
+            plan->alternatives = alternatives;
+            return;
         }
-        default:
-            if (!property.writeOnGadget(this, value.toVariant())) {
-                qWarning() << propertyType << mo->className() << propertyName << value;
+    }
+}
+
+// The generated serializer of the class and version, unless the properties
+// it writes differ from the ones of the plan
+const QMcpGadgetPlan::Serializer *findSerializer(const QMcpGadgetPlan *plan)
+{
+    if (!plan->tracksModified)
+        return nullptr;
+    for (const auto &serializer : serializers) {
+        if (serializer.metaObject != plan->metaObject || serializer.protocolVersion != plan->protocolVersion)
+            continue;
+        if (serializer.properties.size() != plan->properties.size())
+            return nullptr;
+        for (qsizetype i = 0; i < plan->properties.size(); i++) {
+            const auto &property = plan->properties.at(i);
+            const auto &generated = serializer.properties[i];
+            if (property.index != generated.index || property.required != generated.required
+                || property.key != QLatin1StringView(generated.key)) {
+                return nullptr;
             }
-            break;
         }
+        return &serializer;
     }
+    return nullptr;
+}
 
-    return true;
+struct PlanKey
+{
+    const QMetaObject *metaObject;
+    QtMcp::ProtocolVersion protocolVersion;
+
+    friend bool operator==(const PlanKey &lhs, const PlanKey &rhs) noexcept
+    {
+        return lhs.metaObject == rhs.metaObject && lhs.protocolVersion == rhs.protocolVersion;
+    }
+    friend size_t qHash(const PlanKey &key, size_t seed = 0) noexcept
+    {
+        return qHashMulti(seed, key.metaObject, static_cast<int>(key.protocolVersion));
+    }
+};
+
+struct PlanCache
+{
+    QReadWriteLock lock;
+    QHash<PlanKey, const QMcpGadgetPlan *> plans;
+    ~PlanCache() { qDeleteAll(plans); }
+};
+
+Q_GLOBAL_STATIC(PlanCache, planCache)
 }
 
-namespace {
-QList<int> requiredOrModifiedPropertyIndices(const QMcpGadget *gadget)
-{
-    QList<int> ret;
-    const auto mo = gadget->metaObject();
-    auto other = static_cast<QMcpGadget *>(mo->metaType().create());
-    for (int i = 0; i < mo->propertyCount(); ++i) {
-        const auto property = mo->property(i);
-        if (property.isRequired()) {
-            ret.append(i);
-        } else {
-            const auto value1 = property.readOnGadget(gadget);
-            const auto value2 = property.readOnGadget(other);
-            if (value1 != value2)
-                ret.append(i);
+QMcpGadgetPlan::QMcpGadgetPlan(const QMetaObject *metaObject, QtMcp::ProtocolVersion protocolVersion)
+    : metaObject(metaObject)
+    , protocolVersion(protocolVersion)
+    , tracksModified(hasModifiedTracking(metaObject))
+{
+    // Without modification tracking, a default constructed instance tells
+    // which values are unmodified
+    const auto metaType = metaObject->metaType();
+    void *defaultInstance = !tracksModified && metaType.isValid() ? metaType.create() : nullptr;
+
+    properties.reserve(metaObject->propertyCount());
+    for (int i = 0; i < metaObject->propertyCount(); i++) {
+        const auto mp = metaObject->property(i);
+        // a property redeclared by a subclass shadows the one of the base class
+        if (metaObject->indexOfProperty(mp.name()) != i)
+            continue;
+        // the plan of a version only knows the fields of its schema
+        if (!existsInVersion(metaObject, mp, protocolVersion))
+            continue;
+        Property property;
+        property.metaProperty = mp;
+        property.index = i;
+        property.key = QString::fromLatin1(mp.name());
+        property.required = mp.isRequired();
+        property.constant = mp.isConstant();
+        property.kind = kindOf(mp.metaType(), mp.typeName(), &property.metaEnum);
+        property.base64 = property.kind == Kind::ByteArray && isBase64(metaObject, mp);
+        if (property.kind == Kind::List) {
+            const auto elementTypeName = listElementTypeName(mp.typeName());
+            if (elementTypeName.endsWith('*')) {
+                property.elementKind = Kind::GadgetPointer;
+                property.elementType = QMetaType::fromName(elementTypeName.chopped(1).trimmed());
+            } else {
+                property.elementType = QMetaType::fromName(elementTypeName);
+                if (property.elementType.isValid())
+                    property.elementKind = kindOf(property.elementType, elementTypeName, &property.metaEnum);
+            }
         }
+        if (defaultInstance && !property.required)
+            property.defaultValue = mp.readOnGadget(defaultInstance);
+        assignConverters(&property);
+        properties.append(property);
     }
-    delete other;
-    return ret;
+
+    if (defaultInstance)
+        metaType.destroy(defaultInstance);
+
+    if (metaObject->inherits(&QMcpAnyOf::staticMetaObject))
+        buildDiscriminatorIndex(this);
+    else
+        serializer = findSerializer(this);
 }
+
+const QMcpGadgetPlan *QMcpGadgetPlan::get(const QMetaObject *metaObject, QtMcp::ProtocolVersion protocolVersion)
+{
+    const PlanKey key { metaObject, protocolVersion };
+    auto *cache = planCache();
+    {
+        QReadLocker locker(&cache->lock);
+        if (const auto *plan = cache->plans.value(key))
+            return plan;
+    }
+
+    // built outside of the lock, constructing the default instance may serialize
+    auto *plan = new QMcpGadgetPlan(metaObject, protocolVersion);
+    QWriteLocker locker(&cache->lock);
+    auto &slot = cache->plans[key];
+    if (slot)
+        delete plan;
+    else
+        slot = plan;
+    return slot;
 }
 
-QJsonObject QMcpGadget::toJsonObject(QtMcp::ProtocolVersion protocolVersion) const
+bool QMcpGadget::fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion protocolVersion)
 {
-    QJsonObject ret;
-    const auto mo = metaObject();
-    const auto indices = requiredOrModifiedPropertyIndices(this);
-    for (int i : indices) {
-        const auto mp = mo->property(i);
-        const auto mt = mp.metaType();
-        const auto name = QString::fromLatin1(mp.name());
-        auto value = mp.readOnGadget(this);
-
-        // Handle QList types first to ensure empty lists are properly serialized
-        if (QString::fromUtf8(mt.name()).startsWith(QStringLiteral("QList<")) ||
-            QString::fromUtf8(mt.name()).endsWith(QStringLiteral("List"))) {
-            // Always convert to a JSON array even if the list is empty
-            QJsonArray array;
-            if (value.canConvert<QVariantList>()) {
-                const QVariantList list = value.toList();
-                for (const auto &item : list) {
-                    const QMetaType itemType = item.metaType();
-                    switch (itemType.id()) {
-                    case QMetaType::QByteArray:
-                        array.append(QString::fromUtf8(item.toByteArray()));
-                        break;
-                    default:
-                        if (itemType.flags() & QMetaType::IsEnumeration) {
-                            const auto mo = itemType.metaObject();
-                            for (int i = 0; i < mo->enumeratorCount(); i++) {
-                                const auto me = mo->enumerator(i);
-                                if (itemType.name() == QByteArray(mo->className()) + "::" + me.enumName()) {
-                                    const auto v = item.toInt();
-                                    array.append(QString::fromUtf8(me.valueToKey(v)));
-                                    break;
-                                }
-                            }
-                        } else if (item.canConvert<QMcpGadget>()) {
-                            const auto gadget = reinterpret_cast<const QMcpGadget *>(item.constData());
-                            const auto object = gadget->toJsonObject(protocolVersion);
-                            array.append(object);
-                        } else if (item.canConvert<QMcpGadget *>()) {
-                            const auto gadget = item.value<QMcpGadget *>();
-                            const auto object = gadget->toJsonObject(protocolVersion);
-                            array.append(object);
-                        } else {
-                            array.append(item.toJsonValue());
-                        }
-                        break;
-                    }
-                }
-            }
-            ret.insert(name, array);
+    const auto *plan = QMcpGadgetPlan::get(metaObject(), protocolVersion);
+    for (const auto &property : plan->properties) {
+        if (property.constant)
+            continue;
+        const auto it = object.constFind(property.key);
+        if (it == object.constEnd()) {
+            if (property.required)
+                return false;
             continue;
         }
 
-        // Handle other types
-        switch (mt.id()) {
-        case QMetaType::Bool:
-        case QMetaType::Int:
-        case QMetaType::QString:
-        case QMetaType::QJsonObject:
-        case QMetaType::QJsonValue:
-        case QMetaType::QVariant:
-            break;
-        case QMetaType::QByteArray:
-            value = QString::fromUtf8(value.toByteArray());
-            break;
-        case QMetaType::QUrl:
-            value = value.toUrl().toString();
-            break;
-        default:
-            if (mt.id() == qMetaTypeId<QtMcp::ProtocolVersion>()) {
-                auto enumValue = value.value<QtMcp::ProtocolVersion>();
-                value = QtMcp::protocolVersionToString(enumValue);
-            } else if (mt.flags() & QMetaType::IsEnumeration) {
-                // Handle other enum types using meta object system
-                const auto mo = mt.metaObject();
-                if (mo) { // Check if meta object is valid
-                    for (int i = 0; i < mo->enumeratorCount(); i++) {
-                        const auto me = mo->enumerator(i);
-                        if (mt.name() == QByteArray(mo->className()) + "::" + me.enumName()) {
-                            const auto v = value.toInt();
-                            value = QString::fromUtf8(me.valueToKey(v));
-                            break;
-                        }
-                    }
-                }
-            } else if (value.canConvert<QMcpGadget>()) {
-                const auto *gadget = reinterpret_cast<const QMcpGadget *>(value.constData());
-                const auto object = gadget->toJsonObject(protocolVersion);
-                value = object.toVariantMap();
-            }
-        }
-        ret.insert(name, value.toJsonValue());
+        const auto value = it.value();
+        if (value.isUndefined())
+            continue;
+        if (!property.fromJson(property, this, value, protocolVersion))
+            return false;
+    }
+    return true;
+}
+
+QJsonObject QMcpGadget::toJsonObject(QtMcp::ProtocolVersion protocolVersion) const
+{
+    QJsonObject ret;
+    const auto *plan = QMcpGadgetPlan::get(metaObject(), protocolVersion);
+    const auto modified = d<Private>()->modified;
+    if (plan->serializer)
+        return plan->serializer->toJsonObject(this, modified, protocolVersion);
+    QVariant value;
+    for (const auto &property : plan->properties) {
+        if (readSerializedValue(plan, property, modified, this, &value))
+            ret.insert(property.key, property.toJson(property, value, protocolVersion));
     }
     return ret;
 }
 
+/*!
+    Writes the gadget as a JSON object to \a writer without building a
+    QJsonObject first. The same properties as in toJsonObject() are written.
+*/
+void QMcpGadget::writeJson(QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion) const
+{
+    const auto *plan = QMcpGadgetPlan::get(metaObject(), protocolVersion);
+    const auto modified = d<Private>()->modified;
+    if (plan->serializer) {
+        plan->serializer->writeJson(this, modified, writer, protocolVersion);
+        return;
+    }
+    QVariant value;
+    writer.beginObject();
+    for (const auto &property : plan->properties) {
+        if (writeJsonProperty(writer, property.metaProperty, protocolVersion))
+            continue;
+        if (!readSerializedValue(plan, property, modified, this, &value))
+            continue;
+        writer.writeKey(property.key);
+        writeJsonValue(writer, property, property.kind, value, protocolVersion);
+    }
+    writer.endObject();
+}
+
+/*!
+    Called by writeJson() before each \a property is written to \a writer.
+
+    Reimplement to write the key and the value of a property without reading
+    it through its getter first, for example to stream a large payload into
+    the writer. Return \c true if the property was written, \c false to let
+    writeJson() write it as usual.
+*/
+bool QMcpGadget::writeJsonProperty(QMcpJsonWriter &writer, const QMetaProperty &property, QtMcp::ProtocolVersion protocolVersion) const
+{
+    Q_UNUSED(writer);
+    Q_UNUSED(property);
+    Q_UNUSED(protocolVersion);
+    return false;
+}
+
+/*!
+    \relates QMcpGadget
+
+    Returns the hash value for \a gadget, using \a seed to seed the
+    calculation.
+
+    The members of the gadget are hashed once and the result is kept until
+    the gadget is modified. Members holding request IDs, progress tokens or
+    images are compared by operator==() but not hashed.
+*/
+size_t qHash(const QMcpGadget &gadget, size_t seed)
+{
+    const auto *d = gadget.data.constData();
+    auto hash = d->cachedHash.load(std::memory_order_relaxed);
+    if (!hash) {
+        // 0 marks a hash not computed yet
+        hash = d->hash(0);
+        if (!hash)
+            hash = 1;
+        d->cachedHash.store(hash, std::memory_order_relaxed);
+    }
+    return qHashMulti(seed, hash);
+}
+
 QT_END_NAMESPACE
@@ -5,14 +5,23 @@
 #define QMCPGADGET_H
 
 #include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtMcpCommon/qmcpgadgetarena.h>
+#include <QtCore/qhashfunctions.h>
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qmetaobject.h>
 #include <QtCore/qshareddata.h>
 #include <QtCore/qmetatype.h>
 #include <QtMcpCommon/qtmcpnamespace.h>
 
+#include <atomic>
+
 QT_BEGIN_NAMESPACE
 
+class QMcpGadget;
+class QMcpJsonWriter;
+
+Q_MCPCOMMON_EXPORT size_t qHash(const QMcpGadget &gadget, size_t seed = 0);
+
 #if 1
 #include <QtCore/qshareddata.h>
 #define SharedDataPointer QSharedDataPointer
@@ -141,6 +150,38 @@ Q_OUTOFLINE_TEMPLATE void SharedDataPointer<T>::detach_helper()
     d.reset(x);
 }
 #endif
+/*! \class QMcpGadget
+    \inmodule QtMcpCommon
+    \brief Base class of the implicitly shared MCP data types.
+
+    Besides a getter and a setter per property, properties holding strings,
+    JSON values, lists or other gadgets have a setter taking an rvalue and a
+    take accessor that moves the value out and leaves a default constructed,
+    unmodified one behind. List properties also have append and emplace
+    mutators that add a single element in place. This allows building
+    nested values without copying them:
+
+    \code
+    auto params = notification.takeParams();
+    params.setUri(uri);
+    notification.setParams(std::move(params));
+
+    result.emplaceTool().setName(u"echo"_s);
+    \endcode
+
+    The reference returned by an emplace mutator is only valid until the
+    gadget is copied, hashed or modified again.
+
+    An rvalue setter compares the new value with the current one only while
+    the property is unmodified, so that setting the default does not mark
+    it. Once the property is modified, the value is moved in unconditionally.
+    QMcpBuilder chains these setters to build a gadget in one expression.
+
+    Gadgets are compared and hashed member by member, without reading the
+    properties into QVariant. The hash is computed on first use and kept
+    until the gadget is modified, so gadgets work well as QHash keys and
+    gadgets with different hashes compare unequal right away.
+*/
 class Q_MCPCOMMON_EXPORT QMcpGadget
 {
     Q_GADGET
@@ -148,8 +189,29 @@ protected:
     class Private : public QSharedData
     {
     public:
+        Private() = default;
+        Private(const Private &other)
+            : QSharedData(other)
+            , modified(other.modified)
+        {}
         virtual ~Private() = default;
         virtual Private *clone() const { return new Private(*this); }
+
+        // overridden by every Private adding members
+        virtual bool equals(const Private &other) const {
+            Q_UNUSED(other);
+            return true;
+        }
+        virtual size_t hash(size_t seed) const { return seed; }
+
+        // taken from the active QMcpGadgetArena or a per-thread pool
+        static void *operator new(std::size_t size) { return QMcpGadgetArena::allocate(size); }
+        static void operator delete(void *block) noexcept { QMcpGadgetArena::deallocate(block); }
+
+        // one bit per property index, set by the setters
+        quint64 modified = 0;
+        // memoized result of hash(0), 0 until computed, reset on detach
+        mutable std::atomic<size_t> cachedHash = 0;
     };
 
     explicit QMcpGadget(Private *d)
@@ -170,25 +232,27 @@ public:
         if (typeid(*this) != typeid(other)) {
             return false;
         }
-        if (data == other.data) {
+        const auto *lhs = data.constData();
+        const auto *rhs = other.data.constData();
+        if (lhs == rhs) {
             return true;
         }
-        const auto mo = metaObject();
-        for (int i = 0; i < mo->propertyCount(); ++i) {
-            const auto property = mo->property(i);
-            const auto value = property.readOnGadget(&other);
-            if (value != property.readOnGadget(this)) {
-                return false;
-            }
+        const auto lhsHash = lhs->cachedHash.load(std::memory_order_relaxed);
+        const auto rhsHash = rhs->cachedHash.load(std::memory_order_relaxed);
+        if (lhsHash && rhsHash && lhsHash != rhsHash) {
+            return false;
         }
-        return true;
+        return lhs->equals(*rhs);
     }
 
     virtual bool fromJsonObject(const QJsonObject &object, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
     virtual QJsonObject toJsonObject(QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const;
+    virtual void writeJson(QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const;
     virtual const QMetaObject* metaObject() const { return &staticMetaObject; }
 
 protected:
+    virtual bool writeJsonProperty(QMcpJsonWriter &writer, const QMetaProperty &property, QtMcp::ProtocolVersion protocolVersion) const;
+
     template<typename DerivedData>
     const DerivedData *d() const {
         const DerivedData *ret = static_cast<const DerivedData *>(data.constData());
@@ -209,12 +273,32 @@ protected:
         }
         DerivedData *ret = static_cast<DerivedData *>(data.data());
         // qDebug() << __PRETTY_FUNCTION__ << __LINE__ << ret;
+        // the caller is about to modify the data
+        ret->cachedHash.store(0, std::memory_order_relaxed);
         return ret;
     }
 
+    void setModified(int propertyIndex) {
+        Q_ASSERT(propertyIndex >= 0 && propertyIndex < 64);
+        d<Private>()->modified |= quint64(1) << propertyIndex;
+    }
+
+    // take accessors leave a default value behind, which is not serialized
+    void clearModified(int propertyIndex) {
+        Q_ASSERT(propertyIndex >= 0 && propertyIndex < 64);
+        d<Private>()->modified &= ~(quint64(1) << propertyIndex);
+    }
+
+    bool isModified(int propertyIndex) const {
+        Q_ASSERT(propertyIndex >= 0 && propertyIndex < 64);
+        return d<Private>()->modified & (quint64(1) << propertyIndex);
+    }
+
 private:
     SharedDataPointer<Private> data;
 
+    friend Q_MCPCOMMON_EXPORT size_t qHash(const QMcpGadget &gadget, size_t seed);
+
     template <typename T>
     friend auto operator<<(QDebug debug, const T &gadget) -> std::enable_if_t<std::is_base_of_v<QMcpGadget, T>, QDebug> {
         QDebugStateSaver saver(debug);
@@ -0,0 +1,110 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPGADGET_P_H
+#define QMCPGADGET_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpCommon/qmcpgadget.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmetaobject.h>
+#include <QtCore/qspan.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_MCPCOMMON_EXPORT QMcpGadgetPlan
+{
+public:
+    enum class Kind : quint8 {
+        Other,
+        Bool,
+        Int,
+        Double,
+        String,
+        ByteArray,
+        Url,
+        JsonObject,
+        JsonValue,
+        Variant,
+        ProtocolVersion,
+        Enum,
+        Gadget,
+        GadgetPointer,
+        List,
+    };
+
+    struct Property;
+    using ToJson = QJsonValue (*)(const Property &property, const QVariant &value, QtMcp::ProtocolVersion protocolVersion);
+    using FromJson = bool (*)(const Property &property, QMcpGadget *gadget, const QJsonValue &value, QtMcp::ProtocolVersion protocolVersion);
+
+    struct Property {
+        QMetaProperty metaProperty;
+        int index = -1;
+        QString key;
+        Kind kind = Kind::Other;
+        // element description, valid for Kind::List only
+        Kind elementKind = Kind::Other;
+        QMetaType elementType;
+        // valid for Kind::Enum and lists of enums
+        QMetaEnum metaEnum;
+        bool required = false;
+        bool constant = false;
+        // QByteArray holding base64 text, written as a byte string to CBOR
+        bool base64 = false;
+        QVariant defaultValue;
+        ToJson toJson = nullptr;
+        FromJson fromJson = nullptr;
+    };
+
+    // A property written by a generated serializer
+    struct SerializedProperty {
+        const char *key;
+        int index;
+        bool required;
+    };
+
+    // toJsonObject() and writeJson() generated for a class and version by
+    // generate_schema.cmake, reading the properties through their getters
+    struct Serializer {
+        const QMetaObject *metaObject;
+        QtMcp::ProtocolVersion protocolVersion;
+        QSpan<const SerializedProperty> properties;
+        QJsonObject (*toJsonObject)(const QMcpGadget *gadget, quint64 modified, QtMcp::ProtocolVersion protocolVersion);
+        void (*writeJson)(const QMcpGadget *gadget, quint64 modified, QMcpJsonWriter &writer, QtMcp::ProtocolVersion protocolVersion);
+    };
+
+    const QMetaObject *metaObject = nullptr;
+    QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest;
+    // only the properties that exist in protocolVersion
+    QList<Property> properties;
+    // true when every class declaring properties marks them in its setters
+    bool tracksModified = false;
+    // the generated serializer when it writes exactly these properties
+    const Serializer *serializer = nullptr;
+
+    // QMcpAnyOf only: the constant member ("method" or "type") telling the
+    // alternatives apart, and the property index of each of its values
+    QString discriminator;
+    QHash<QString, int> alternatives;
+
+    static const QMcpGadgetPlan *get(const QMetaObject *metaObject, QtMcp::ProtocolVersion protocolVersion);
+
+private:
+    QMcpGadgetPlan(const QMetaObject *metaObject, QtMcp::ProtocolVersion protocolVersion);
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPGADGET_P_H
@@ -0,0 +1,215 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpgadgetarena.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <cstdlib>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// the chunks of regions whose arena is gone
+QBasicAtomicInteger<qsizetype> retainedBytes = Q_BASIC_ATOMIC_INITIALIZER(0);
+}
+
+struct QMcpGadgetArenaRegion
+{
+    ~QMcpGadgetArenaRegion()
+    {
+        if (retained)
+            retainedBytes.fetchAndSubRelaxed(chunkBytes());
+        for (void *chunk : chunks)
+            std::free(chunk);
+    }
+
+    void *allocate(std::size_t size);
+    void deref()
+    {
+        if (!ref.deref())
+            delete this;
+    }
+
+    qsizetype chunkBytes() const;
+
+    // one for the arena plus one per live block
+    QAtomicInt ref = 1;
+    // set when the arena is destroyed
+    bool retained = false;
+    QVarLengthArray<void *, 8> chunks;
+    char *next = nullptr;
+    char *end = nullptr;
+    qsizetype size = 0;
+};
+
+namespace {
+// precedes every block and tells where it came from
+struct alignas(std::max_align_t) Header
+{
+    QMcpGadgetArenaRegion *region;
+    int sizeClass;
+};
+
+constexpr std::size_t granularity = alignof(std::max_align_t);
+// blocks up to 16 granules are pooled per thread
+constexpr int sizeClassCount = 16;
+constexpr qsizetype maxPooledPerClass = 256;
+constexpr std::size_t chunkSize = 4096;
+// larger blocks would waste too much of a chunk
+constexpr std::size_t maxArenaBlock = chunkSize / 4;
+
+struct Pool
+{
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    ~Pool();
+
+    FreeBlock *lists[sizeClassCount] = {};
+    qsizetype counts[sizeClassCount] = {};
+};
+
+// trivially destructible, so it stays readable while thread locals and
+// statics holding gadgets are destroyed
+thread_local bool poolDestroyed = false;
+thread_local Pool pool;
+thread_local QMcpGadgetArena *currentArena = nullptr;
+
+Pool::~Pool()
+{
+    for (auto *&list : lists) {
+        while (list)
+            std::free(std::exchange(list, list->next));
+    }
+    poolDestroyed = true;
+}
+
+void *takePooled(int sizeClass)
+{
+    if (poolDestroyed)
+        return nullptr;
+    auto *block = pool.lists[sizeClass];
+    if (block) {
+        pool.lists[sizeClass] = block->next;
+        pool.counts[sizeClass]--;
+    }
+    return block;
+}
+
+bool putPooled(void *block, int sizeClass)
+{
+    if (poolDestroyed || pool.counts[sizeClass] >= maxPooledPerClass)
+        return false;
+    auto *freeBlock = static_cast<Pool::FreeBlock *>(block);
+    freeBlock->next = pool.lists[sizeClass];
+    pool.lists[sizeClass] = freeBlock;
+    pool.counts[sizeClass]++;
+    return true;
+}
+}
+
+qsizetype QMcpGadgetArenaRegion::chunkBytes() const
+{
+    return chunks.size() * qsizetype(chunkSize);
+}
+
+void *QMcpGadgetArenaRegion::allocate(std::size_t size)
+{
+    if (std::size_t(end - next) < size) {
+        next = static_cast<char *>(std::malloc(chunkSize));
+        Q_CHECK_PTR(next);
+        end = next + chunkSize;
+        chunks.append(next);
+    }
+    void *block = next;
+    next += size;
+    this->size += size;
+    return block;
+}
+
+/*!
+    Creates an arena used by the gadgets created on the current thread
+    until it is destroyed.
+*/
+QMcpGadgetArena::QMcpGadgetArena()
+    : region(new QMcpGadgetArenaRegion)
+    , previous(std::exchange(currentArena, this))
+{}
+
+/*!
+    Stops using the arena. Its memory is released once no gadget allocated
+    from it is left.
+*/
+QMcpGadgetArena::~QMcpGadgetArena()
+{
+    Q_ASSERT(currentArena == this);
+    currentArena = previous;
+    // counted until the last gadget releases the region
+    region->retained = true;
+    retainedBytes.fetchAndAddRelaxed(region->chunkBytes());
+    region->deref();
+}
+
+/*!
+    Returns the number of bytes allocated from the arena so far.
+*/
+qsizetype QMcpGadgetArena::size() const
+{
+    return region->size;
+}
+
+/*!
+    Returns the number of bytes of the arenas that were destroyed but are
+    still used by gadgets allocated from them, on all threads.
+*/
+qsizetype QMcpGadgetArena::retainedSize()
+{
+    return retainedBytes.loadRelaxed();
+}
+
+void *QMcpGadgetArena::allocate(std::size_t size)
+{
+    const std::size_t total = (sizeof(Header) + size + granularity - 1) / granularity * granularity;
+
+    Header *header = nullptr;
+    if (currentArena && total <= maxArenaBlock) {
+        auto *region = currentArena->region;
+        header = static_cast<Header *>(region->allocate(total));
+        region->ref.ref();
+        header->region = region;
+        header->sizeClass = sizeClassCount;
+        return header + 1;
+    }
+
+    const int sizeClass = int(total / granularity) - 1;
+    if (sizeClass < sizeClassCount)
+        header = static_cast<Header *>(takePooled(sizeClass));
+    if (!header) {
+        header = static_cast<Header *>(std::malloc(total));
+        Q_CHECK_PTR(header);
+    }
+    header->region = nullptr;
+    header->sizeClass = sizeClass;
+    return header + 1;
+}
+
+void QMcpGadgetArena::deallocate(void *block) noexcept
+{
+    if (!block)
+        return;
+    auto *header = static_cast<Header *>(block) - 1;
+    if (header->region) {
+        header->region->deref();
+        return;
+    }
+    if (header->sizeClass < sizeClassCount && putPooled(header, header->sizeClass))
+        return;
+    std::free(header);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPGADGETARENA_H
+#define QMCPGADGETARENA_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+
+#include <cstddef>
+
+QT_BEGIN_NAMESPACE
+
+class QMcpGadget;
+struct QMcpGadgetArenaRegion;
+
+/*! \class QMcpGadgetArena
+    \inmodule QtMcpCommon
+    \brief Allocates the data of gadgets created while handling one message.
+
+    While a QMcpGadgetArena exists, the data of every gadget created or
+    detached on the same thread is carved out of a few large memory chunks
+    instead of being allocated one by one. This typically covers the parsed
+    request, its nested parameters and the result built for it.
+
+    \code
+    {
+        QMcpGadgetArena arena;
+        QMcpCallToolRequest request;
+        request.fromJsonObject(object);
+        ...
+    } // the chunks are released here
+    \endcode
+
+    The chunks are released together once the arena is destroyed and the
+    last gadget allocated from it is gone. Gadgets may therefore outlive the
+    arena, but keep its chunks alive until they are destroyed. Gadgets meant
+    to live long should be created outside of an arena. retainedSize() tells
+    how much memory such gadgets hold on to.
+
+    Without an arena, the data of small gadgets comes from a per-thread pool
+    of recently freed blocks.
+
+    Arenas nest; the innermost one on the current thread is used.
+*/
+class Q_MCPCOMMON_EXPORT QMcpGadgetArena
+{
+public:
+    QMcpGadgetArena();
+    ~QMcpGadgetArena();
+
+    qsizetype size() const;
+    static qsizetype retainedSize();
+
+private:
+    Q_DISABLE_COPY_MOVE(QMcpGadgetArena)
+
+    friend class QMcpGadget;
+    static void *allocate(std::size_t size);
+    static void deallocate(void *block) noexcept;
+
+    QMcpGadgetArenaRegion *region;
+    QMcpGadgetArena *previous;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPGADGETARENA_H
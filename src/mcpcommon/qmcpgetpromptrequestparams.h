@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpGetPromptRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpGetPromptRequestParams::arguments
@@ -39,6 +40,18 @@ public:
     void setArguments(const QJsonObject &value) {
         if (arguments() == value) return;
         d<Private>()->arguments = value;
+        setModified(argumentsIndex());
+    }
+
+    void setArguments(QJsonObject &&value) {
+        if (!isModified(argumentsIndex()) && arguments() == value) return;
+        d<Private>()->arguments = std::move(value);
+        setModified(argumentsIndex());
+    }
+
+    QJsonObject takeArguments() {
+        clearModified(argumentsIndex());
+        return std::exchange(d<Private>()->arguments, QJsonObject());
     }
 
     QString name() const {
@@ -48,6 +61,18 @@ public:
     void setName(const QString &value) {
         if (name() == value) return;
         d<Private>()->name = value;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&value) {
+        if (!isModified(nameIndex()) && name() == value) return;
+        d<Private>()->name = std::move(value);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -55,10 +80,30 @@ public:
     }
 
 private:
+    static int argumentsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("arguments");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QJsonObject arguments;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && arguments == that.arguments
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), arguments, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPGETPROMPTREQUESTVIEW_H
+#define QMCPGETPROMPTREQUESTVIEW_H
+
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpgetpromptrequest.h>
+#include <QtMcpCommon/qmcpgetpromptrequestparamsview.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpGetPromptRequestView
+    \inmodule QtMcpCommon
+    \brief Read-only view over the JSON of a \l QMcpGetPromptRequest.
+*/
+class QMcpGetPromptRequestView : public QMcpJsonRequestView<QMcpGetPromptRequestParamsView>
+{
+public:
+    using Gadget = QMcpGetPromptRequest;
+    using QMcpJsonRequestView::QMcpJsonRequestView;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPGETPROMPTREQUESTVIEW_H
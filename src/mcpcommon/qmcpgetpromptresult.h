@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpGetPromptResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpGetPromptResult::description
@@ -39,6 +40,18 @@ public:
     void setDescription(const QString &value) {
         if (description() == value) return;
         d<Private>()->description = value;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&value) {
+        if (!isModified(descriptionIndex()) && description() == value) return;
+        d<Private>()->description = std::move(value);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QList<QMcpPromptMessage> messages() const {
@@ -48,6 +61,34 @@ public:
     void setMessages(const QList<QMcpPromptMessage> &value) {
         if (messages() == value) return;
         d<Private>()->messages = value;
+        setModified(messagesIndex());
+    }
+
+    void setMessages(QList<QMcpPromptMessage> &&value) {
+        if (!isModified(messagesIndex()) && messages() == value) return;
+        d<Private>()->messages = std::move(value);
+        setModified(messagesIndex());
+    }
+
+    QList<QMcpPromptMessage> takeMessages() {
+        clearModified(messagesIndex());
+        return std::exchange(d<Private>()->messages, QList<QMcpPromptMessage>());
+    }
+
+    void appendMessage(const QMcpPromptMessage &message) {
+        d<Private>()->messages.append(message);
+        setModified(messagesIndex());
+    }
+
+    void appendMessage(QMcpPromptMessage &&message) {
+        d<Private>()->messages.append(std::move(message));
+        setModified(messagesIndex());
+    }
+
+    template <typename... Args>
+    QMcpPromptMessage &emplaceMessage(Args &&...args) {
+        setModified(messagesIndex());
+        return d<Private>()->messages.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -55,10 +96,30 @@ public:
     }
 
 private:
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int messagesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("messages");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString description;
         QList<QMcpPromptMessage> messages;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && description == that.description
+                && messages == that.messages;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), description, messages);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
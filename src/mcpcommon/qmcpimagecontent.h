@@ -7,11 +7,14 @@
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 #include <QtMcpCommon/qmcpannotations.h>
+#include <QtMcpCommon/qmcpbase64.h>
 #include <QtMcpCommon/qmcpgadget.h>
 
 #ifdef QT_GUI_LIB
 #include <QtCore/QBuffer>
+#include <QtCore/QMutex>
 #include <QtGui/QImage>
+#include <QtMcpCommon/qmcpjsonwriter.h>
 #endif
 
 QT_BEGIN_NAMESPACE
@@ -19,10 +22,19 @@ QT_BEGIN_NAMESPACE
 /*! \class QMcpImageContent
     \inmodule QtMcpCommon
     \brief An image provided to or from an LLM.
+
+    An image content constructed from a QImage keeps the image and encodes
+    it only when the data is needed. When the content is serialized with
+    QMcpJsonWriter, the encoded image is streamed into the output without
+    intermediate copies. Call encode() to encode the image ahead of time,
+    for example on a worker thread. Otherwise the image is encoded the first
+    time data() is called, and the result is kept for later calls.
 */
 class Q_MCPCOMMON_EXPORT QMcpImageContent : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
+    Q_CLASSINFO("QMcpBase64:data", "true")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
 
@@ -43,16 +55,53 @@ class Q_MCPCOMMON_EXPORT QMcpImageContent : public QMcpGadget
 public:
     QMcpImageContent() : QMcpGadget(new Private) {}
 #ifdef QT_GUI_LIB
-    QMcpImageContent(const QImage &image)
+    QMcpImageContent(const QImage &image, const QByteArray &format = QByteArrayLiteral("PNG"), int quality = -1)
         : QMcpGadget(new Private) {
-        setMimeType(QStringLiteral("image/png"));
-        QByteArray data;
-        QBuffer buffer(&data);
-        if (buffer.open(QBuffer::WriteOnly)) {
-            if (image.save(&buffer, "PNG")) {
-                setData(data.toBase64());
-            }
-        }
+        setImage(image, format, quality);
+    }
+
+    /*!
+        Returns the image that is not encoded yet, or a null image.
+    */
+    QImage image() const {
+        return d<Private>()->image;
+    }
+
+    /*!
+        Sets \a image to be encoded in \a format when the data is needed.
+        The mime type is set to match \a format.
+
+        \a quality is passed to QImage::save(). For PNG it selects the
+        compression level, where higher values encode faster into larger
+        files; for JPEG it is the image quality.
+    */
+    void setImage(const QImage &image, const QByteArray &format = QByteArrayLiteral("PNG"), int quality = -1) {
+        d<Private>()->image = image;
+        d<Private>()->format = format;
+        d<Private>()->quality = quality;
+        d<Private>()->data.clear();
+        d<Private>()->encoded.clear();
+        auto subtype = QString::fromLatin1(format).toLower();
+        if (subtype == "jpg"_L1)
+            subtype = QStringLiteral("jpeg");
+        setMimeType("image/"_L1 + subtype);
+        setModified(dataIndex());
+    }
+
+    /*!
+        Encodes the pending image into the data property now.
+        Returns \c false if the image could not be encoded.
+    */
+    bool encode() {
+        if (!hasPendingImage())
+            return true;
+        auto data = encodedImage();
+        if (data.isEmpty())
+            return false;
+        d<Private>()->data = std::move(data);
+        d<Private>()->image = QImage();
+        d<Private>()->encoded.clear();
+        return true;
     }
 #endif
 
@@ -63,15 +112,45 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     QByteArray data() const {
+#ifdef QT_GUI_LIB
+        if (hasPendingImage())
+            return encodedImage();
+#endif
         return d<Private>()->data;
     }
 
+    QByteArray decodedData() const {
+        return QMcpBase64::decode(data());
+    }
+
     void setData(const QByteArray &data) {
+#ifdef QT_GUI_LIB
+        if (hasPendingImage()) {
+            d<Private>()->image = QImage();
+            d<Private>()->encoded.clear();
+        } else if (this->data() == data) {
+            return;
+        }
+#else
         if (this->data() == data) return;
+#endif
         d<Private>()->data = data;
+        setModified(dataIndex());
     }
 
     QString mimeType() const {
@@ -81,6 +160,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     static QByteArray type() { return QByteArrayLiteral("image"); }
@@ -89,11 +180,112 @@ public:
         return &staticMetaObject;
     }
 
+#ifdef QT_GUI_LIB
+protected:
+    bool writeJsonProperty(QMcpJsonWriter &writer, const QMetaProperty &property, QtMcp::ProtocolVersion protocolVersion) const override {
+        if (property.propertyIndex() != dataIndex() || !hasPendingImage())
+            return QMcpGadget::writeJsonProperty(writer, property, protocolVersion);
+        writer.writeKey("data"_L1);
+        writer.writeBase64([this](QIODevice *device) {
+            return d<Private>()->image.save(device, d<Private>()->format.constData(), d<Private>()->quality);
+        });
+        return true;
+    }
+#endif
+
 private:
+    static int dataIndex() {
+        static const int index = staticMetaObject.indexOfProperty("data");
+        return index;
+    }
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+
+#ifdef QT_GUI_LIB
+    bool hasPendingImage() const {
+        return !d<Private>()->image.isNull();
+    }
+
+    QByteArray encodeImage() const {
+        QByteArray encoded;
+        QBuffer buffer(&encoded);
+        if (!buffer.open(QBuffer::WriteOnly))
+            return QByteArray();
+        if (!d<Private>()->image.save(&buffer, d<Private>()->format.constData(), d<Private>()->quality))
+            return QByteArray();
+        return QMcpBase64::encode(encoded);
+    }
+
+    // encodes the pending image once; copies sharing the data share the result
+    QByteArray encodedImage() const {
+        const auto *d = this->d<Private>();
+        QMutexLocker locker(&d->encodedMutex);
+        if (d->encoded.isEmpty())
+            d->encoded = encodeImage();
+        return d->encoded;
+    }
+#endif
+
     struct Private : public QMcpGadget::Private {
+        Private() = default;
+        Private(const Private &other)
+            : QMcpGadget::Private(other)
+            , annotations(other.annotations)
+            , data(other.data)
+            , mimeType(other.mimeType)
+#ifdef QT_GUI_LIB
+            , image(other.image)
+            , format(other.format)
+            , quality(other.quality)
+            , encoded(other.encodedCopy())
+#endif
+        {}
+
         QMcpAnnotations annotations;
         QByteArray data;
         QString mimeType;
+#ifdef QT_GUI_LIB
+        QImage image;
+        QByteArray format;
+        int quality = -1;
+        // the data of image, memoized by encodedImage()
+        mutable QByteArray encoded;
+        mutable QMutex encodedMutex;
+
+        QByteArray encodedCopy() const {
+            QMutexLocker locker(&encodedMutex);
+            return encoded;
+        }
+#endif
+
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations
+                && data == that.data
+                && mimeType == that.mimeType
+#ifdef QT_GUI_LIB
+                && image == that.image
+                && format == that.format
+                && quality == that.quality
+#endif
+                ;
+        }
+
+        size_t hash(size_t seed) const override {
+            seed = qHashMulti(QMcpGadget::Private::hash(seed), annotations, data, mimeType);
+#ifdef QT_GUI_LIB
+            // the image itself is not hashed, it is compared by equals()
+            seed = qHashMulti(seed, format, quality);
+#endif
+            return seed;
+        }
 
         Private *clone() const override { return new Private(*this); }
     };
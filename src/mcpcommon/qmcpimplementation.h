@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpImplementation : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString name READ name WRITE setName REQUIRED)
     Q_PROPERTY(QString version READ version WRITE setVersion REQUIRED)
@@ -30,6 +31,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     QString version() const {
@@ -39,6 +52,18 @@ public:
     void setVersion(const QString &version) {
         if (this->version() == version) return;
         d<Private>()->version = version;
+        setModified(versionIndex());
+    }
+
+    void setVersion(QString &&version) {
+        if (!isModified(versionIndex()) && this->version() == version) return;
+        d<Private>()->version = std::move(version);
+        setModified(versionIndex());
+    }
+
+    QString takeVersion() {
+        clearModified(versionIndex());
+        return std::exchange(d<Private>()->version, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -46,10 +71,30 @@ public:
     }
 
 private:
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+    static int versionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("version");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString name;
         QString version;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && name == that.name
+                && version == that.version;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), name, version);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpInitializedNotification : public QMcpNotification
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString method READ method CONSTANT REQUIRED)
     Q_PROPERTY(QMcpInitializedNotificationParams params READ params WRITE setParams)
@@ -34,6 +35,18 @@ public:
     void setParams(const QMcpInitializedNotificationParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpInitializedNotificationParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpInitializedNotificationParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpInitializedNotificationParams());
     }
 
     const QMetaObject* metaObject() const override {
@@ -41,9 +54,24 @@ public:
     }
 
 private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
     struct Private : public QMcpNotification::Private {
         QMcpInitializedNotificationParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotification::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotification::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
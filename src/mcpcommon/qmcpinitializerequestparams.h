@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpInitializeRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpClientCapabilities capabilities READ capabilities WRITE setCapabilities REQUIRED)
     Q_PROPERTY(QMcpImplementation clientInfo READ clientInfo WRITE setClientInfo REQUIRED)
@@ -38,6 +39,18 @@ public:
     void setCapabilities(const QMcpClientCapabilities &capabilities) {
         if (this->capabilities() == capabilities) return;
         d<Private>()->capabilities = capabilities;
+        setModified(capabilitiesIndex());
+    }
+
+    void setCapabilities(QMcpClientCapabilities &&capabilities) {
+        if (!isModified(capabilitiesIndex()) && this->capabilities() == capabilities) return;
+        d<Private>()->capabilities = std::move(capabilities);
+        setModified(capabilitiesIndex());
+    }
+
+    QMcpClientCapabilities takeCapabilities() {
+        clearModified(capabilitiesIndex());
+        return std::exchange(d<Private>()->capabilities, QMcpClientCapabilities());
     }
 
     QMcpImplementation clientInfo() const {
@@ -47,6 +60,18 @@ public:
     void setClientInfo(const QMcpImplementation &clientInfo) {
         if (this->clientInfo() == clientInfo) return;
         d<Private>()->clientInfo = clientInfo;
+        setModified(clientInfoIndex());
+    }
+
+    void setClientInfo(QMcpImplementation &&clientInfo) {
+        if (!isModified(clientInfoIndex()) && this->clientInfo() == clientInfo) return;
+        d<Private>()->clientInfo = std::move(clientInfo);
+        setModified(clientInfoIndex());
+    }
+
+    QMcpImplementation takeClientInfo() {
+        clearModified(clientInfoIndex());
+        return std::exchange(d<Private>()->clientInfo, QMcpImplementation());
     }
 
     QtMcp::ProtocolVersion protocolVersion() const {
@@ -56,6 +81,7 @@ public:
     void setProtocolVersion(QtMcp::ProtocolVersion version) {
         if (this->protocolVersion() == version) return;
         d<Private>()->protocolVersion = version;
+        setModified(protocolVersionIndex());
     }
     
     // For backward compatibility
@@ -68,11 +94,36 @@ public:
     }
 
 private:
+    static int capabilitiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("capabilities");
+        return index;
+    }
+    static int clientInfoIndex() {
+        static const int index = staticMetaObject.indexOfProperty("clientInfo");
+        return index;
+    }
+    static int protocolVersionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("protocolVersion");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpClientCapabilities capabilities;
         QMcpImplementation clientInfo;
         QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && capabilities == that.capabilities
+                && clientInfo == that.clientInfo
+                && protocolVersion == that.protocolVersion;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), capabilities, clientInfo, qToUnderlying(protocolVersion));
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpInitializeResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpServerCapabilities capabilities READ capabilities WRITE setCapabilities REQUIRED)
 
@@ -48,6 +49,18 @@ public:
     void setCapabilities(const QMcpServerCapabilities &value) {
         if (capabilities() == value) return;
         d<Private>()->capabilities = value;
+        setModified(capabilitiesIndex());
+    }
+
+    void setCapabilities(QMcpServerCapabilities &&value) {
+        if (!isModified(capabilitiesIndex()) && capabilities() == value) return;
+        d<Private>()->capabilities = std::move(value);
+        setModified(capabilitiesIndex());
+    }
+
+    QMcpServerCapabilities takeCapabilities() {
+        clearModified(capabilitiesIndex());
+        return std::exchange(d<Private>()->capabilities, QMcpServerCapabilities());
     }
 
     QString instructions() const {
@@ -57,6 +70,18 @@ public:
     void setInstructions(const QString &value) {
         if (instructions() == value) return;
         d<Private>()->instructions = value;
+        setModified(instructionsIndex());
+    }
+
+    void setInstructions(QString &&value) {
+        if (!isModified(instructionsIndex()) && instructions() == value) return;
+        d<Private>()->instructions = std::move(value);
+        setModified(instructionsIndex());
+    }
+
+    QString takeInstructions() {
+        clearModified(instructionsIndex());
+        return std::exchange(d<Private>()->instructions, QString());
     }
 
     QtMcp::ProtocolVersion protocolVersion() const {
@@ -66,6 +91,7 @@ public:
     void setProtocolVersion(QtMcp::ProtocolVersion value) {
         if (protocolVersion() == value) return;
         d<Private>()->protocolVersion = value;
+        setModified(protocolVersionIndex());
     }
     
     // For backward compatibility
@@ -80,6 +106,18 @@ public:
     void setServerInfo(const QMcpImplementation &value) {
         if (serverInfo() == value) return;
         d<Private>()->serverInfo = value;
+        setModified(serverInfoIndex());
+    }
+
+    void setServerInfo(QMcpImplementation &&value) {
+        if (!isModified(serverInfoIndex()) && serverInfo() == value) return;
+        d<Private>()->serverInfo = std::move(value);
+        setModified(serverInfoIndex());
+    }
+
+    QMcpImplementation takeServerInfo() {
+        clearModified(serverInfoIndex());
+        return std::exchange(d<Private>()->serverInfo, QMcpImplementation());
     }
 
     const QMetaObject* metaObject() const override {
@@ -87,12 +125,42 @@ public:
     }
 
 private:
+    static int capabilitiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("capabilities");
+        return index;
+    }
+    static int instructionsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("instructions");
+        return index;
+    }
+    static int protocolVersionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("protocolVersion");
+        return index;
+    }
+    static int serverInfoIndex() {
+        static const int index = staticMetaObject.indexOfProperty("serverInfo");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QMcpServerCapabilities capabilities;
         QString instructions;
         QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest;
         QMcpImplementation serverInfo;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && capabilities == that.capabilities
+                && instructions == that.instructions
+                && protocolVersion == that.protocolVersion
+                && serverInfo == that.serverInfo;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), capabilities, instructions, qToUnderlying(protocolVersion), serverInfo);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCBatchRequest : public QMcpJSONRPCMessage
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpJSONRPCBatchRequest::requests
@@ -36,6 +37,7 @@ public:
     void setRequests(const QList<QMcpJSONRPCRequest *> &requests) {
         if (this->requests() == requests) return;
         d<Private>()->requests = requests;
+        setModified(requestsIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -43,9 +45,24 @@ public:
     }
 
 private:
+    static int requestsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("requests");
+        return index;
+    }
+
     struct Private : public QMcpJSONRPCMessage::Private {
         QList<QMcpJSONRPCRequest *> requests;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessage::Private::equals(other)
+                && requests == that.requests;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessage::Private::hash(seed), requests);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
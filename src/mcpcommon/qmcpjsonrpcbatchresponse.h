@@ -22,6 +22,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCBatchResponse : public QMcpJSONRPCMessage
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpJSONRPCBatchResponse::responses
@@ -78,6 +79,7 @@ public:
     void setResponses(const QList<QMcpJSONRPCResponse *> &responses) {
         if (this->responses() == responses) return;
         d<Private>()->responses = responses;
+        setModified(responsesIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -85,9 +87,24 @@ public:
     }
 
 private:
+    static int responsesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("responses");
+        return index;
+    }
+
     struct Private : public QMcpJSONRPCMessage::Private {
         QList<QMcpJSONRPCResponse *> responses;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessage::Private::equals(other)
+                && responses == that.responses;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessage::Private::hash(seed), responses);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -99,6 +116,7 @@ private:
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCBatchErrorResponse : public QMcpJSONRPCMessage
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpJSONRPCBatchErrorResponse::errors
@@ -116,6 +134,34 @@ public:
     void setErrors(const QList<QMcpJSONRPCError> &errors) {
         if (this->errors() == errors) return;
         d<Private>()->errors = errors;
+        setModified(errorsIndex());
+    }
+
+    void setErrors(QList<QMcpJSONRPCError> &&errors) {
+        if (!isModified(errorsIndex()) && this->errors() == errors) return;
+        d<Private>()->errors = std::move(errors);
+        setModified(errorsIndex());
+    }
+
+    QList<QMcpJSONRPCError> takeErrors() {
+        clearModified(errorsIndex());
+        return std::exchange(d<Private>()->errors, QList<QMcpJSONRPCError>());
+    }
+
+    void appendError(const QMcpJSONRPCError &error) {
+        d<Private>()->errors.append(error);
+        setModified(errorsIndex());
+    }
+
+    void appendError(QMcpJSONRPCError &&error) {
+        d<Private>()->errors.append(std::move(error));
+        setModified(errorsIndex());
+    }
+
+    template <typename... Args>
+    QMcpJSONRPCError &emplaceError(Args &&...args) {
+        setModified(errorsIndex());
+        return d<Private>()->errors.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -123,9 +169,24 @@ public:
     }
 
 private:
+    static int errorsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("errors");
+        return index;
+    }
+
     struct Private : public QMcpJSONRPCMessage::Private {
         QList<QMcpJSONRPCError> errors;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessage::Private::equals(other)
+                && errors == that.errors;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessage::Private::hash(seed), errors);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCError : public QMcpJSONRPCMessageWithId
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpJSONRPCErrorError error READ error WRITE setError REQUIRED)
 
@@ -29,6 +30,18 @@ public:
     void setError(const QMcpJSONRPCErrorError &error) {
         if (this->error() == error) return;
         d<Private>()->error = error;
+        setModified(errorIndex());
+    }
+
+    void setError(QMcpJSONRPCErrorError &&error) {
+        if (!isModified(errorIndex()) && this->error() == error) return;
+        d<Private>()->error = std::move(error);
+        setModified(errorIndex());
+    }
+
+    QMcpJSONRPCErrorError takeError() {
+        clearModified(errorIndex());
+        return std::exchange(d<Private>()->error, QMcpJSONRPCErrorError());
     }
 
     const QMetaObject* metaObject() const override {
@@ -36,9 +49,24 @@ public:
     }
 
 private:
+    static int errorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("error");
+        return index;
+    }
+
     struct Private : public QMcpJSONRPCMessageWithId::Private {
         QMcpJSONRPCErrorError error;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessageWithId::Private::equals(other)
+                && error == that.error;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessageWithId::Private::hash(seed), error);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCErrorError : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpJSONRPCErrorError::code
@@ -47,6 +48,7 @@ public:
     void setCode(int value) {
         if (code() == value) return;
         d<Private>()->code = value;
+        setModified(codeIndex());
     }
 
     QJsonValue data() const {
@@ -56,6 +58,18 @@ public:
     void setData(const QJsonValue &value) {
         if (data() == value) return;
         d<Private>()->data = value;
+        setModified(dataIndex());
+    }
+
+    void setData(QJsonValue &&value) {
+        if (!isModified(dataIndex()) && data() == value) return;
+        d<Private>()->data = std::move(value);
+        setModified(dataIndex());
+    }
+
+    QJsonValue takeData() {
+        clearModified(dataIndex());
+        return std::exchange(d<Private>()->data, QJsonValue());
     }
 
     QString message() const {
@@ -65,6 +79,18 @@ public:
     void setMessage(const QString &value) {
         if (message() == value) return;
         d<Private>()->message = value;
+        setModified(messageIndex());
+    }
+
+    void setMessage(QString &&value) {
+        if (!isModified(messageIndex()) && message() == value) return;
+        d<Private>()->message = std::move(value);
+        setModified(messageIndex());
+    }
+
+    QString takeMessage() {
+        clearModified(messageIndex());
+        return std::exchange(d<Private>()->message, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -72,11 +98,36 @@ public:
     }
 
 private:
+    static int codeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("code");
+        return index;
+    }
+    static int dataIndex() {
+        static const int index = staticMetaObject.indexOfProperty("data");
+        return index;
+    }
+    static int messageIndex() {
+        static const int index = staticMetaObject.indexOfProperty("message");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         int code = 0;
         QJsonValue data;
         QString message;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && code == that.code
+                && data == that.data
+                && message == that.message;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), code, data, message);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
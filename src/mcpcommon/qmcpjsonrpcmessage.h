@@ -21,6 +21,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCMessage : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
     Q_PROPERTY(QString jsonrpc READ jsonrpc CONSTANT REQUIRED)
 
 public:
@@ -53,6 +54,7 @@ Q_DECLARE_SHARED(QMcpJSONRPCMessage)
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCMessageWithId : public QMcpJSONRPCMessage
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
     Q_PROPERTY(QMcpRequestId id READ id WRITE setId REQUIRED)
 
 public:
@@ -71,12 +73,36 @@ public:
     void setId(const QMcpRequestId &id) {
         if (this->id() == id) return;
         d<Private>()->id = id;
+        setModified(idIndex());
+    }
+
+    void setId(QMcpRequestId &&id) {
+        if (!isModified(idIndex()) && this->id() == id) return;
+        d<Private>()->id = std::move(id);
+        setModified(idIndex());
+    }
+
+    QMcpRequestId takeId() {
+        clearModified(idIndex());
+        return std::exchange(d<Private>()->id, QMcpRequestId());
+    }
+
+private:
+    static int idIndex() {
+        static const int index = staticMetaObject.indexOfProperty("id");
+        return index;
     }
 
 protected:
     struct Private : public QMcpJSONRPCMessage::Private {
         QMcpRequestId id;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessage::Private::equals(other)
+                && id == that.id;
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCNotification : public QMcpJSONRPCMessage
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString method READ method CONSTANT REQUIRED)
     Q_PROPERTY(QMcpJSONRPCNotificationParams params READ params WRITE setParams)
@@ -35,17 +36,46 @@ public:
     void setParams(const QMcpJSONRPCNotificationParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpJSONRPCNotificationParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpJSONRPCNotificationParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpJSONRPCNotificationParams());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
+private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCMessage::Private {
         QString method;
         QMcpJSONRPCNotificationParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessage::Private::equals(other)
+                && method == that.method
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessage::Private::hash(seed), method, params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCNotificationParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
 #if 0
     /*!
@@ -40,6 +41,18 @@ public:
     void setMeta(const QMcpJSONRPCNotificationParamsMeta &meta) {
         if (_meta() == meta) return;
         d<Private>()->_meta = meta;
+        setModified(metaIndex());
+    }
+
+    void setMeta(QMcpJSONRPCNotificationParamsMeta &&meta) {
+        if (!isModified(metaIndex()) && _meta() == meta) return;
+        d<Private>()->_meta = std::move(meta);
+        setModified(metaIndex());
+    }
+
+    QMcpJSONRPCNotificationParamsMeta take_meta() {
+        clearModified(metaIndex());
+        return std::exchange(d<Private>()->_meta, QMcpJSONRPCNotificationParamsMeta());
     }
 
     QJsonObject additionalProperties() const {
@@ -49,12 +62,34 @@ public:
     void setAdditionalProperties(const QJsonObject &properties) {
         if (additionalProperties() == properties) return;
         d<Private>()->additionalProperties = properties;
+        setModified(additionalPropertiesIndex());
+    }
+
+    void setAdditionalProperties(QJsonObject &&properties) {
+        if (!isModified(additionalPropertiesIndex()) && additionalProperties() == properties) return;
+        d<Private>()->additionalProperties = std::move(properties);
+        setModified(additionalPropertiesIndex());
+    }
+
+    QJsonObject takeAdditionalProperties() {
+        clearModified(additionalPropertiesIndex());
+        return std::exchange(d<Private>()->additionalProperties, QJsonObject());
     }
 #endif
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
+private:
+    static int metaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("_meta");
+        return index;
+    }
+    static int additionalPropertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("additionalProperties");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpGadget::Private {
 #if 0
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCRequest : public QMcpJSONRPCMessageWithId
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString method READ method CONSTANT REQUIRED)
     Q_PROPERTY(QMcpJSONRPCRequestParams params READ params WRITE setParams)
@@ -36,16 +37,44 @@ public:
     void setParams(const QMcpJSONRPCRequestParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpJSONRPCRequestParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpJSONRPCRequestParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpJSONRPCRequestParams());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
+private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCMessageWithId::Private {
         QMcpJSONRPCRequestParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessageWithId::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessageWithId::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
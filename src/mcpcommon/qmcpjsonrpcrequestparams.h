@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
 #if 0
     Q_PROPERTY(QMcpJSONRPCRequestParamsMeta _meta READ _meta WRITE setMeta)
@@ -34,6 +35,18 @@ public:
     void setMeta(const QMcpJSONRPCRequestParamsMeta &meta) {
         if (_meta() == meta) return;
         d<Private>()->_meta = meta;
+        setModified(metaIndex());
+    }
+
+    void setMeta(QMcpJSONRPCRequestParamsMeta &&meta) {
+        if (!isModified(metaIndex()) && _meta() == meta) return;
+        d<Private>()->_meta = std::move(meta);
+        setModified(metaIndex());
+    }
+
+    QMcpJSONRPCRequestParamsMeta take_meta() {
+        clearModified(metaIndex());
+        return std::exchange(d<Private>()->_meta, QMcpJSONRPCRequestParamsMeta());
     }
 
     QJsonObject additionalProperties() const {
@@ -43,6 +56,18 @@ public:
     void setAdditionalProperties(const QJsonObject &properties) {
         if (additionalProperties() == properties) return;
         d<Private>()->additionalProperties = properties;
+        setModified(additionalPropertiesIndex());
+    }
+
+    void setAdditionalProperties(QJsonObject &&properties) {
+        if (!isModified(additionalPropertiesIndex()) && additionalProperties() == properties) return;
+        d<Private>()->additionalProperties = std::move(properties);
+        setModified(additionalPropertiesIndex());
+    }
+
+    QJsonObject takeAdditionalProperties() {
+        clearModified(additionalPropertiesIndex());
+        return std::exchange(d<Private>()->additionalProperties, QJsonObject());
     }
 #endif
 
@@ -51,6 +76,15 @@ public:
     }
 
 private:
+    static int metaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("_meta");
+        return index;
+    }
+    static int additionalPropertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("additionalProperties");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
 #if 0
         QMcpJSONRPCRequestParamsMeta _meta;
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpJSONRPCResponse : public QMcpJSONRPCMessageWithId
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpResult result READ result WRITE setResult REQUIRED)
 
@@ -29,16 +30,44 @@ public:
     void setResult(const QMcpResult &result) {
         if (this->result() == result) return;
         d<Private>()->result = result;
+        setModified(resultIndex());
+    }
+
+    void setResult(QMcpResult &&result) {
+        if (!isModified(resultIndex()) && this->result() == result) return;
+        d<Private>()->result = std::move(result);
+        setModified(resultIndex());
+    }
+
+    QMcpResult takeResult() {
+        clearModified(resultIndex());
+        return std::exchange(d<Private>()->result, QMcpResult());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
+private:
+    static int resultIndex() {
+        static const int index = staticMetaObject.indexOfProperty("result");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCMessageWithId::Private {
         QMcpResult result;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCMessageWithId::Private::equals(other)
+                && result == that.result;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCMessageWithId::Private::hash(seed), result);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
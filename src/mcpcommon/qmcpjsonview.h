@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPJSONVIEW_H
+#define QMCPJSONVIEW_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtMcpCommon/qmcprequestid.h>
+#include <QtMcpCommon/qtmcpnamespace.h>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtCore/QString>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpJsonView
+    \inmodule QtMcpCommon
+    \brief Base class of read-only views over a received JSON object.
+
+    A view shares the QJsonObject it was constructed from and reads each
+    field only when its getter is called, without constructing the
+    corresponding gadget. Subclasses name that gadget as \c Gadget.
+
+    Views can be passed to QMcpServer::addRequestHandler() in place of the
+    request gadget when a handler reads only a few fields.
+*/
+class QMcpJsonView
+{
+public:
+    QMcpJsonView() = default;
+    explicit QMcpJsonView(const QJsonObject &object)
+        : json(object)
+    {}
+
+    const QJsonObject &jsonObject() const { return json; }
+    bool isEmpty() const { return json.isEmpty(); }
+    bool contains(QLatin1StringView key) const { return json.contains(key); }
+
+    template <typename Gadget>
+    Gadget toGadget(QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest) const {
+        Gadget gadget;
+        gadget.fromJsonObject(json, protocolVersion);
+        return gadget;
+    }
+
+protected:
+    QJsonValue value(QLatin1StringView key) const {
+        return json.value(key);
+    }
+
+    QString string(QLatin1StringView key) const {
+        return json.value(key).toString();
+    }
+
+    QJsonObject object(QLatin1StringView key) const {
+        return json.value(key).toObject();
+    }
+
+private:
+    QJsonObject json;
+};
+
+/*! \class QMcpJsonRequestView
+    \inmodule QtMcpCommon
+    \brief Read-only view over a received JSON-RPC request.
+
+    \a Params is the view type of the \c params member.
+*/
+template <typename Params>
+class QMcpJsonRequestView : public QMcpJsonView
+{
+public:
+    using QMcpJsonView::QMcpJsonView;
+
+    QMcpRequestId id() const {
+        return value("id"_L1).toVariant();
+    }
+
+    QString method() const {
+        return string("method"_L1);
+    }
+
+    Params params() const {
+        return Params(object("params"_L1));
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPJSONVIEW_H
@@ -0,0 +1,599 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpjsonwriter.h"
+#include "qmcpbase64.h"
+#include "qmcpgadget.h"
+#include "qmcpjsonrpcerrorerror.h"
+
+#include <QtCore/qendian.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qnumeric.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+constexpr char hexDigits[] = "0123456789abcdef";
+
+// CBOR major types and the initial bytes used by the writer
+enum CborMajorType : quint8 {
+    CborUnsigned = 0,
+    CborNegative = 1,
+    CborByteString = 2,
+    CborTextString = 3,
+};
+constexpr char cborIndefiniteByteString = char(0x5f);
+constexpr char cborIndefiniteArray = char(0x9f);
+constexpr char cborIndefiniteMap = char(0xbf);
+constexpr char cborFalse = char(0xf4);
+constexpr char cborTrue = char(0xf5);
+constexpr char cborNull = char(0xf6);
+constexpr char cborFloat = char(0xfa);
+constexpr char cborDouble = char(0xfb);
+constexpr char cborBreak = char(0xff);
+
+// appends the head of a data item with the shortest encoding of the argument
+void appendCborHead(QByteArray *out, quint8 majorType, quint64 value)
+{
+    const char type = char(majorType << 5);
+    if (value < 24) {
+        out->append(char(type | value));
+    } else if (value <= 0xff) {
+        out->append(char(type | 24));
+        out->append(char(value));
+    } else if (value <= 0xffff) {
+        char bytes[3] = { char(type | 25) };
+        qToBigEndian(quint16(value), bytes + 1);
+        out->append(bytes, sizeof(bytes));
+    } else if (value <= 0xffffffff) {
+        char bytes[5] = { char(type | 26) };
+        qToBigEndian(quint32(value), bytes + 1);
+        out->append(bytes, sizeof(bytes));
+    } else {
+        char bytes[9] = { char(type | 27) };
+        qToBigEndian(value, bytes + 1);
+        out->append(bytes, sizeof(bytes));
+    }
+}
+
+// true for ASCII characters that cannot appear unescaped in a JSON string
+inline bool needsEscape(uchar c)
+{
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+template <typename Append>
+inline void escapeAscii(uchar c, Append append)
+{
+    switch (c) {
+    case '"': append('\\'); append('"'); break;
+    case '\\': append('\\'); append('\\'); break;
+    case '\b': append('\\'); append('b'); break;
+    case '\f': append('\\'); append('f'); break;
+    case '\n': append('\\'); append('n'); break;
+    case '\r': append('\\'); append('r'); break;
+    case '\t': append('\\'); append('t'); break;
+    default:
+        append('\\'); append('u'); append('0'); append('0');
+        append(hexDigits[c >> 4]); append(hexDigits[c & 0xf]);
+        break;
+    }
+}
+
+// base64-encodes everything written to it into a buffer
+class Base64Device : public QIODevice
+{
+public:
+    explicit Base64Device(QByteArray *out)
+        : out(out)
+    {
+        open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+    }
+
+    bool isSequential() const override { return true; }
+
+    // encodes the bytes left over from the last write, with padding
+    void finish()
+    {
+        QMcpBase64::encode(QByteArrayView(pending, pendingSize), out);
+        pendingSize = 0;
+    }
+
+protected:
+    qint64 readData(char *, qint64) override { return -1; }
+
+    qint64 writeData(const char *data, qint64 size) override
+    {
+        const qint64 written = size;
+        if (pendingSize > 0) {
+            while (pendingSize < 3 && size > 0) {
+                pending[pendingSize++] = *data++;
+                size--;
+            }
+            if (pendingSize < 3)
+                return written;
+            QMcpBase64::encode(QByteArrayView(pending, 3), out);
+            pendingSize = 0;
+        }
+        // only whole groups of three bytes are encoded without padding
+        const qint64 whole = size - size % 3;
+        QMcpBase64::encode(QByteArrayView(data, qsizetype(whole)), out);
+        while (whole + pendingSize < size) {
+            pending[pendingSize] = data[whole + pendingSize];
+            pendingSize++;
+        }
+        return written;
+    }
+
+private:
+    QByteArray *out;
+    char pending[3];
+    int pendingSize = 0;
+};
+
+// writes everything written to it as chunks of an indefinite length CBOR
+// byte string, whose head and break are written by the caller
+class CborChunkDevice : public QIODevice
+{
+public:
+    explicit CborChunkDevice(QByteArray *out)
+        : out(out)
+    {
+        open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+    }
+
+    bool isSequential() const override { return true; }
+
+protected:
+    qint64 readData(char *, qint64) override { return -1; }
+
+    qint64 writeData(const char *data, qint64 size) override
+    {
+        if (size > 0) {
+            appendCborHead(out, CborByteString, quint64(size));
+            out->append(data, qsizetype(size));
+        }
+        return size;
+    }
+
+private:
+    QByteArray *out;
+};
+}
+
+/*!
+    Constructs a writer that appends to its own buffer in \a encoding.
+*/
+QMcpJsonWriter::QMcpJsonWriter(QtMcp::Encoding encoding)
+    : buffer(&ownBuffer)
+    , cbor(encoding == QtMcp::Encoding::Cbor)
+{}
+
+/*!
+    Constructs a writer that appends to \a buffer in \a encoding.
+*/
+QMcpJsonWriter::QMcpJsonWriter(QByteArray *buffer, QtMcp::Encoding encoding)
+    : buffer(buffer)
+    , cbor(encoding == QtMcp::Encoding::Cbor)
+{
+    Q_ASSERT(buffer);
+}
+
+QMcpJsonWriter::~QMcpJsonWriter() = default;
+
+void QMcpJsonWriter::separate()
+{
+    if (afterKey)
+        afterKey = false;
+    else if (needsComma)
+        buffer->append(',');
+}
+
+void QMcpJsonWriter::beginObject()
+{
+    if (cbor) {
+        buffer->append(cborIndefiniteMap);
+        return;
+    }
+    separate();
+    buffer->append('{');
+    needsComma = false;
+}
+
+void QMcpJsonWriter::endObject()
+{
+    if (cbor) {
+        buffer->append(cborBreak);
+        return;
+    }
+    buffer->append('}');
+    needsComma = true;
+}
+
+void QMcpJsonWriter::beginArray()
+{
+    if (cbor) {
+        buffer->append(cborIndefiniteArray);
+        return;
+    }
+    separate();
+    buffer->append('[');
+    needsComma = false;
+}
+
+void QMcpJsonWriter::endArray()
+{
+    if (cbor) {
+        buffer->append(cborBreak);
+        return;
+    }
+    buffer->append(']');
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeKey(QLatin1StringView key)
+{
+    writeString(key);
+    if (cbor)
+        return;
+    buffer->append(':');
+    afterKey = true;
+}
+
+void QMcpJsonWriter::writeKey(QStringView key)
+{
+    writeString(key);
+    if (cbor)
+        return;
+    buffer->append(':');
+    afterKey = true;
+}
+
+void QMcpJsonWriter::writeNull()
+{
+    if (cbor) {
+        buffer->append(cborNull);
+        return;
+    }
+    separate();
+    buffer->append("null");
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeBool(bool value)
+{
+    if (cbor) {
+        buffer->append(value ? cborTrue : cborFalse);
+        return;
+    }
+    separate();
+    buffer->append(value ? "true" : "false");
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeInteger(qint64 value)
+{
+    if (cbor) {
+        if (value < 0)
+            appendCborHead(buffer, CborNegative, quint64(-(value + 1)));
+        else
+            appendCborHead(buffer, CborUnsigned, quint64(value));
+        return;
+    }
+    separate();
+    buffer->append(QByteArray::number(value));
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeDouble(double value)
+{
+    if (!qIsFinite(value)) {
+        writeNull();
+        return;
+    }
+    if (cbor) {
+        // single precision when it loses nothing
+        const float single = float(value);
+        if (double(single) == value) {
+            char bytes[5] = { cborFloat };
+            qToBigEndian(single, bytes + 1);
+            buffer->append(bytes, sizeof(bytes));
+        } else {
+            char bytes[9] = { cborDouble };
+            qToBigEndian(value, bytes + 1);
+            buffer->append(bytes, sizeof(bytes));
+        }
+        return;
+    }
+    separate();
+    buffer->append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeString(QStringView value)
+{
+    if (cbor) {
+        writeUtf8String(value.toUtf8());
+        return;
+    }
+    separate();
+    writeEscaped(value);
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeString(QLatin1StringView value)
+{
+    for (const char c : value) {
+        if (uchar(c) >= 0x80) {
+            writeString(QString(value));
+            return;
+        }
+    }
+    writeUtf8String(QByteArrayView(value.data(), value.size()));
+}
+
+void QMcpJsonWriter::writeUtf8String(QByteArrayView value)
+{
+    if (cbor) {
+        appendCborHead(buffer, CborTextString, quint64(value.size()));
+        buffer->append(value);
+        return;
+    }
+    separate();
+    QByteArray &out = *buffer;
+    out.append('"');
+    const char *begin = value.data();
+    const char *end = begin + value.size();
+    const char *run = begin;
+    for (const char *p = begin; p < end; ++p) {
+        const uchar c = uchar(*p);
+        if (!needsEscape(c))
+            continue;
+        out.append(run, p - run);
+        escapeAscii(c, [&out](char ch) { out.append(ch); });
+        run = p + 1;
+    }
+    out.append(run, end - run);
+    out.append('"');
+    needsComma = true;
+}
+
+// encodes binary data straight into the buffer; base64 needs no escaping
+void QMcpJsonWriter::writeBase64(QByteArrayView data)
+{
+    if (cbor) {
+        appendCborHead(buffer, CborByteString, quint64(data.size()));
+        buffer->append(data);
+        return;
+    }
+    separate();
+    buffer->append('"');
+    QMcpBase64::encode(data, buffer);
+    buffer->append('"');
+    needsComma = true;
+}
+
+// encodes what the producer writes to the device as it arrives, without a
+// copy of the whole payload; writes an empty string if the producer fails
+void QMcpJsonWriter::writeBase64(const std::function<bool(QIODevice *)> &producer)
+{
+    if (cbor) {
+        const qsizetype start = buffer->size();
+        buffer->append(cborIndefiniteByteString);
+        CborChunkDevice device(buffer);
+        if (producer(&device)) {
+            buffer->append(cborBreak);
+        } else {
+            buffer->truncate(start);
+            appendCborHead(buffer, CborByteString, 0);
+        }
+        return;
+    }
+    separate();
+    buffer->append('"');
+    const qsizetype start = buffer->size();
+    Base64Device device(buffer);
+    if (producer(&device))
+        device.finish();
+    else
+        buffer->truncate(start);
+    buffer->append('"');
+    needsComma = true;
+}
+
+// writes data held as base64 text, which CBOR carries decoded
+void QMcpJsonWriter::writeBase64Encoded(QByteArrayView base64)
+{
+    if (cbor) {
+        bool ok = false;
+        const auto data = QMcpBase64::decode(base64, &ok);
+        if (ok)
+            writeBase64(data);
+        else
+            writeUtf8String(base64);
+        return;
+    }
+    writeUtf8String(base64);
+}
+
+void QMcpJsonWriter::writeEscaped(QStringView value)
+{
+    // encode in chunks to avoid growing the buffer per character
+    char chunk[512];
+    qsizetype used = 0;
+    QByteArray &out = *buffer;
+    auto append = [&](char c) {
+        chunk[used++] = c;
+    };
+
+    out.append('"');
+    const char16_t *p = value.utf16();
+    const char16_t *end = p + value.size();
+    while (p < end) {
+        if (used > qsizetype(sizeof(chunk)) - 8) {
+            out.append(chunk, used);
+            used = 0;
+        }
+        char32_t c = *p++;
+        if (c < 0x80) {
+            if (needsEscape(uchar(c)))
+                escapeAscii(uchar(c), append);
+            else
+                append(char(c));
+            continue;
+        }
+        if (QChar::isHighSurrogate(c) && p < end && QChar::isLowSurrogate(*p))
+            c = QChar::surrogateToUcs4(char16_t(c), *p++);
+        else if (QChar::isSurrogate(c))
+            c = QChar::ReplacementCharacter;
+
+        if (c < 0x800) {
+            append(char(0xc0 | (c >> 6)));
+        } else if (c < 0x10000) {
+            append(char(0xe0 | (c >> 12)));
+            append(char(0x80 | ((c >> 6) & 0x3f)));
+        } else {
+            append(char(0xf0 | (c >> 18)));
+            append(char(0x80 | ((c >> 12) & 0x3f)));
+            append(char(0x80 | ((c >> 6) & 0x3f)));
+        }
+        append(char(0x80 | (c & 0x3f)));
+    }
+    out.append(chunk, used);
+    out.append('"');
+}
+
+void QMcpJsonWriter::writeRawValue(QByteArrayView json)
+{
+    if (cbor) {
+        buffer->append(json);
+        return;
+    }
+    separate();
+    buffer->append(json);
+    needsComma = true;
+}
+
+void QMcpJsonWriter::writeValue(const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Bool:
+        writeBool(value.toBool());
+        break;
+    case QJsonValue::Double: {
+        const double d = value.toDouble();
+        const qint64 i = value.toInteger();
+        if (double(i) == d)
+            writeInteger(i);
+        else
+            writeDouble(d);
+        break; }
+    case QJsonValue::String:
+        writeString(value.toString());
+        break;
+    case QJsonValue::Array:
+        writeArray(value.toArray());
+        break;
+    case QJsonValue::Object:
+        writeObject(value.toObject());
+        break;
+    default:
+        writeNull();
+        break;
+    }
+}
+
+void QMcpJsonWriter::writeObject(const QJsonObject &object)
+{
+    beginObject();
+    for (auto it = object.constBegin(), end = object.constEnd(); it != end; ++it) {
+        writeKey(it.key());
+        writeValue(it.value());
+    }
+    endObject();
+}
+
+void QMcpJsonWriter::writeArray(const QJsonArray &array)
+{
+    beginArray();
+    for (const auto &value : array)
+        writeValue(value);
+    endArray();
+}
+
+void QMcpJsonWriter::writeGadget(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion)
+{
+    gadget.writeJson(*this, protocolVersion);
+}
+
+void QMcpJsonWriter::writeResponse(const QJsonValue &id, const QMcpGadget &result, QtMcp::ProtocolVersion protocolVersion)
+{
+    beginObject();
+    writeKey("jsonrpc"_L1);
+    writeString("2.0"_L1);
+    writeKey("id"_L1);
+    writeValue(id);
+    writeKey("result"_L1);
+    writeGadget(result, protocolVersion);
+    endObject();
+}
+
+void QMcpJsonWriter::writeResponse(const QJsonValue &id, QByteArrayView result)
+{
+    beginObject();
+    writeKey("jsonrpc"_L1);
+    writeString("2.0"_L1);
+    writeKey("id"_L1);
+    writeValue(id);
+    writeKey("result"_L1);
+    writeRawValue(result);
+    endObject();
+}
+
+void QMcpJsonWriter::writeError(const QJsonValue &id, const QMcpJSONRPCErrorError &error, QtMcp::ProtocolVersion protocolVersion)
+{
+    beginObject();
+    writeKey("jsonrpc"_L1);
+    writeString("2.0"_L1);
+    writeKey("id"_L1);
+    writeValue(id);
+    writeKey("error"_L1);
+    writeGadget(error, protocolVersion);
+    endObject();
+}
+
+QByteArray QMcpJsonWriter::toJson(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion)
+{
+    QMcpJsonWriter writer;
+    writer.writeGadget(gadget, protocolVersion);
+    return writer.takeData();
+}
+
+QByteArray QMcpJsonWriter::toJson(const QJsonObject &object)
+{
+    QMcpJsonWriter writer;
+    writer.writeObject(object);
+    return writer.takeData();
+}
+
+QByteArray QMcpJsonWriter::toCbor(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion)
+{
+    return encode(gadget, QtMcp::Encoding::Cbor, protocolVersion);
+}
+
+QByteArray QMcpJsonWriter::toCbor(const QJsonObject &object)
+{
+    QMcpJsonWriter writer(QtMcp::Encoding::Cbor);
+    writer.writeObject(object);
+    return writer.takeData();
+}
+
+QByteArray QMcpJsonWriter::encode(const QMcpGadget &gadget, QtMcp::Encoding encoding, QtMcp::ProtocolVersion protocolVersion)
+{
+    QMcpJsonWriter writer(encoding);
+    writer.writeGadget(gadget, protocolVersion);
+    return writer.takeData();
+}
+
+QT_END_NAMESPACE
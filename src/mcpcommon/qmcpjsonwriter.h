@@ -0,0 +1,109 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPJSONWRITER_H
+#define QMCPJSONWRITER_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtMcpCommon/qtmcpnamespace.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qjsonvalue.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QMcpGadget;
+class QMcpJSONRPCErrorError;
+
+/*! \class QMcpJsonWriter
+    \inmodule QtMcpCommon
+    \brief Serializes gadgets and JSON values straight into compact JSON text.
+
+    QMcpJsonWriter appends to a growable QByteArray without building an
+    intermediate QJsonObject tree. Gadgets are written through
+    QMcpGadget::writeJson(), which walks the cached serialization plan of the
+    gadget.
+
+    A writer created with QtMcp::Encoding::Cbor writes the same values as
+    CBOR instead, see QMcpCbor. Objects and arrays become maps and arrays of
+    indefinite length, and binary data written with writeBase64() or
+    writeBase64Encoded() becomes a byte string. writeRawValue() expects a
+    value in the encoding of the writer.
+
+    The JSON-RPC envelope of a response or an error can be written inline
+    with writeResponse() and writeError().
+
+    \code
+    QMcpJsonWriter writer;
+    writer.writeResponse(id, result, protocolVersion);
+    backend->writeMessage(session, writer.takeData());
+    \endcode
+*/
+class Q_MCPCOMMON_EXPORT QMcpJsonWriter
+{
+public:
+    explicit QMcpJsonWriter(QtMcp::Encoding encoding = QtMcp::Encoding::Json);
+    explicit QMcpJsonWriter(QByteArray *buffer, QtMcp::Encoding encoding = QtMcp::Encoding::Json);
+    ~QMcpJsonWriter();
+
+    QtMcp::Encoding encoding() const { return cbor ? QtMcp::Encoding::Cbor : QtMcp::Encoding::Json; }
+
+    QByteArray data() const { return *buffer; }
+    QByteArray takeData() { return std::exchange(*buffer, QByteArray()); }
+    void reserve(qsizetype size) { buffer->reserve(size); }
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    void writeKey(QLatin1StringView key);
+    void writeKey(QStringView key);
+
+    void writeNull();
+    void writeBool(bool value);
+    void writeInteger(qint64 value);
+    void writeDouble(double value);
+    void writeString(QStringView value);
+    void writeString(QLatin1StringView value);
+    void writeUtf8String(QByteArrayView value);
+    void writeBase64(QByteArrayView data);
+    void writeBase64(const std::function<bool(QIODevice *)> &producer);
+    void writeBase64Encoded(QByteArrayView base64);
+    void writeRawValue(QByteArrayView json);
+
+    void writeValue(const QJsonValue &value);
+    void writeObject(const QJsonObject &object);
+    void writeArray(const QJsonArray &array);
+    void writeGadget(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+
+    void writeResponse(const QJsonValue &id, const QMcpGadget &result, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+    void writeResponse(const QJsonValue &id, QByteArrayView result);
+    void writeError(const QJsonValue &id, const QMcpJSONRPCErrorError &error, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+
+    static QByteArray toJson(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+    static QByteArray toJson(const QJsonObject &object);
+    static QByteArray toCbor(const QMcpGadget &gadget, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+    static QByteArray toCbor(const QJsonObject &object);
+    static QByteArray encode(const QMcpGadget &gadget, QtMcp::Encoding encoding, QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest);
+
+private:
+    Q_DISABLE_COPY_MOVE(QMcpJsonWriter)
+
+    void separate();
+    void writeEscaped(QStringView value);
+
+    QByteArray ownBuffer;
+    QByteArray *buffer;
+    bool cbor = false;
+    bool needsComma = false;
+    bool afterKey = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPJSONWRITER_H
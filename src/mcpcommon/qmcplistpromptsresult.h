@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListPromptsResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpListPromptsResult::nextCursor
@@ -40,6 +41,18 @@ public:
     void setNextCursor(const QString &cursor) {
         if (nextCursor() == cursor) return;
         d<Private>()->nextCursor = cursor;
+        setModified(nextCursorIndex());
+    }
+
+    void setNextCursor(QString &&cursor) {
+        if (!isModified(nextCursorIndex()) && nextCursor() == cursor) return;
+        d<Private>()->nextCursor = std::move(cursor);
+        setModified(nextCursorIndex());
+    }
+
+    QString takeNextCursor() {
+        clearModified(nextCursorIndex());
+        return std::exchange(d<Private>()->nextCursor, QString());
     }
 
     QList<QMcpPrompt> prompts() const {
@@ -49,6 +62,34 @@ public:
     void setPrompts(const QList<QMcpPrompt> &prompts) {
         if (this->prompts() == prompts) return;
         d<Private>()->prompts = prompts;
+        setModified(promptsIndex());
+    }
+
+    void setPrompts(QList<QMcpPrompt> &&prompts) {
+        if (!isModified(promptsIndex()) && this->prompts() == prompts) return;
+        d<Private>()->prompts = std::move(prompts);
+        setModified(promptsIndex());
+    }
+
+    QList<QMcpPrompt> takePrompts() {
+        clearModified(promptsIndex());
+        return std::exchange(d<Private>()->prompts, QList<QMcpPrompt>());
+    }
+
+    void appendPrompt(const QMcpPrompt &prompt) {
+        d<Private>()->prompts.append(prompt);
+        setModified(promptsIndex());
+    }
+
+    void appendPrompt(QMcpPrompt &&prompt) {
+        d<Private>()->prompts.append(std::move(prompt));
+        setModified(promptsIndex());
+    }
+
+    template <typename... Args>
+    QMcpPrompt &emplacePrompt(Args &&...args) {
+        setModified(promptsIndex());
+        return d<Private>()->prompts.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -56,10 +97,30 @@ public:
     }
 
 private:
+    static int nextCursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("nextCursor");
+        return index;
+    }
+    static int promptsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("prompts");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString nextCursor;
         QList<QMcpPrompt> prompts;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && nextCursor == that.nextCursor
+                && prompts == that.prompts;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), nextCursor, prompts);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
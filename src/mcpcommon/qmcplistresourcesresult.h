@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListResourcesResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpListResourcesResult::nextCursor
@@ -40,6 +41,18 @@ public:
     void setNextCursor(const QString &cursor) {
         if (nextCursor() == cursor) return;
         d<Private>()->nextCursor = cursor;
+        setModified(nextCursorIndex());
+    }
+
+    void setNextCursor(QString &&cursor) {
+        if (!isModified(nextCursorIndex()) && nextCursor() == cursor) return;
+        d<Private>()->nextCursor = std::move(cursor);
+        setModified(nextCursorIndex());
+    }
+
+    QString takeNextCursor() {
+        clearModified(nextCursorIndex());
+        return std::exchange(d<Private>()->nextCursor, QString());
     }
 
     QList<QMcpResource> resources() const {
@@ -49,6 +62,34 @@ public:
     void setResources(const QList<QMcpResource> &resources) {
         if (this->resources() == resources) return;
         d<Private>()->resources = resources;
+        setModified(resourcesIndex());
+    }
+
+    void setResources(QList<QMcpResource> &&resources) {
+        if (!isModified(resourcesIndex()) && this->resources() == resources) return;
+        d<Private>()->resources = std::move(resources);
+        setModified(resourcesIndex());
+    }
+
+    QList<QMcpResource> takeResources() {
+        clearModified(resourcesIndex());
+        return std::exchange(d<Private>()->resources, QList<QMcpResource>());
+    }
+
+    void appendResource(const QMcpResource &resource) {
+        d<Private>()->resources.append(resource);
+        setModified(resourcesIndex());
+    }
+
+    void appendResource(QMcpResource &&resource) {
+        d<Private>()->resources.append(std::move(resource));
+        setModified(resourcesIndex());
+    }
+
+    template <typename... Args>
+    QMcpResource &emplaceResource(Args &&...args) {
+        setModified(resourcesIndex());
+        return d<Private>()->resources.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -56,10 +97,30 @@ public:
     }
 
 private:
+    static int nextCursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("nextCursor");
+        return index;
+    }
+    static int resourcesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("resources");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString nextCursor;
         QList<QMcpResource> resources;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && nextCursor == that.nextCursor
+                && resources == that.resources;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), nextCursor, resources);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListResourceTemplatesResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpListResourceTemplatesResult::nextCursor
@@ -40,6 +41,18 @@ public:
     void setNextCursor(const QString &cursor) {
         if (nextCursor() == cursor) return;
         d<Private>()->nextCursor = cursor;
+        setModified(nextCursorIndex());
+    }
+
+    void setNextCursor(QString &&cursor) {
+        if (!isModified(nextCursorIndex()) && nextCursor() == cursor) return;
+        d<Private>()->nextCursor = std::move(cursor);
+        setModified(nextCursorIndex());
+    }
+
+    QString takeNextCursor() {
+        clearModified(nextCursorIndex());
+        return std::exchange(d<Private>()->nextCursor, QString());
     }
 
     QList<QMcpResourceTemplate> resourceTemplates() const {
@@ -49,6 +62,34 @@ public:
     void setResourceTemplates(const QList<QMcpResourceTemplate> &templates) {
         if (resourceTemplates() == templates) return;
         d<Private>()->resourceTemplates = templates;
+        setModified(resourceTemplatesIndex());
+    }
+
+    void setResourceTemplates(QList<QMcpResourceTemplate> &&templates) {
+        if (!isModified(resourceTemplatesIndex()) && resourceTemplates() == templates) return;
+        d<Private>()->resourceTemplates = std::move(templates);
+        setModified(resourceTemplatesIndex());
+    }
+
+    QList<QMcpResourceTemplate> takeResourceTemplates() {
+        clearModified(resourceTemplatesIndex());
+        return std::exchange(d<Private>()->resourceTemplates, QList<QMcpResourceTemplate>());
+    }
+
+    void appendResourceTemplate(const QMcpResourceTemplate &resourceTemplate) {
+        d<Private>()->resourceTemplates.append(resourceTemplate);
+        setModified(resourceTemplatesIndex());
+    }
+
+    void appendResourceTemplate(QMcpResourceTemplate &&resourceTemplate) {
+        d<Private>()->resourceTemplates.append(std::move(resourceTemplate));
+        setModified(resourceTemplatesIndex());
+    }
+
+    template <typename... Args>
+    QMcpResourceTemplate &emplaceResourceTemplate(Args &&...args) {
+        setModified(resourceTemplatesIndex());
+        return d<Private>()->resourceTemplates.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -56,10 +97,30 @@ public:
     }
 
 private:
+    static int nextCursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("nextCursor");
+        return index;
+    }
+    static int resourceTemplatesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("resourceTemplates");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString nextCursor;
         QList<QMcpResourceTemplate> resourceTemplates;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && nextCursor == that.nextCursor
+                && resourceTemplates == that.resourceTemplates;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), nextCursor, resourceTemplates);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListRootsResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QList<QMcpRoot> roots READ roots WRITE setRoots REQUIRED)
 
@@ -32,6 +33,34 @@ public:
     void setRoots(const QList<QMcpRoot> &roots) {
         if (this->roots() == roots) return;
         d<Private>()->roots = roots;
+        setModified(rootsIndex());
+    }
+
+    void setRoots(QList<QMcpRoot> &&roots) {
+        if (!isModified(rootsIndex()) && this->roots() == roots) return;
+        d<Private>()->roots = std::move(roots);
+        setModified(rootsIndex());
+    }
+
+    QList<QMcpRoot> takeRoots() {
+        clearModified(rootsIndex());
+        return std::exchange(d<Private>()->roots, QList<QMcpRoot>());
+    }
+
+    void appendRoot(const QMcpRoot &root) {
+        d<Private>()->roots.append(root);
+        setModified(rootsIndex());
+    }
+
+    void appendRoot(QMcpRoot &&root) {
+        d<Private>()->roots.append(std::move(root));
+        setModified(rootsIndex());
+    }
+
+    template <typename... Args>
+    QMcpRoot &emplaceRoot(Args &&...args) {
+        setModified(rootsIndex());
+        return d<Private>()->roots.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -39,9 +68,24 @@ public:
     }
 
 private:
+    static int rootsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("roots");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QList<QMcpRoot> roots;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && roots == that.roots;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), roots);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
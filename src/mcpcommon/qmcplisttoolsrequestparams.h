@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListToolsRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpListToolsRequestParams::cursor
@@ -33,6 +34,18 @@ public:
     void setCursor(const QString &cursor) {
         if (this->cursor() == cursor) return;
         d<Private>()->cursor = cursor;
+        setModified(cursorIndex());
+    }
+
+    void setCursor(QString &&cursor) {
+        if (!isModified(cursorIndex()) && this->cursor() == cursor) return;
+        d<Private>()->cursor = std::move(cursor);
+        setModified(cursorIndex());
+    }
+
+    QString takeCursor() {
+        clearModified(cursorIndex());
+        return std::exchange(d<Private>()->cursor, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -40,9 +53,24 @@ public:
     }
 
 private:
+    static int cursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("cursor");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString cursor;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && cursor == that.cursor;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), cursor);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpListToolsResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpListToolsResult::nextCursor
@@ -40,6 +41,18 @@ public:
     void setNextCursor(const QString &cursor) {
         if (nextCursor() == cursor) return;
         d<Private>()->nextCursor = cursor;
+        setModified(nextCursorIndex());
+    }
+
+    void setNextCursor(QString &&cursor) {
+        if (!isModified(nextCursorIndex()) && nextCursor() == cursor) return;
+        d<Private>()->nextCursor = std::move(cursor);
+        setModified(nextCursorIndex());
+    }
+
+    QString takeNextCursor() {
+        clearModified(nextCursorIndex());
+        return std::exchange(d<Private>()->nextCursor, QString());
     }
 
     QList<QMcpTool> tools() const {
@@ -49,6 +62,34 @@ public:
     void setTools(const QList<QMcpTool> &tools) {
         if (this->tools() == tools) return;
         d<Private>()->tools = tools;
+        setModified(toolsIndex());
+    }
+
+    void setTools(QList<QMcpTool> &&tools) {
+        if (!isModified(toolsIndex()) && this->tools() == tools) return;
+        d<Private>()->tools = std::move(tools);
+        setModified(toolsIndex());
+    }
+
+    QList<QMcpTool> takeTools() {
+        clearModified(toolsIndex());
+        return std::exchange(d<Private>()->tools, QList<QMcpTool>());
+    }
+
+    void appendTool(const QMcpTool &tool) {
+        d<Private>()->tools.append(tool);
+        setModified(toolsIndex());
+    }
+
+    void appendTool(QMcpTool &&tool) {
+        d<Private>()->tools.append(std::move(tool));
+        setModified(toolsIndex());
+    }
+
+    template <typename... Args>
+    QMcpTool &emplaceTool(Args &&...args) {
+        setModified(toolsIndex());
+        return d<Private>()->tools.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
@@ -56,10 +97,30 @@ public:
     }
 
 private:
+    static int nextCursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("nextCursor");
+        return index;
+    }
+    static int toolsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("tools");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString nextCursor;
         QList<QMcpTool> tools;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && nextCursor == that.nextCursor
+                && tools == that.tools;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), nextCursor, tools);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpLoggingMessageNotification : public QMcpNotification
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString method READ method CONSTANT REQUIRED)
 
@@ -35,6 +36,18 @@ public:
     void setParams(const QMcpLoggingMessageNotificationParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpLoggingMessageNotificationParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpLoggingMessageNotificationParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpLoggingMessageNotificationParams());
     }
 
     const QMetaObject* metaObject() const override {
@@ -42,9 +55,24 @@ public:
     }
 
 private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
     struct Private : public QMcpNotification::Private {
         QMcpLoggingMessageNotificationParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotification::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotification::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
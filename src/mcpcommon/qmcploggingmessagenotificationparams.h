@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpLoggingMessageNotificationParams : public QMcpNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpLoggingMessageNotificationParams::data
@@ -46,6 +47,18 @@ public:
     void setData(const QJsonValue &data) {
         if (this->data() == data) return;
         d<Private>()->data = data;
+        setModified(dataIndex());
+    }
+
+    void setData(QJsonValue &&data) {
+        if (!isModified(dataIndex()) && this->data() == data) return;
+        d<Private>()->data = std::move(data);
+        setModified(dataIndex());
+    }
+
+    QJsonValue takeData() {
+        clearModified(dataIndex());
+        return std::exchange(d<Private>()->data, QJsonValue());
     }
 
     QMcpLoggingLevel::QMcpLoggingLevel level() const {
@@ -55,6 +68,7 @@ public:
     void setLevel(QMcpLoggingLevel::QMcpLoggingLevel level) {
         if (this->level() == level) return;
         d<Private>()->level = level;
+        setModified(levelIndex());
     }
 
     QString logger() const {
@@ -64,6 +78,18 @@ public:
     void setLogger(const QString &logger) {
         if (this->logger() == logger) return;
         d<Private>()->logger = logger;
+        setModified(loggerIndex());
+    }
+
+    void setLogger(QString &&logger) {
+        if (!isModified(loggerIndex()) && this->logger() == logger) return;
+        d<Private>()->logger = std::move(logger);
+        setModified(loggerIndex());
+    }
+
+    QString takeLogger() {
+        clearModified(loggerIndex());
+        return std::exchange(d<Private>()->logger, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -71,11 +97,36 @@ public:
     }
 
 private:
+    static int dataIndex() {
+        static const int index = staticMetaObject.indexOfProperty("data");
+        return index;
+    }
+    static int levelIndex() {
+        static const int index = staticMetaObject.indexOfProperty("level");
+        return index;
+    }
+    static int loggerIndex() {
+        static const int index = staticMetaObject.indexOfProperty("logger");
+        return index;
+    }
+
     struct Private : public QMcpNotificationParams::Private {
         QJsonValue data;
         QMcpLoggingLevel::QMcpLoggingLevel level = QMcpLoggingLevel::alert;
         QString logger;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotificationParams::Private::equals(other)
+                && data == that.data
+                && level == that.level
+                && logger == that.logger;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotificationParams::Private::hash(seed), data, level, logger);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
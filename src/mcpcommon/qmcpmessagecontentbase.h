@@ -22,33 +22,27 @@ class Q_MCPCOMMON_EXPORT QMcpMessageContentBase : public QMcpAnyOf
 
 public:
     QMcpTextContent textContent() const {
-        return d<Private>()->textContent;
+        return alternative<QMcpTextContent>("textContent");
     }
 
     void setTextContent(const QMcpTextContent &textContent) {
-        if (this->textContent() == textContent) return;
-        setRefType("textContent"_ba);
-        d<Private>()->textContent = textContent;
+        setAlternative("textContent"_ba, textContent);
     }
 
     QMcpImageContent imageContent() const {
-        return d<Private>()->imageContent;
+        return alternative<QMcpImageContent>("imageContent");
     }
 
     void setImageContent(const QMcpImageContent &imageContent) {
-        if (this->imageContent() == imageContent) return;
-        setRefType("imageContent"_ba);
-        d<Private>()->imageContent = imageContent;
+        setAlternative("imageContent"_ba, imageContent);
     }
 
     QMcpAudioContent audioContent() const {
-        return d<Private>()->audioContent;
+        return alternative<QMcpAudioContent>("audioContent");
     }
 
     void setAudioContent(const QMcpAudioContent &audioContent) {
-        if (this->audioContent() == audioContent) return;
-        setRefType("audioContent"_ba);
-        d<Private>()->audioContent = audioContent;
+        setAlternative("audioContent"_ba, audioContent);
     }
 
 protected:
@@ -56,10 +50,6 @@ protected:
     QMcpMessageContentBase(Private *d) : QMcpAnyOf(d) {}
 
     struct Private : public QMcpAnyOf::Private {
-        QMcpTextContent textContent;
-        QMcpImageContent imageContent;
-        QMcpAudioContent audioContent;
-
         // Find property index based on JSON object content
         int findPropertyIndex(const QJsonObject &object) const override {
             int ret = -1;
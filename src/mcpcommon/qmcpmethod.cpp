@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpmethod.h"
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// in the order of QMcpMethod::Id
+constexpr QLatin1StringView names[] = {
+    "initialize"_L1,
+    "ping"_L1,
+    "completion/complete"_L1,
+    "logging/setLevel"_L1,
+    "prompts/get"_L1,
+    "prompts/list"_L1,
+    "resources/list"_L1,
+    "resources/read"_L1,
+    "resources/subscribe"_L1,
+    "resources/templates/list"_L1,
+    "resources/unsubscribe"_L1,
+    "roots/list"_L1,
+    "sampling/createMessage"_L1,
+    "tools/call"_L1,
+    "tools/list"_L1,
+    "notifications/cancelled"_L1,
+    "notifications/initialized"_L1,
+    "notifications/message"_L1,
+    "notifications/progress"_L1,
+    "notifications/prompts/list_changed"_L1,
+    "notifications/resources/list_changed"_L1,
+    "notifications/resources/updated"_L1,
+    "notifications/roots/list_changed"_L1,
+    "notifications/tools/list_changed"_L1,
+};
+static_assert(std::size(names) == QMcpMethod::KnownCount);
+
+constexpr int slotCount = 64;
+
+// FNV-1a with a seed, folded to a slot
+template <typename Char>
+constexpr int slotOf(const Char *data, qsizetype size, quint32 seed)
+{
+    quint32 hash = 2166136261u ^ seed;
+    for (qsizetype i = 0; i < size; i++)
+        hash = (hash ^ quint32(data[i])) * 16777619u;
+    hash ^= hash >> 15;
+    return int(hash % slotCount);
+}
+
+struct PerfectHash {
+    quint32 seed = 0;
+    qint8 slots[slotCount] = {};
+};
+
+// tries seeds until every name lands in a slot of its own
+constexpr PerfectHash generatePerfectHash()
+{
+    PerfectHash table;
+    for (quint32 seed = 1; seed < 100000; seed++) {
+        for (auto &slot : table.slots)
+            slot = QMcpMethod::Unknown;
+        bool perfect = true;
+        for (int id = 0; id < QMcpMethod::KnownCount && perfect; id++) {
+            auto &slot = table.slots[slotOf(names[id].data(), names[id].size(), seed)];
+            perfect = slot == QMcpMethod::Unknown;
+            slot = qint8(id);
+        }
+        if (perfect) {
+            table.seed = seed;
+            return table;
+        }
+    }
+    return PerfectHash {};
+}
+
+constexpr PerfectHash perfectHash = generatePerfectHash();
+static_assert(perfectHash.seed != 0, "no perfect hash found for the method names, increase slotCount");
+
+template <typename Char>
+QMcpMethod::Id lookup(const Char *data, qsizetype size)
+{
+    const auto id = perfectHash.slots[slotOf(data, size, perfectHash.seed)];
+    if (id == QMcpMethod::Unknown)
+        return QMcpMethod::Unknown;
+    const auto name = names[id];
+    if (name.size() != size)
+        return QMcpMethod::Unknown;
+    for (qsizetype i = 0; i < size; i++) {
+        if (quint32(data[i]) != uchar(name.data()[i]))
+            return QMcpMethod::Unknown;
+    }
+    return QMcpMethod::Id(id);
+}
+}
+
+/*!
+    Returns the ID of the method named \a method in UTF-8, or Unknown if it
+    is not defined by the specification.
+*/
+QMcpMethod::Id QMcpMethod::id(QByteArrayView method)
+{
+    return lookup(reinterpret_cast<const uchar *>(method.data()), method.size());
+}
+
+/*!
+    \overload
+*/
+QMcpMethod::Id QMcpMethod::id(QStringView method)
+{
+    return lookup(method.utf16(), method.size());
+}
+
+/*!
+    Returns the name of the method with the ID \a id, or an empty string
+    for Unknown.
+*/
+QLatin1StringView QMcpMethod::name(Id id)
+{
+    if (id < 0 || id >= KnownCount)
+        return {};
+    return names[id];
+}
+
+/*!
+    Returns the ID of \a method, assigning the next free one to a custom
+    method seen for the first time.
+*/
+int QMcpMethodTable::intern(const QString &method)
+{
+    const auto id = QMcpMethod::id(method);
+    if (id != QMcpMethod::Unknown)
+        return id;
+    const auto it = custom.constFind(method);
+    if (it != custom.constEnd())
+        return it.value();
+    const int next = int(size());
+    custom.insert(method, next);
+    return next;
+}
+
+/*!
+    Returns the ID of \a method, or -1 if it is neither a known method nor
+    interned.
+*/
+int QMcpMethodTable::find(QStringView method) const
+{
+    const auto id = QMcpMethod::id(method);
+    if (id != QMcpMethod::Unknown || custom.isEmpty())
+        return id;
+    return custom.value(method.toString(), -1);
+}
+
+/*!
+    \overload
+*/
+int QMcpMethodTable::find(QByteArrayView method) const
+{
+    const auto id = QMcpMethod::id(method);
+    if (id != QMcpMethod::Unknown || custom.isEmpty())
+        return id;
+    return custom.value(QString::fromUtf8(method), -1);
+}
+
+QT_END_NAMESPACE
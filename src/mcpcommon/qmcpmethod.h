@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPMETHOD_H
+#define QMCPMETHOD_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpMethod
+    \inmodule QtMcpCommon
+    \brief Maps the method names of MCP messages to small integer IDs.
+
+    Every method defined by the MCP specification has an Id. id() finds it
+    with a perfect hash over the characters of the name, built at compile
+    time, followed by a single comparison, so no QHash lookup and no
+    allocation is needed to tell which method a message calls.
+
+    QMcpMethodTable extends the IDs with the custom methods an application
+    registers handlers for.
+*/
+class Q_MCPCOMMON_EXPORT QMcpMethod
+{
+public:
+    enum Id : int {
+        Unknown = -1,
+        Initialize,
+        Ping,
+        CompletionComplete,
+        LoggingSetLevel,
+        PromptsGet,
+        PromptsList,
+        ResourcesList,
+        ResourcesRead,
+        ResourcesSubscribe,
+        ResourcesTemplatesList,
+        ResourcesUnsubscribe,
+        RootsList,
+        SamplingCreateMessage,
+        ToolsCall,
+        ToolsList,
+        NotificationsCancelled,
+        NotificationsInitialized,
+        NotificationsMessage,
+        NotificationsProgress,
+        NotificationsPromptsListChanged,
+        NotificationsResourcesListChanged,
+        NotificationsResourcesUpdated,
+        NotificationsRootsListChanged,
+        NotificationsToolsListChanged,
+        KnownCount
+    };
+
+    static Id id(QByteArrayView method);
+    static Id id(QStringView method);
+    static QLatin1StringView name(Id id);
+};
+
+/*! \class QMcpMethodTable
+    \inmodule QtMcpCommon
+    \brief Interns method names into IDs for dispatch tables.
+
+    The known methods keep their QMcpMethod::Id, custom methods get the next
+    free ID when they are interned. The IDs are dense, so a dispatcher can
+    keep its handlers in a list of size() entries indexed by ID.
+*/
+class Q_MCPCOMMON_EXPORT QMcpMethodTable
+{
+public:
+    int intern(const QString &method);
+    int find(QStringView method) const;
+    int find(QByteArrayView method) const;
+    qsizetype size() const { return QMcpMethod::KnownCount + custom.size(); }
+
+private:
+    QHash<QString, int> custom;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPMETHOD_H
@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpModelHint : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpModelHint::name
@@ -44,6 +45,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -51,9 +64,24 @@ public:
     }
 
 private:
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
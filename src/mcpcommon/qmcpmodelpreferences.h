@@ -27,6 +27,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpModelPreferences : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpModelPreferences::costPriority
@@ -80,6 +81,7 @@ public:
     void setCostPriority(qreal costPriority) {
         if (this->costPriority() == costPriority) return;
         d<Private>()->costPriority = costPriority;
+        setModified(costPriorityIndex());
     }
 
     QList<QMcpModelHint> hints() const {
@@ -89,6 +91,34 @@ public:
     void setHints(const QList<QMcpModelHint> &hints) {
         if (this->hints() == hints) return;
         d<Private>()->hints = hints;
+        setModified(hintsIndex());
+    }
+
+    void setHints(QList<QMcpModelHint> &&hints) {
+        if (!isModified(hintsIndex()) && this->hints() == hints) return;
+        d<Private>()->hints = std::move(hints);
+        setModified(hintsIndex());
+    }
+
+    QList<QMcpModelHint> takeHints() {
+        clearModified(hintsIndex());
+        return std::exchange(d<Private>()->hints, QList<QMcpModelHint>());
+    }
+
+    void appendHint(const QMcpModelHint &hint) {
+        d<Private>()->hints.append(hint);
+        setModified(hintsIndex());
+    }
+
+    void appendHint(QMcpModelHint &&hint) {
+        d<Private>()->hints.append(std::move(hint));
+        setModified(hintsIndex());
+    }
+
+    template <typename... Args>
+    QMcpModelHint &emplaceHint(Args &&...args) {
+        setModified(hintsIndex());
+        return d<Private>()->hints.emplaceBack(std::forward<Args>(args)...);
     }
 
     qreal intelligencePriority() const {
@@ -98,6 +128,7 @@ public:
     void setIntelligencePriority(qreal intelligencePriority) {
         if (this->intelligencePriority() == intelligencePriority) return;
         d<Private>()->intelligencePriority = intelligencePriority;
+        setModified(intelligencePriorityIndex());
     }
 
     qreal speedPriority() const {
@@ -107,11 +138,30 @@ public:
     void setSpeedPriority(qreal speedPriority) {
         if (this->speedPriority() == speedPriority) return;
         d<Private>()->speedPriority = speedPriority;
+        setModified(speedPriorityIndex());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
+private:
+    static int costPriorityIndex() {
+        static const int index = staticMetaObject.indexOfProperty("costPriority");
+        return index;
+    }
+    static int hintsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("hints");
+        return index;
+    }
+    static int intelligencePriorityIndex() {
+        static const int index = staticMetaObject.indexOfProperty("intelligencePriority");
+        return index;
+    }
+    static int speedPriorityIndex() {
+        static const int index = staticMetaObject.indexOfProperty("speedPriority");
+        return index;
+    }
+
 public:
     struct Private : public QMcpGadget::Private {
         qreal costPriority = 0;
@@ -119,6 +169,19 @@ public:
         qreal intelligencePriority = 0;
         qreal speedPriority = 0;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && costPriority == that.costPriority
+                && hints == that.hints
+                && intelligencePriority == that.intelligencePriority
+                && speedPriority == that.speedPriority;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), costPriority, hints, intelligencePriority, speedPriority);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpNotification : public QMcpJSONRPCNotification
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpNotificationParams params READ params WRITE setParams)
 
@@ -30,16 +31,44 @@ public:
     void setParams(const QMcpNotificationParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpNotificationParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpNotificationParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpNotificationParams());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 
+private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCNotification::Private {
         QMcpNotificationParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpJSONRPCNotification::Private::equals(other)
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpJSONRPCNotification::Private::hash(seed), params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
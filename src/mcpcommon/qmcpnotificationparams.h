@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpNotificationParams : public QMcpJSONRPCNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
 #if 0
     /*!
@@ -38,6 +39,18 @@ public:
     void setMeta(const QMcpNotificationParamsMeta &meta) {
         if (_meta() == meta) return;
         d<Private>()->_meta = meta;
+        setModified(metaIndex());
+    }
+
+    void setMeta(QMcpNotificationParamsMeta &&meta) {
+        if (!isModified(metaIndex()) && _meta() == meta) return;
+        d<Private>()->_meta = std::move(meta);
+        setModified(metaIndex());
+    }
+
+    QMcpNotificationParamsMeta take_meta() {
+        clearModified(metaIndex());
+        return std::exchange(d<Private>()->_meta, QMcpNotificationParamsMeta());
     }
 #endif
 
@@ -45,6 +58,12 @@ public:
         return &staticMetaObject;
     }
 
+private:
+    static int metaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("_meta");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCNotificationParams::Private {
 #if 0
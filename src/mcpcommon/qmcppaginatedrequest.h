@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPaginatedRequest : public QMcpRequest
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QString method READ method WRITE setMethod REQUIRED)
     Q_PROPERTY(QMcpPaginatedRequestParams params READ params WRITE setParams)
@@ -30,6 +31,18 @@ public:
     void setMethod(const QString &method) {
         if (this->method() == method) return;
         d<Private>()->method = method;
+        setModified(methodIndex());
+    }
+
+    void setMethod(QString &&method) {
+        if (!isModified(methodIndex()) && this->method() == method) return;
+        d<Private>()->method = std::move(method);
+        setModified(methodIndex());
+    }
+
+    QString takeMethod() {
+        clearModified(methodIndex());
+        return std::exchange(d<Private>()->method, QString());
     }
 
     QMcpPaginatedRequestParams params() const {
@@ -39,6 +52,18 @@ public:
     void setParams(const QMcpPaginatedRequestParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpPaginatedRequestParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpPaginatedRequestParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpPaginatedRequestParams());
     }
 
     const QMetaObject* metaObject() const override {
@@ -46,10 +71,30 @@ public:
     }
 
 private:
+    static int methodIndex() {
+        static const int index = staticMetaObject.indexOfProperty("method");
+        return index;
+    }
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
     struct Private : public QMcpRequest::Private {
         QString method;
         QMcpPaginatedRequestParams params;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpRequest::Private::equals(other)
+                && method == that.method
+                && params == that.params;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpRequest::Private::hash(seed), method, params);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPaginatedResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpPaginatedResult::nextCursor
@@ -33,6 +34,18 @@ public:
     void setNextCursor(const QString &cursor) {
         if (nextCursor() == cursor) return;
         d<Private>()->nextCursor = cursor;
+        setModified(nextCursorIndex());
+    }
+
+    void setNextCursor(QString &&cursor) {
+        if (!isModified(nextCursorIndex()) && nextCursor() == cursor) return;
+        d<Private>()->nextCursor = std::move(cursor);
+        setModified(nextCursorIndex());
+    }
+
+    QString takeNextCursor() {
+        clearModified(nextCursorIndex());
+        return std::exchange(d<Private>()->nextCursor, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -40,9 +53,24 @@ public:
     }
 
 private:
+    static int nextCursorIndex() {
+        static const int index = staticMetaObject.indexOfProperty("nextCursor");
+        return index;
+    }
+
     struct Private : public QMcpResult::Private {
         QString nextCursor;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && nextCursor == that.nextCursor;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), nextCursor);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
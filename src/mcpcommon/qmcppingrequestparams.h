@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPingRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
 #if 0
     Q_PROPERTY(QMcpPingRequestParamsMeta _meta READ meta WRITE setMeta)
@@ -33,6 +34,7 @@ public:
     void setMeta(const QMcpPingRequestParamsMeta &meta) {
         if (this->meta() == meta) return;
         d<Private>()->_meta = meta;
+        setModified(metaIndex());
     }
 
     QJsonObject additionalProperties() const {
@@ -42,6 +44,18 @@ public:
     void setAdditionalProperties(const QJsonObject &props) {
         if (this->additionalProperties() == props) return;
         d<Private>()->additionalProperties = props;
+        setModified(additionalPropertiesIndex());
+    }
+
+    void setAdditionalProperties(QJsonObject &&props) {
+        if (!isModified(additionalPropertiesIndex()) && this->additionalProperties() == props) return;
+        d<Private>()->additionalProperties = std::move(props);
+        setModified(additionalPropertiesIndex());
+    }
+
+    QJsonObject takeAdditionalProperties() {
+        clearModified(additionalPropertiesIndex());
+        return std::exchange(d<Private>()->additionalProperties, QJsonObject());
     }
 #endif
 
@@ -50,6 +64,15 @@ public:
     }
 
 private:
+    static int metaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("_meta");
+        return index;
+    }
+    static int additionalPropertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("additionalProperties");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
 #if 0
         QMcpPingRequestParamsMeta _meta;
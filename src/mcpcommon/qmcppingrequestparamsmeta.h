@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPingRequestParamsMeta : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpPingRequestParamsMeta::progressToken
@@ -32,6 +33,18 @@ public:
     void setProgressToken(const QMcpProgressToken &token) {
         if (this->progressToken() == token) return;
         d<Private>()->progressToken = token;
+        setModified(progressTokenIndex());
+    }
+
+    void setProgressToken(QMcpProgressToken &&token) {
+        if (!isModified(progressTokenIndex()) && this->progressToken() == token) return;
+        d<Private>()->progressToken = std::move(token);
+        setModified(progressTokenIndex());
+    }
+
+    QMcpProgressToken takeProgressToken() {
+        clearModified(progressTokenIndex());
+        return std::exchange(d<Private>()->progressToken, QMcpProgressToken());
     }
 
     const QMetaObject* metaObject() const override {
@@ -39,9 +52,20 @@ public:
     }
 
 private:
+    static int progressTokenIndex() {
+        static const int index = staticMetaObject.indexOfProperty("progressToken");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpProgressToken progressToken;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && progressToken == that.progressToken;
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
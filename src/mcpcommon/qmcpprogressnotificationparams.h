@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpProgressNotificationParams : public QMcpNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpProgressNotificationParams::progress
@@ -48,6 +49,7 @@ public:
     void setProgress(qreal progress) {
         if (qFuzzyCompare(this->progress(), progress)) return;
         d<Private>()->progress = progress;
+        setModified(progressIndex());
     }
 
     QMcpProgressToken progressToken() const {
@@ -57,6 +59,18 @@ public:
     void setProgressToken(const QMcpProgressToken &token) {
         if (this->progressToken() == token) return;
         d<Private>()->progressToken = token;
+        setModified(progressTokenIndex());
+    }
+
+    void setProgressToken(QMcpProgressToken &&token) {
+        if (!isModified(progressTokenIndex()) && this->progressToken() == token) return;
+        d<Private>()->progressToken = std::move(token);
+        setModified(progressTokenIndex());
+    }
+
+    QMcpProgressToken takeProgressToken() {
+        clearModified(progressTokenIndex());
+        return std::exchange(d<Private>()->progressToken, QMcpProgressToken());
     }
 
     qreal total() const {
@@ -66,6 +80,7 @@ public:
     void setTotal(qreal total) {
         if (qFuzzyCompare(this->total(), total)) return;
         d<Private>()->total = total;
+        setModified(totalIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -73,11 +88,36 @@ public:
     }
 
 private:
+    static int progressIndex() {
+        static const int index = staticMetaObject.indexOfProperty("progress");
+        return index;
+    }
+    static int progressTokenIndex() {
+        static const int index = staticMetaObject.indexOfProperty("progressToken");
+        return index;
+    }
+    static int totalIndex() {
+        static const int index = staticMetaObject.indexOfProperty("total");
+        return index;
+    }
+
     struct Private : public QMcpNotificationParams::Private {
         qreal progress = 0;
         QMcpProgressToken progressToken;
         qreal total = 0;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotificationParams::Private::equals(other)
+                && progress == that.progress
+                && progressToken == that.progressToken
+                && total == that.total;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotificationParams::Private::hash(seed), progress, total);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPrompt : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpPrompt::arguments
@@ -49,6 +50,34 @@ public:
     void setArguments(const QList<QMcpPromptArgument> &arguments) {
         if (this->arguments() == arguments) return;
         d<Private>()->arguments = arguments;
+        setModified(argumentsIndex());
+    }
+
+    void setArguments(QList<QMcpPromptArgument> &&arguments) {
+        if (!isModified(argumentsIndex()) && this->arguments() == arguments) return;
+        d<Private>()->arguments = std::move(arguments);
+        setModified(argumentsIndex());
+    }
+
+    QList<QMcpPromptArgument> takeArguments() {
+        clearModified(argumentsIndex());
+        return std::exchange(d<Private>()->arguments, QList<QMcpPromptArgument>());
+    }
+
+    void appendArgument(const QMcpPromptArgument &argument) {
+        d<Private>()->arguments.append(argument);
+        setModified(argumentsIndex());
+    }
+
+    void appendArgument(QMcpPromptArgument &&argument) {
+        d<Private>()->arguments.append(std::move(argument));
+        setModified(argumentsIndex());
+    }
+
+    template <typename... Args>
+    QMcpPromptArgument &emplaceArgument(Args &&...args) {
+        setModified(argumentsIndex());
+        return d<Private>()->arguments.emplaceBack(std::forward<Args>(args)...);
     }
 
     QString description() const {
@@ -58,6 +87,18 @@ public:
     void setDescription(const QString &description) {
         if (this->description() == description) return;
         d<Private>()->description = description;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&description) {
+        if (!isModified(descriptionIndex()) && this->description() == description) return;
+        d<Private>()->description = std::move(description);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QString name() const {
@@ -67,6 +108,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -74,11 +127,36 @@ public:
     }
 
 private:
+    static int argumentsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("arguments");
+        return index;
+    }
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QList<QMcpPromptArgument> arguments;
         QString description;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && arguments == that.arguments
+                && description == that.description
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), arguments, description, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
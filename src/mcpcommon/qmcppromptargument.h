@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPromptArgument : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpPromptArgument::description
@@ -47,6 +48,18 @@ public:
     void setDescription(const QString &description) {
         if (this->description() == description) return;
         d<Private>()->description = description;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&description) {
+        if (!isModified(descriptionIndex()) && this->description() == description) return;
+        d<Private>()->description = std::move(description);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QString name() const {
@@ -56,6 +69,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     bool required() const {
@@ -65,6 +90,7 @@ public:
     void setRequired(bool required) {
         if (this->required() == required) return;
         d<Private>()->required = required;
+        setModified(requiredIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -72,11 +98,36 @@ public:
     }
 
 private:
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+    static int requiredIndex() {
+        static const int index = staticMetaObject.indexOfProperty("required");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString description;
         QString name;
         bool required = false;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && description == that.description
+                && name == that.name
+                && required == that.required;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), description, name, required);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
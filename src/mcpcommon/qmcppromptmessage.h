@@ -20,6 +20,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPromptMessage : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpPromptMessageContent content READ content WRITE setContent REQUIRED)
 
@@ -35,6 +36,18 @@ public:
     void setContent(const QMcpPromptMessageContent &content) {
         if (this->content() == content) return;
         d<Private>()->content = content;
+        setModified(contentIndex());
+    }
+
+    void setContent(QMcpPromptMessageContent &&content) {
+        if (!isModified(contentIndex()) && this->content() == content) return;
+        d<Private>()->content = std::move(content);
+        setModified(contentIndex());
+    }
+
+    QMcpPromptMessageContent takeContent() {
+        clearModified(contentIndex());
+        return std::exchange(d<Private>()->content, QMcpPromptMessageContent());
     }
 
     QMcpRole::QMcpRole role() const {
@@ -44,6 +57,7 @@ public:
     void setRole(const QMcpRole::QMcpRole &role) {
         if (this->role() == role) return;
         d<Private>()->role = role;
+        setModified(roleIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -51,10 +65,30 @@ public:
     }
 
 private:
+    static int contentIndex() {
+        static const int index = staticMetaObject.indexOfProperty("content");
+        return index;
+    }
+    static int roleIndex() {
+        static const int index = staticMetaObject.indexOfProperty("role");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpPromptMessageContent content;
         QMcpRole::QMcpRole role = QMcpRole::user;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && content == that.content
+                && role == that.role;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), content, role);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
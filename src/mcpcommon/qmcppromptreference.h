@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpPromptReference : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpPromptReference::name
@@ -36,6 +37,7 @@ public:
     void setName(const QString& name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
     }
 
     QByteArray type() const {
@@ -47,9 +49,24 @@ public:
     }
 
 private:
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
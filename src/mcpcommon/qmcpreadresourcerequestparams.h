@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpReadResourceRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpReadResourceRequestParams::uri
@@ -32,6 +33,18 @@ public:
     void setUri(const QUrl &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QUrl &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QUrl takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QUrl());
     }
 
     const QMetaObject* metaObject() const override {
@@ -39,9 +52,24 @@ public:
     }
 
 private:
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QUrl uri;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && uri == that.uri;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), uri);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,30 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPREADRESOURCEREQUESTPARAMSVIEW_H
+#define QMCPREADRESOURCEREQUESTPARAMSVIEW_H
+
+#include <QtCore/QUrl>
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpreadresourcerequestparams.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpReadResourceRequestParamsView
+    \inmodule QtMcpCommon
+    \brief Read-only view over the JSON of a \l QMcpReadResourceRequestParams.
+*/
+class QMcpReadResourceRequestParamsView : public QMcpJsonView
+{
+public:
+    using Gadget = QMcpReadResourceRequestParams;
+    using QMcpJsonView::QMcpJsonView;
+
+    QUrl uri() const {
+        return QUrl(string("uri"_L1));
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPREADRESOURCEREQUESTPARAMSVIEW_H
@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPREADRESOURCEREQUESTVIEW_H
+#define QMCPREADRESOURCEREQUESTVIEW_H
+
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpreadresourcerequest.h>
+#include <QtMcpCommon/qmcpreadresourcerequestparamsview.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpReadResourceRequestView
+    \inmodule QtMcpCommon
+    \brief Read-only view over the JSON of a \l QMcpReadResourceRequest.
+*/
+class QMcpReadResourceRequestView : public QMcpJsonRequestView<QMcpReadResourceRequestParamsView>
+{
+public:
+    using Gadget = QMcpReadResourceRequest;
+    using QMcpJsonRequestView::QMcpJsonRequestView;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPREADRESOURCEREQUESTVIEW_H
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpReadResourceResult : public QMcpResult
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QList<QMcpReadResourceResultContents> contents READ contents WRITE setContents REQUIRED)
 
@@ -32,15 +33,59 @@ public:
     void setContents(const QList<QMcpReadResourceResultContents> &contents) {
         if (this->contents() == contents) return;
         d<Private>()->contents = contents;
+        setModified(contentsIndex());
+    }
+
+    void setContents(QList<QMcpReadResourceResultContents> &&contents) {
+        if (!isModified(contentsIndex()) && this->contents() == contents) return;
+        d<Private>()->contents = std::move(contents);
+        setModified(contentsIndex());
+    }
+
+    QList<QMcpReadResourceResultContents> takeContents() {
+        clearModified(contentsIndex());
+        return std::exchange(d<Private>()->contents, QList<QMcpReadResourceResultContents>());
+    }
+
+    void appendContent(const QMcpReadResourceResultContents &content) {
+        d<Private>()->contents.append(content);
+        setModified(contentsIndex());
+    }
+
+    void appendContent(QMcpReadResourceResultContents &&content) {
+        d<Private>()->contents.append(std::move(content));
+        setModified(contentsIndex());
+    }
+
+    template <typename... Args>
+    QMcpReadResourceResultContents &emplaceContent(Args &&...args) {
+        setModified(contentsIndex());
+        return d<Private>()->contents.emplaceBack(std::forward<Args>(args)...);
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
+private:
+    static int contentsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("contents");
+        return index;
+    }
+
 public:
     struct Private : public QMcpResult::Private {
         QList<QMcpReadResourceResultContents> contents;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpResult::Private::equals(other)
+                && contents == that.contents;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpResult::Private::hash(seed), contents);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpRequest : public QMcpJSONRPCRequest
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
 #if 0
     Q_PROPERTY(QMcpRequestParams params READ params WRITE setParams)
@@ -34,6 +35,18 @@ public:
     void setParams(const QMcpRequestParams &params) {
         if (this->params() == params) return;
         d<Private>()->params = params;
+        setModified(paramsIndex());
+    }
+
+    void setParams(QMcpRequestParams &&params) {
+        if (!isModified(paramsIndex()) && this->params() == params) return;
+        d<Private>()->params = std::move(params);
+        setModified(paramsIndex());
+    }
+
+    QMcpRequestParams takeParams() {
+        clearModified(paramsIndex());
+        return std::exchange(d<Private>()->params, QMcpRequestParams());
     }
 #endif
 
@@ -41,6 +54,12 @@ public:
         return &staticMetaObject;
     }
 
+private:
+    static int paramsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("params");
+        return index;
+    }
+
 protected:
     struct Private : public QMcpJSONRPCRequest::Private {
 #if 0
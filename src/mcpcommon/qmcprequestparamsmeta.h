@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpRequestParamsMeta : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpRequestParamsMeta::progressToken
@@ -32,15 +33,27 @@ public:
     void setProgressToken(QMcpProgressToken progressToken) {
         if (this->progressToken() == progressToken) return;
         d<Private>()->progressToken = progressToken;
+        setModified(progressTokenIndex());
     }
 
     const QMetaObject* metaObject() const override {
         return &staticMetaObject;
     }
 private:
+    static int progressTokenIndex() {
+        static const int index = staticMetaObject.indexOfProperty("progressToken");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpProgressToken progressToken;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && progressToken == that.progressToken;
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpResource : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
 
@@ -69,6 +70,18 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     QString description() const {
@@ -78,6 +91,18 @@ public:
     void setDescription(const QString &description) {
         if (this->description() == description) return;
         d<Private>()->description = description;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&description) {
+        if (!isModified(descriptionIndex()) && this->description() == description) return;
+        d<Private>()->description = std::move(description);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QString mimeType() const {
@@ -87,6 +112,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QString name() const {
@@ -96,6 +133,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     int size() const {
@@ -105,6 +154,7 @@ public:
     void setSize(int size) {
         if (this->size() == size) return;
         d<Private>()->size = size;
+        setModified(sizeIndex());
     }
 
     QUrl uri() const {
@@ -114,6 +164,18 @@ public:
     void setUri(const QUrl &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QUrl &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QUrl takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QUrl());
     }
 
     const QMetaObject* metaObject() const override {
@@ -121,6 +183,31 @@ public:
     }
 
 private:
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+    static int sizeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("size");
+        return index;
+    }
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpAnnotations annotations;
         QString description;
@@ -129,6 +216,21 @@ private:
         int size = 0;
         QUrl uri;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations
+                && description == that.description
+                && mimeType == that.mimeType
+                && name == that.name
+                && size == that.size
+                && uri == that.uri;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), annotations, description, mimeType, name, size, uri);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpResourceContents : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpResourceContents::mimeType
@@ -40,6 +41,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QUrl uri() const {
@@ -49,6 +62,18 @@ public:
     void setUri(const QUrl &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QUrl &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QUrl takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QUrl());
     }
 
     const QMetaObject* metaObject() const override {
@@ -56,10 +81,30 @@ public:
     }
 
 private:
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString mimeType;
         QUrl uri;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && mimeType == that.mimeType
+                && uri == that.uri;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), mimeType, uri);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpResourceReference : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QByteArray type READ type CONSTANT REQUIRED)
 
@@ -40,6 +41,18 @@ public:
     void setUri(const QString &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QString &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QString takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -47,10 +60,26 @@ public:
     }
 
 private:
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         const QByteArray type = QByteArrayLiteral("ref/resource");
         QString uri;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && type == that.type
+                && uri == that.uri;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), type, uri);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
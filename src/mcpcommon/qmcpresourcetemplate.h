@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpResourceTemplate : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
 
@@ -58,6 +59,18 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     QString description() const {
@@ -67,6 +80,18 @@ public:
     void setDescription(const QString &description) {
         if (this->description() == description) return;
         d<Private>()->description = description;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&description) {
+        if (!isModified(descriptionIndex()) && this->description() == description) return;
+        d<Private>()->description = std::move(description);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QString mimeType() const {
@@ -76,6 +101,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QString name() const {
@@ -85,6 +122,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     QString uriTemplate() const {
@@ -94,6 +143,18 @@ public:
     void setUriTemplate(const QString &uriTemplate) {
         if (this->uriTemplate() == uriTemplate) return;
         d<Private>()->uriTemplate = uriTemplate;
+        setModified(uriTemplateIndex());
+    }
+
+    void setUriTemplate(QString &&uriTemplate) {
+        if (!isModified(uriTemplateIndex()) && this->uriTemplate() == uriTemplate) return;
+        d<Private>()->uriTemplate = std::move(uriTemplate);
+        setModified(uriTemplateIndex());
+    }
+
+    QString takeUriTemplate() {
+        clearModified(uriTemplateIndex());
+        return std::exchange(d<Private>()->uriTemplate, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -101,6 +162,27 @@ public:
     }
 
 private:
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+    static int uriTemplateIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uriTemplate");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpAnnotations annotations;
         QString description;
@@ -108,6 +190,20 @@ private:
         QString name;
         QString uriTemplate;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations
+                && description == that.description
+                && mimeType == that.mimeType
+                && name == that.name
+                && uriTemplate == that.uriTemplate;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), annotations, description, mimeType, name, uriTemplate);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
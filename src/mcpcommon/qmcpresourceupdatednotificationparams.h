@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpResourceUpdatedNotificationParams : public QMcpNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpResourceUpdatedNotificationParams::uri
@@ -32,6 +33,7 @@ public:
     void setUri(const QUrl& uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -39,9 +41,24 @@ public:
     }
 
 private:
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+
     struct Private : public QMcpNotificationParams::Private {
         QUrl uri;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotificationParams::Private::equals(other)
+                && uri == that.uri;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotificationParams::Private::hash(seed), uri);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
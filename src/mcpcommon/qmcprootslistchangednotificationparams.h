@@ -16,6 +16,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpRootsListChangedNotificationParams : public QMcpNotificationParams
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpRootsListChangedNotificationParams::_meta
@@ -33,6 +34,7 @@ public:
     void setMeta(const QMcpRootsListChangedNotificationParamsMeta &meta) {
         if (this->meta() == meta) return;
         d<Private>()->_meta = meta;
+        setModified(metaIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -40,9 +42,24 @@ public:
     }
 
 private:
+    static int metaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("_meta");
+        return index;
+    }
+
     struct Private : public QMcpNotificationParams::Private {
         QMcpRootsListChangedNotificationParamsMeta _meta;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpNotificationParams::Private::equals(other)
+                && _meta == that._meta;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpNotificationParams::Private::hash(seed), _meta);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
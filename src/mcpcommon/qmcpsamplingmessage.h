@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpSamplingMessage : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpSamplingMessageContent content READ content WRITE setContent REQUIRED)
 
@@ -32,6 +33,7 @@ public:
     void setContent(const QMcpSamplingMessageContent& content) {
         if (this->content() == content) return;
         d<Private>()->content = content;
+        setModified(contentIndex());
     }
 
     QMcpRole::QMcpRole role() const {
@@ -41,6 +43,7 @@ public:
     void setRole(const QMcpRole::QMcpRole& role) {
         if (this->role() == role) return;
         d<Private>()->role = role;
+        setModified(roleIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -48,10 +51,30 @@ public:
     }
 
 private:
+    static int contentIndex() {
+        static const int index = staticMetaObject.indexOfProperty("content");
+        return index;
+    }
+    static int roleIndex() {
+        static const int index = staticMetaObject.indexOfProperty("role");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpSamplingMessageContent content;
         QMcpRole::QMcpRole role = QMcpRole::assistant;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && content == that.content
+                && role == that.role;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), content, role);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
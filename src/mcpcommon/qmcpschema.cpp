@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpschema_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+struct QMcpSchemaVersion {
+    QtMcp::ProtocolVersion protocolVersion;
+    QSpan<const QMcpSchema::Field> fields;
+};
+
+#include "qmcpschemadata_p.h"
+}
+
+QList<QtMcp::ProtocolVersion> QMcpSchema::protocolVersions()
+{
+    QList<QtMcp::ProtocolVersion> ret;
+    for (const auto &version : versions)
+        ret.append(version.protocolVersion);
+    return ret;
+}
+
+QSpan<const QMcpSchema::Field> QMcpSchema::fields(QtMcp::ProtocolVersion protocolVersion, QLatin1StringView type)
+{
+    for (const auto &version : versions) {
+        if (version.protocolVersion != protocolVersion)
+            continue;
+        // the generated tables are sorted by type, then by key
+        const auto range = std::equal_range(version.fields.begin(), version.fields.end(), type,
+                                            [](const auto &lhs, const auto &rhs) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(lhs)>, Field>)
+                return QLatin1StringView(lhs.type) < rhs;
+            else
+                return lhs < QLatin1StringView(rhs.type);
+        });
+        return QSpan<const Field>(range.first, range.second);
+    }
+    return {};
+}
+
+const QMcpSchema::Field *QMcpSchema::field(QtMcp::ProtocolVersion protocolVersion, QLatin1StringView type, QLatin1StringView key)
+{
+    for (const auto &field : fields(protocolVersion, type)) {
+        if (key == QLatin1StringView(field.key))
+            return &field;
+    }
+    return nullptr;
+}
+
+QT_END_NAMESPACE
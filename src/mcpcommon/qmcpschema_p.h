@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPSCHEMA_P_H
+#define QMCPSCHEMA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtMcpCommon/qtmcpnamespace.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qspan.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+// The fields of every object type of the MCP JSON schemas, generated at
+// build time by generate_schema.cmake. Types are named like the gadget
+// classes without the QMcp prefix, e.g. "CallToolRequestParams".
+class Q_MCPCOMMON_EXPORT QMcpSchema
+{
+public:
+    enum JsonType : quint8 {
+        Any,
+        Object,
+        Array,
+        String,
+        Number,
+        Integer,
+        Boolean,
+    };
+
+    struct Field {
+        const char *type;
+        const char *key;
+        JsonType jsonType;
+        bool required;
+        // the value of a "const" field, nullptr otherwise
+        const char *constant;
+    };
+
+    // the versions there is a schema for
+    static QList<QtMcp::ProtocolVersion> protocolVersions();
+
+    // sorted by key, empty when the schema of the version has no such type
+    static QSpan<const Field> fields(QtMcp::ProtocolVersion protocolVersion, QLatin1StringView type);
+    static const Field *field(QtMcp::ProtocolVersion protocolVersion, QLatin1StringView type, QLatin1StringView key);
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPSCHEMA_P_H
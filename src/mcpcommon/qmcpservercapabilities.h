@@ -20,6 +20,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpServerCapabilities : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpServerCapabilities::experimental
@@ -61,6 +62,18 @@ public:
     void setExperimental(const QMcpServerCapabilitiesExperimental &experimental) {
         if (this->experimental() == experimental) return;
         d<Private>()->experimental = experimental;
+        setModified(experimentalIndex());
+    }
+
+    void setExperimental(QMcpServerCapabilitiesExperimental &&experimental) {
+        if (!isModified(experimentalIndex()) && this->experimental() == experimental) return;
+        d<Private>()->experimental = std::move(experimental);
+        setModified(experimentalIndex());
+    }
+
+    QMcpServerCapabilitiesExperimental takeExperimental() {
+        clearModified(experimentalIndex());
+        return std::exchange(d<Private>()->experimental, QMcpServerCapabilitiesExperimental());
     }
 
     QMcpServerCapabilitiesLogging logging() const {
@@ -70,6 +83,18 @@ public:
     void setLogging(const QMcpServerCapabilitiesLogging &logging) {
         if (this->logging() == logging) return;
         d<Private>()->logging = logging;
+        setModified(loggingIndex());
+    }
+
+    void setLogging(QMcpServerCapabilitiesLogging &&logging) {
+        if (!isModified(loggingIndex()) && this->logging() == logging) return;
+        d<Private>()->logging = std::move(logging);
+        setModified(loggingIndex());
+    }
+
+    QMcpServerCapabilitiesLogging takeLogging() {
+        clearModified(loggingIndex());
+        return std::exchange(d<Private>()->logging, QMcpServerCapabilitiesLogging());
     }
 
     QMcpServerCapabilitiesPrompts prompts() const {
@@ -79,6 +104,18 @@ public:
     void setPrompts(const QMcpServerCapabilitiesPrompts &prompts) {
         if (this->prompts() == prompts) return;
         d<Private>()->prompts = prompts;
+        setModified(promptsIndex());
+    }
+
+    void setPrompts(QMcpServerCapabilitiesPrompts &&prompts) {
+        if (!isModified(promptsIndex()) && this->prompts() == prompts) return;
+        d<Private>()->prompts = std::move(prompts);
+        setModified(promptsIndex());
+    }
+
+    QMcpServerCapabilitiesPrompts takePrompts() {
+        clearModified(promptsIndex());
+        return std::exchange(d<Private>()->prompts, QMcpServerCapabilitiesPrompts());
     }
 
     QMcpServerCapabilitiesResources resources() const {
@@ -88,6 +125,18 @@ public:
     void setResources(const QMcpServerCapabilitiesResources &resources) {
         if (this->resources() == resources) return;
         d<Private>()->resources = resources;
+        setModified(resourcesIndex());
+    }
+
+    void setResources(QMcpServerCapabilitiesResources &&resources) {
+        if (!isModified(resourcesIndex()) && this->resources() == resources) return;
+        d<Private>()->resources = std::move(resources);
+        setModified(resourcesIndex());
+    }
+
+    QMcpServerCapabilitiesResources takeResources() {
+        clearModified(resourcesIndex());
+        return std::exchange(d<Private>()->resources, QMcpServerCapabilitiesResources());
     }
 
     QMcpServerCapabilitiesTools tools() const {
@@ -97,6 +146,18 @@ public:
     void setTools(const QMcpServerCapabilitiesTools &tools) {
         if (this->tools() == tools) return;
         d<Private>()->tools = tools;
+        setModified(toolsIndex());
+    }
+
+    void setTools(QMcpServerCapabilitiesTools &&tools) {
+        if (!isModified(toolsIndex()) && this->tools() == tools) return;
+        d<Private>()->tools = std::move(tools);
+        setModified(toolsIndex());
+    }
+
+    QMcpServerCapabilitiesTools takeTools() {
+        clearModified(toolsIndex());
+        return std::exchange(d<Private>()->tools, QMcpServerCapabilitiesTools());
     }
 
     const QMetaObject* metaObject() const override {
@@ -104,6 +165,27 @@ public:
     }
 
 private:
+    static int experimentalIndex() {
+        static const int index = staticMetaObject.indexOfProperty("experimental");
+        return index;
+    }
+    static int loggingIndex() {
+        static const int index = staticMetaObject.indexOfProperty("logging");
+        return index;
+    }
+    static int promptsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("prompts");
+        return index;
+    }
+    static int resourcesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("resources");
+        return index;
+    }
+    static int toolsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("tools");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpServerCapabilitiesExperimental experimental;
         QMcpServerCapabilitiesLogging logging;
@@ -111,6 +193,20 @@ private:
         QMcpServerCapabilitiesResources resources;
         QMcpServerCapabilitiesTools tools;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && experimental == that.experimental
+                && logging == that.logging
+                && prompts == that.prompts
+                && resources == that.resources
+                && tools == that.tools;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), experimental, logging, prompts, resources, tools);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpServerCapabilitiesResources : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpServerCapabilitiesResources::listChanged
@@ -42,6 +43,7 @@ public:
     void setListChanged(bool changed) {
         if (this->listChanged() == changed) return;
         d<Private>()->listChanged = changed;
+        setModified(listChangedIndex());
     }
 
     bool subscribe() const {
@@ -51,6 +53,7 @@ public:
     void setSubscribe(bool subscribe) {
         if (this->subscribe() == subscribe) return;
         d<Private>()->subscribe = subscribe;
+        setModified(subscribeIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -58,10 +61,30 @@ public:
     }
 
 private:
+    static int listChangedIndex() {
+        static const int index = staticMetaObject.indexOfProperty("listChanged");
+        return index;
+    }
+    static int subscribeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("subscribe");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         bool listChanged = false;
         bool subscribe = false;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && listChanged == that.listChanged
+                && subscribe == that.subscribe;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), listChanged, subscribe);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
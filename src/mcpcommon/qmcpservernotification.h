@@ -28,14 +28,6 @@ public:
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpCancelledNotification cancelledNotification;
-        QMcpProgressNotification progressNotification;
-        QMcpResourceListChangedNotification resourceListChangedNotification;
-        QMcpResourceUpdatedNotification resourceUpdatedNotification;
-        QMcpPromptListChangedNotification promptListChangedNotification;
-        QMcpToolListChangedNotification toolListChangedNotification;
-        QMcpLoggingMessageNotification loggingMessageNotification;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
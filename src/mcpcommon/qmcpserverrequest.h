@@ -24,33 +24,27 @@ public:
     QMcpServerRequest() : QMcpAnyOf(new Private) {}
 
     QMcpPingRequest pingRequest() const {
-        return d<Private>()->pingRequest;
+        return alternative<QMcpPingRequest>("pingRequest");
     }
 
     void setPingRequest(const QMcpPingRequest &request) {
-        if (this->pingRequest() == request) return;
-        setRefType("pingRequest");
-        d<Private>()->pingRequest = request;
+        setAlternative("pingRequest"_ba, request);
     }
 
     QMcpCreateMessageRequest createMessageRequest() const {
-        return d<Private>()->createMessageRequest;
+        return alternative<QMcpCreateMessageRequest>("createMessageRequest");
     }
 
     void setCreateMessageRequest(const QMcpCreateMessageRequest &request) {
-        if (this->createMessageRequest() == request) return;
-        setRefType("createMessageRequest");
-        d<Private>()->createMessageRequest = request;
+        setAlternative("createMessageRequest"_ba, request);
     }
 
     QMcpListRootsRequest listRootsRequest() const {
-        return d<Private>()->listRootsRequest;
+        return alternative<QMcpListRootsRequest>("listRootsRequest");
     }
 
     void setListRootsRequest(const QMcpListRootsRequest &request) {
-        if (this->listRootsRequest() == request) return;
-        setRefType("listRootsRequest");
-        d<Private>()->listRootsRequest = request;
+        setAlternative("listRootsRequest"_ba, request);
     }
 
     const QMetaObject* metaObject() const override {
@@ -59,10 +53,6 @@ public:
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpPingRequest pingRequest;
-        QMcpCreateMessageRequest createMessageRequest;
-        QMcpListRootsRequest listRootsRequest;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
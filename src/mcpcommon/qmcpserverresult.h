@@ -31,17 +31,6 @@ public:
 
 private:
     struct Private : public QMcpAnyOf::Private {
-        QMcpResult result;
-        QMcpInitializeResult initializeResult;
-        QMcpListResourcesResult listResourcesResult;
-        QMcpListResourceTemplatesResult listResourceTemplatesResult;
-        QMcpReadResourceResult readResourceResult;
-        QMcpListPromptsResult listPromptsResult;
-        QMcpGetPromptResult getPromptResult;
-        QMcpListToolsResult listToolsResult;
-        QMcpCallToolResult callToolResult;
-        QMcpCompleteResult completeResult;
-
         Private *clone() const override { return new Private(*this); }
     };
 };
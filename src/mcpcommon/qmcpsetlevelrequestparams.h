@@ -15,6 +15,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpSetLevelRequestParams : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpSetLevelRequestParams::level
@@ -32,6 +33,7 @@ public:
     void setLevel(QMcpLoggingLevel::QMcpLoggingLevel level) {
         if (this->level() == level) return;
         d<Private>()->level = level;
+        setModified(levelIndex());
     }
 
     const QMetaObject* metaObject() const override {
@@ -39,9 +41,24 @@ public:
     }
 
 private:
+    static int levelIndex() {
+        static const int index = staticMetaObject.indexOfProperty("level");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpLoggingLevel::QMcpLoggingLevel level = QMcpLoggingLevel::alert;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && level == that.level;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), level);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -18,6 +18,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpTextContent : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QMcpAnnotations annotations READ annotations WRITE setAnnotations)
 
@@ -40,6 +41,18 @@ public:
     void setAnnotations(const QMcpAnnotations &annotations) {
         if (this->annotations() == annotations) return;
         d<Private>()->annotations = annotations;
+        setModified(annotationsIndex());
+    }
+
+    void setAnnotations(QMcpAnnotations &&annotations) {
+        if (!isModified(annotationsIndex()) && this->annotations() == annotations) return;
+        d<Private>()->annotations = std::move(annotations);
+        setModified(annotationsIndex());
+    }
+
+    QMcpAnnotations takeAnnotations() {
+        clearModified(annotationsIndex());
+        return std::exchange(d<Private>()->annotations, QMcpAnnotations());
     }
 
     QString text() const {
@@ -49,6 +62,18 @@ public:
     void setText(const QString &text) {
         if (this->text() == text) return;
         d<Private>()->text = text;
+        setModified(textIndex());
+    }
+
+    void setText(QString &&text) {
+        if (!isModified(textIndex()) && this->text() == text) return;
+        d<Private>()->text = std::move(text);
+        setModified(textIndex());
+    }
+
+    QString takeText() {
+        clearModified(textIndex());
+        return std::exchange(d<Private>()->text, QString());
     }
 
     static QByteArray type() { return QByteArrayLiteral("text"); }
@@ -58,10 +83,30 @@ public:
     }
 
 private:
+    static int annotationsIndex() {
+        static const int index = staticMetaObject.indexOfProperty("annotations");
+        return index;
+    }
+    static int textIndex() {
+        static const int index = staticMetaObject.indexOfProperty("text");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QMcpAnnotations annotations;
         QString text;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && annotations == that.annotations
+                && text == that.text;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), annotations, text);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpTextResourceContents : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpTextResourceContents::mimeType
@@ -43,10 +44,10 @@ public:
     QMcpTextResourceContents(const QMcpResource &resource, const QString &text)
         : QMcpGadget(new Private)
     {
-        d<Private>()->mimeType = resource.mimeType();
-        d<Private>()->text = text;
-        d<Private>()->uri = resource.uri();
-        d<Private>()->name = resource.name();
+        setMimeType(resource.mimeType());
+        setText(text);
+        setUri(resource.uri());
+        setName(resource.name());
     }
 
     QString mimeType() const {
@@ -56,6 +57,18 @@ public:
     void setMimeType(const QString &mimeType) {
         if (this->mimeType() == mimeType) return;
         d<Private>()->mimeType = mimeType;
+        setModified(mimeTypeIndex());
+    }
+
+    void setMimeType(QString &&mimeType) {
+        if (!isModified(mimeTypeIndex()) && this->mimeType() == mimeType) return;
+        d<Private>()->mimeType = std::move(mimeType);
+        setModified(mimeTypeIndex());
+    }
+
+    QString takeMimeType() {
+        clearModified(mimeTypeIndex());
+        return std::exchange(d<Private>()->mimeType, QString());
     }
 
     QString text() const {
@@ -65,6 +78,18 @@ public:
     void setText(const QString &text) {
         if (this->text() == text) return;
         d<Private>()->text = text;
+        setModified(textIndex());
+    }
+
+    void setText(QString &&text) {
+        if (!isModified(textIndex()) && this->text() == text) return;
+        d<Private>()->text = std::move(text);
+        setModified(textIndex());
+    }
+
+    QString takeText() {
+        clearModified(textIndex());
+        return std::exchange(d<Private>()->text, QString());
     }
 
     QUrl uri() const {
@@ -74,6 +99,18 @@ public:
     void setUri(const QUrl &uri) {
         if (this->uri() == uri) return;
         d<Private>()->uri = uri;
+        setModified(uriIndex());
+    }
+
+    void setUri(QUrl &&uri) {
+        if (!isModified(uriIndex()) && this->uri() == uri) return;
+        d<Private>()->uri = std::move(uri);
+        setModified(uriIndex());
+    }
+
+    QUrl takeUri() {
+        clearModified(uriIndex());
+        return std::exchange(d<Private>()->uri, QUrl());
     }
 
     QString name() const {
@@ -83,6 +120,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -90,12 +139,42 @@ public:
     }
 
 private:
+    static int mimeTypeIndex() {
+        static const int index = staticMetaObject.indexOfProperty("mimeType");
+        return index;
+    }
+    static int textIndex() {
+        static const int index = staticMetaObject.indexOfProperty("text");
+        return index;
+    }
+    static int uriIndex() {
+        static const int index = staticMetaObject.indexOfProperty("uri");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString mimeType;
         QString text;
         QUrl uri;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && mimeType == that.mimeType
+                && text == that.text
+                && uri == that.uri
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), mimeType, text, uri, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -17,6 +17,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpTool : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     /*!
         \property QMcpTool::description
@@ -46,6 +47,18 @@ public:
     void setDescription(const QString &description) {
         if (this->description() == description) return;
         d<Private>()->description = description;
+        setModified(descriptionIndex());
+    }
+
+    void setDescription(QString &&description) {
+        if (!isModified(descriptionIndex()) && this->description() == description) return;
+        d<Private>()->description = std::move(description);
+        setModified(descriptionIndex());
+    }
+
+    QString takeDescription() {
+        clearModified(descriptionIndex());
+        return std::exchange(d<Private>()->description, QString());
     }
 
     QMcpToolInputSchema inputSchema() const {
@@ -55,6 +68,18 @@ public:
     void setInputSchema(const QMcpToolInputSchema &inputSchema) {
         if (this->inputSchema() == inputSchema) return;
         d<Private>()->inputSchema = inputSchema;
+        setModified(inputSchemaIndex());
+    }
+
+    void setInputSchema(QMcpToolInputSchema &&inputSchema) {
+        if (!isModified(inputSchemaIndex()) && this->inputSchema() == inputSchema) return;
+        d<Private>()->inputSchema = std::move(inputSchema);
+        setModified(inputSchemaIndex());
+    }
+
+    QMcpToolInputSchema takeInputSchema() {
+        clearModified(inputSchemaIndex());
+        return std::exchange(d<Private>()->inputSchema, QMcpToolInputSchema());
     }
 
     QString name() const {
@@ -64,6 +89,18 @@ public:
     void setName(const QString &name) {
         if (this->name() == name) return;
         d<Private>()->name = name;
+        setModified(nameIndex());
+    }
+
+    void setName(QString &&name) {
+        if (!isModified(nameIndex()) && this->name() == name) return;
+        d<Private>()->name = std::move(name);
+        setModified(nameIndex());
+    }
+
+    QString takeName() {
+        clearModified(nameIndex());
+        return std::exchange(d<Private>()->name, QString());
     }
 
     const QMetaObject* metaObject() const override {
@@ -71,11 +108,36 @@ public:
     }
 
 private:
+    static int descriptionIndex() {
+        static const int index = staticMetaObject.indexOfProperty("description");
+        return index;
+    }
+    static int inputSchemaIndex() {
+        static const int index = staticMetaObject.indexOfProperty("inputSchema");
+        return index;
+    }
+    static int nameIndex() {
+        static const int index = staticMetaObject.indexOfProperty("name");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QString description;
         QMcpToolInputSchema inputSchema;
         QString name;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && description == that.description
+                && inputSchema == that.inputSchema
+                && name == that.name;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), description, inputSchema, name);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
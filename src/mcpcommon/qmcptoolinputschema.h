@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 class Q_MCPCOMMON_EXPORT QMcpToolInputSchema : public QMcpGadget
 {
     Q_GADGET
+    Q_CLASSINFO("QMcpModifiedTracking", "true")
 
     Q_PROPERTY(QJsonObject properties READ properties WRITE setProperties)
     Q_PROPERTY(QList<QString> required READ required WRITE setRequired)
@@ -34,6 +35,18 @@ public:
     void setProperties(const QJsonObject &properties) {
         if (this->properties() == properties) return;
         d<Private>()->properties = properties;
+        setModified(propertiesIndex());
+    }
+
+    void setProperties(QJsonObject &&properties) {
+        if (!isModified(propertiesIndex()) && this->properties() == properties) return;
+        d<Private>()->properties = std::move(properties);
+        setModified(propertiesIndex());
+    }
+
+    QJsonObject takeProperties() {
+        clearModified(propertiesIndex());
+        return std::exchange(d<Private>()->properties, QJsonObject());
     }
 
     QList<QString> required() const {
@@ -43,6 +56,34 @@ public:
     void setRequired(const QList<QString> &required) {
         if (this->required() == required) return;
         d<Private>()->required = required;
+        setModified(requiredIndex());
+    }
+
+    void setRequired(QList<QString> &&required) {
+        if (!isModified(requiredIndex()) && this->required() == required) return;
+        d<Private>()->required = std::move(required);
+        setModified(requiredIndex());
+    }
+
+    QList<QString> takeRequired() {
+        clearModified(requiredIndex());
+        return std::exchange(d<Private>()->required, QList<QString>());
+    }
+
+    void appendRequired(const QString &value) {
+        d<Private>()->required.append(value);
+        setModified(requiredIndex());
+    }
+
+    void appendRequired(QString &&value) {
+        d<Private>()->required.append(std::move(value));
+        setModified(requiredIndex());
+    }
+
+    template <typename... Args>
+    QString &emplaceRequired(Args &&...args) {
+        setModified(requiredIndex());
+        return d<Private>()->required.emplaceBack(std::forward<Args>(args)...);
     }
 
     static QByteArray type() { 
@@ -54,10 +95,30 @@ public:
     }
 
 private:
+    static int propertiesIndex() {
+        static const int index = staticMetaObject.indexOfProperty("properties");
+        return index;
+    }
+    static int requiredIndex() {
+        static const int index = staticMetaObject.indexOfProperty("required");
+        return index;
+    }
+
     struct Private : public QMcpGadget::Private {
         QJsonObject properties;
         QList<QString> required;
 
+        bool equals(const QMcpGadget::Private &other) const override {
+            const auto &that = static_cast<const Private &>(other);
+            return QMcpGadget::Private::equals(other)
+                && properties == that.properties
+                && required == that.required;
+        }
+
+        size_t hash(size_t seed) const override {
+            return qHashMulti(QMcpGadget::Private::hash(seed), properties, required);
+        }
+
         Private *clone() const override { return new Private(*this); }
     };
 };
@@ -0,0 +1,332 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcptoolinputvalidator.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+enum TypeFlag : quint8 {
+    Null = 0x01,
+    Boolean = 0x02,
+    Integer = 0x04,
+    Number = 0x08,
+    String = 0x10,
+    Array = 0x20,
+    Object = 0x40,
+    AnyType = 0x7f,
+};
+
+struct TypeName {
+    QLatin1StringView name;
+    quint8 flags;
+};
+
+constexpr TypeName typeNames[] = {
+    { "array"_L1, Array },
+    // not a JSON Schema type, but used by older servers
+    { "bool"_L1, Boolean },
+    { "boolean"_L1, Boolean },
+    // every integer is a number as well
+    { "integer"_L1, Integer },
+    { "null"_L1, Null },
+    { "number"_L1, Number | Integer },
+    { "object"_L1, Object },
+    { "string"_L1, String },
+};
+
+quint8 typeFlags(const QString &name)
+{
+    for (const auto &typeName : typeNames) {
+        if (typeName.name == name)
+            return typeName.flags;
+    }
+    qWarning() << "Unknown JSON Schema type" << name;
+    return AnyType;
+}
+
+QLatin1StringView typeNameOf(quint8 flag)
+{
+    switch (flag) {
+    case Null:
+        return "null"_L1;
+    case Boolean:
+        return "boolean"_L1;
+    case Integer:
+        return "integer"_L1;
+    case Number:
+        return "number"_L1;
+    case String:
+        return "string"_L1;
+    case Array:
+        return "array"_L1;
+    case Object:
+        return "object"_L1;
+    default:
+        break;
+    }
+    return "any"_L1;
+}
+
+quint8 typeOf(const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Null:
+        return Null;
+    case QJsonValue::Bool:
+        return Boolean;
+    case QJsonValue::Double: {
+        const auto number = value.toDouble();
+        return std::isfinite(number) && std::trunc(number) == number ? Integer : Number;
+    }
+    case QJsonValue::String:
+        return String;
+    case QJsonValue::Array:
+        return Array;
+    case QJsonValue::Object:
+        return Object;
+    default:
+        break;
+    }
+    return 0;
+}
+
+// the length of string in code points, as JSON Schema counts it; a
+// surrogate pair is one
+qsizetype codePointCount(QStringView string)
+{
+    qsizetype count = string.size();
+    for (qsizetype i = 1; i < string.size(); i++) {
+        if (string.at(i).isLowSurrogate() && string.at(i - 1).isHighSurrogate()) {
+            count--;
+            i++;
+        }
+    }
+    return count;
+}
+}
+
+struct QMcpToolInputValidator::Program
+{
+    struct Check {
+        QString key;
+        quint8 types = AnyType;
+        bool exclusiveMinimum = false;
+        bool exclusiveMaximum = false;
+        double minimum = -std::numeric_limits<double>::infinity();
+        double maximum = std::numeric_limits<double>::infinity();
+        // string length or array size
+        qsizetype minSize = 0;
+        qsizetype maxSize = std::numeric_limits<qsizetype>::max();
+        // the allowed values, empty for any
+        QJsonArray values;
+    };
+
+    static Check compile(const QString &key, const QJsonObject &schema);
+    const Check *find(QStringView key) const;
+    static bool matches(const Check &check, const QJsonValue &value, QString *errorMessage);
+
+    // sorted by key
+    QList<Check> checks;
+    // one bit per check
+    QVarLengthArray<quint64, 1> required;
+};
+
+const QMcpToolInputValidator::Program::Check *QMcpToolInputValidator::Program::find(QStringView key) const
+{
+    const auto it = std::lower_bound(checks.cbegin(), checks.cend(), key, [](const Check &check, QStringView key) {
+        return check.key < key;
+    });
+    return it != checks.cend() && it->key == key ? &*it : nullptr;
+}
+
+QMcpToolInputValidator::Program::Check QMcpToolInputValidator::Program::compile(const QString &key, const QJsonObject &schema)
+{
+    Check check;
+    check.key = key;
+
+    const auto type = schema.value("type"_L1);
+    if (type.isString()) {
+        check.types = typeFlags(type.toString());
+    } else if (type.isArray()) {
+        check.types = 0;
+        const auto types = type.toArray();
+        for (const auto &name : types)
+            check.types |= typeFlags(name.toString());
+    }
+
+    // draft 4 uses booleans for the exclusive bounds, later drafts numbers
+    const auto minimum = schema.value("minimum"_L1);
+    if (minimum.isDouble())
+        check.minimum = minimum.toDouble();
+    const auto exclusiveMinimum = schema.value("exclusiveMinimum"_L1);
+    if (exclusiveMinimum.isBool()) {
+        check.exclusiveMinimum = exclusiveMinimum.toBool();
+    } else if (exclusiveMinimum.isDouble() && exclusiveMinimum.toDouble() >= check.minimum) {
+        check.minimum = exclusiveMinimum.toDouble();
+        check.exclusiveMinimum = true;
+    }
+    const auto maximum = schema.value("maximum"_L1);
+    if (maximum.isDouble())
+        check.maximum = maximum.toDouble();
+    const auto exclusiveMaximum = schema.value("exclusiveMaximum"_L1);
+    if (exclusiveMaximum.isBool()) {
+        check.exclusiveMaximum = exclusiveMaximum.toBool();
+    } else if (exclusiveMaximum.isDouble() && exclusiveMaximum.toDouble() <= check.maximum) {
+        check.maximum = exclusiveMaximum.toDouble();
+        check.exclusiveMaximum = true;
+    }
+
+    for (const auto &keyword : { "minLength"_L1, "minItems"_L1 }) {
+        if (schema.contains(keyword))
+            check.minSize = schema.value(keyword).toInteger();
+    }
+    for (const auto &keyword : { "maxLength"_L1, "maxItems"_L1 }) {
+        if (schema.contains(keyword))
+            check.maxSize = schema.value(keyword).toInteger();
+    }
+
+    if (schema.contains("const"_L1))
+        check.values.append(schema.value("const"_L1));
+    else if (schema.value("enum"_L1).isArray())
+        check.values = schema.value("enum"_L1).toArray();
+
+    return check;
+}
+
+bool QMcpToolInputValidator::Program::matches(const Check &check, const QJsonValue &value, QString *errorMessage)
+{
+    auto fail = [&](const QString &message) {
+        if (errorMessage)
+            *errorMessage = "Invalid argument '%1': %2"_L1.arg(check.key, message);
+        return false;
+    };
+
+    const auto type = typeOf(value);
+    if (!(check.types & type)) {
+        QStringList names;
+        for (quint8 flag = Null; flag <= Object; flag <<= 1) {
+            // integer is implied by number
+            if ((check.types & flag) && !(flag == Integer && (check.types & Number)))
+                names.append(typeNameOf(flag));
+        }
+        return fail("expected %1"_L1.arg(names.join(" or "_L1)));
+    }
+
+    switch (type) {
+    case Integer:
+    case Number: {
+        const auto number = value.toDouble();
+        if (number < check.minimum || (check.exclusiveMinimum && number == check.minimum))
+            return fail("%1 is below the minimum of %2"_L1.arg(QString::number(number), QString::number(check.minimum)));
+        if (number > check.maximum || (check.exclusiveMaximum && number == check.maximum))
+            return fail("%1 is above the maximum of %2"_L1.arg(QString::number(number), QString::number(check.maximum)));
+        break; }
+    case String: {
+        const auto size = codePointCount(value.toString());
+        if (size < check.minSize || size > check.maxSize)
+            return fail("length %1 is out of range"_L1.arg(QString::number(size)));
+        break; }
+    case Array: {
+        const auto size = value.toArray().size();
+        if (size < check.minSize || size > check.maxSize)
+            return fail("size %1 is out of range"_L1.arg(QString::number(size)));
+        break; }
+    default:
+        break;
+    }
+
+    if (!check.values.isEmpty() && !check.values.contains(value))
+        return fail("value is not one of the allowed values"_L1);
+
+    return true;
+}
+
+/*!
+    Constructs a validator that accepts any arguments.
+*/
+QMcpToolInputValidator::QMcpToolInputValidator() = default;
+
+/*!
+    Constructs a validator for the arguments described by \a schema.
+*/
+QMcpToolInputValidator::QMcpToolInputValidator(const QMcpToolInputSchema &schema)
+{
+    auto program = std::make_shared<Program>();
+
+    const auto properties = schema.properties();
+    const auto required = schema.required();
+    program->checks.reserve(properties.size());
+    for (auto it = properties.constBegin(); it != properties.constEnd(); ++it)
+        program->checks.append(Program::compile(it.key(), it.value().toObject()));
+    // required arguments without a description are only checked for presence
+    for (const auto &key : required) {
+        const auto described = std::any_of(program->checks.cbegin(), program->checks.cend(), [&key](const auto &check) {
+            return check.key == key;
+        });
+        if (!described) {
+            Program::Check check;
+            check.key = key;
+            program->checks.append(check);
+        }
+    }
+    std::sort(program->checks.begin(), program->checks.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.key < rhs.key;
+    });
+
+    program->required.resize((program->checks.size() + 63) / 64, 0);
+    for (const auto &key : required) {
+        const auto index = program->find(key) - program->checks.constData();
+        program->required[index / 64] |= quint64(1) << (index % 64);
+    }
+
+    this->program = std::move(program);
+}
+
+/*!
+    Returns \c true if \a arguments match the schema. Otherwise returns
+    \c false and, if \a errorMessage is not null, describes the first
+    mismatch in it.
+*/
+bool QMcpToolInputValidator::validate(const QJsonObject &arguments, QString *errorMessage) const
+{
+    if (!program)
+        return true;
+
+    const auto &checks = program->checks;
+    QVarLengthArray<quint64, 1> seen(program->required.size(), 0);
+    for (auto it = arguments.constBegin(); it != arguments.constEnd(); ++it) {
+        // arguments the schema does not describe are accepted
+        const auto *check = program->find(it.key());
+        if (!check)
+            continue;
+        const auto index = check - checks.constData();
+        seen[index / 64] |= quint64(1) << (index % 64);
+        if (!Program::matches(*check, it.value(), errorMessage))
+            return false;
+    }
+
+    for (qsizetype i = 0; i < seen.size(); i++) {
+        const auto missing = program->required.at(i) & ~seen.at(i);
+        if (!missing)
+            continue;
+        if (errorMessage) {
+            const auto index = i * 64 + qCountTrailingZeroBits(missing);
+            *errorMessage = "Missing required argument '%1'"_L1.arg(checks.at(index).key);
+        }
+        return false;
+    }
+    return true;
+}
+
+QT_END_NAMESPACE
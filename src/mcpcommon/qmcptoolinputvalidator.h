@@ -0,0 +1,48 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPTOOLINPUTVALIDATOR_H
+#define QMCPTOOLINPUTVALIDATOR_H
+
+#include <QtMcpCommon/qmcpcommonglobal.h>
+#include <QtMcpCommon/qmcptoolinputschema.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qstring.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+/*! \class QMcpToolInputValidator
+    \inmodule QtMcpCommon
+    \brief Checks tool call arguments against the input schema of the tool.
+
+    The schema is compiled once, when the validator is created, into a
+    table of checks sorted by argument name and a bitmask of the required
+    arguments. validate() then walks the arguments once, without converting
+    them.
+
+    The following keywords of each property are checked: \c type (a name or
+    a list of names), \c enum, \c const, \c minimum, \c maximum,
+    \c exclusiveMinimum, \c exclusiveMaximum, \c minLength, \c maxLength,
+    \c minItems and \c maxItems. Arguments not listed in the schema are
+    accepted, nested schemas of objects and array items are not checked.
+
+    A default constructed validator accepts any arguments.
+*/
+class Q_MCPCOMMON_EXPORT QMcpToolInputValidator
+{
+public:
+    QMcpToolInputValidator();
+    explicit QMcpToolInputValidator(const QMcpToolInputSchema &schema);
+
+    bool validate(const QJsonObject &arguments, QString *errorMessage = nullptr) const;
+
+private:
+    struct Program;
+    std::shared_ptr<const Program> program;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPTOOLINPUTVALIDATOR_H
@@ -38,6 +38,13 @@ inline ProtocolVersion stringToProtocolVersion(const QString &versionStr) {
         return ProtocolVersion::Latest; // Default to latest for unknown values
 }
 
+// Encoding of the messages on the wire
+enum class Encoding {
+    Json,
+    // negotiated between two QtMcp peers, see QMcpCbor
+    Cbor,
+};
+
 } // namespace QtMcp
 
 // Register the enum with the Qt meta-object system
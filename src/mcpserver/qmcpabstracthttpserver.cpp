@@ -4,7 +4,9 @@
 #include <QtNetwork/QHttpHeaders>
 #include <QtNetwork/QNetworkRequest>
 #include <QtNetwork/QNetworkReply>
+#include <QtCore/QHash>
 #include <QtCore/QMap>
+#include <QtCore/QMultiHash>
 
 class QMcpAbstractHttpServer::Private
 {
@@ -16,11 +18,14 @@ public:
     void sendHttpResponse(QTcpSocket *socket, const QByteArray &data,
                          const QString &contentType = QStringLiteral("text/plain"),
                          int statusCode = 200);
+    void insertSession(const QUuid &session, QTcpSocket *socket);
+    QTcpSocket *takeSession(const QUuid &session);
 
 private:
     QMcpAbstractHttpServer *q;
 public:
     QTcpServer *server = nullptr;
+    QMetaObject::Connection newConnection;
     struct ParseData {
         QByteArray data;
         QNetworkRequest request;
@@ -30,7 +35,9 @@ public:
     };
 
     QMap<QTcpSocket*, ParseData> dataMap;
-    QMap<QUuid, QTcpSocket*> sessions;
+    QHash<QUuid, QTcpSocket*> sessions;
+    // the other way round, so neither lookup scans
+    QMultiHash<QTcpSocket*, QUuid> socketSessions;
     QMap<QString, QString> responseHeaders;  // Custom headers for next response
 };
 
@@ -64,16 +71,13 @@ void QMcpAbstractHttpServer::Private::handleDisconnected(QTcpSocket *socket)
         dataMap.remove(socket);
     }
 
-    // Remove socket from sessions map (find all session IDs that map to this socket)
-    QList<QUuid> sessionsToRemove;
-    for (auto it = sessions.constBegin(); it != sessions.constEnd(); ++it) {
-        if (it.value() == socket) {
-            sessionsToRemove.append(it.key());
-        }
-    }
+    // Remove the sessions served by this socket
+    const auto sessionsToRemove = socketSessions.values(socket);
+    socketSessions.remove(socket);
     for (const QUuid &sessionId : sessionsToRemove) {
         sessions.remove(sessionId);
         qDebug() << "[QMcpAbstractHttpServer] Removed disconnected session:" << sessionId;
+        emit q->sessionDisconnected(sessionId);
     }
 
     socket->deleteLater();
@@ -220,7 +224,7 @@ void QMcpAbstractHttpServer::Private::parseHttpRequest(QTcpSocket *socket)
     default:
         qFatal();
     }
-    if (sessions.key(socket).isNull())
+    if (!socketSessions.contains(socket))
         sendHttpResponse(socket, ret, "text/plain"_L1, 200);
     else
         socket->write(ret);
@@ -252,6 +256,23 @@ void QMcpAbstractHttpServer::Private::sendHttpResponse(QTcpSocket *socket, const
     socket->flush();
 }
 
+// a session is served by the socket of its latest request
+void QMcpAbstractHttpServer::Private::insertSession(const QUuid &session, QTcpSocket *socket)
+{
+    if (auto *previous = sessions.value(session))
+        socketSessions.remove(previous, session);
+    sessions.insert(session, socket);
+    socketSessions.insert(socket, session);
+}
+
+QTcpSocket *QMcpAbstractHttpServer::Private::takeSession(const QUuid &session)
+{
+    auto *socket = sessions.take(session);
+    if (socket)
+        socketSessions.remove(socket, session);
+    return socket;
+}
+
 QMcpAbstractHttpServer::QMcpAbstractHttpServer(QObject *parent)
     : QObject{parent}
     , d(new Private(this))
@@ -262,11 +283,9 @@ QMcpAbstractHttpServer::~QMcpAbstractHttpServer()
 
 bool QMcpAbstractHttpServer::bind(QTcpServer *server)
 {
-    static QMetaObject::Connection connection;
-
     if (d->server) {
-        disconnect(connection);
-        connection = QMetaObject::Connection();
+        disconnect(d->newConnection);
+        d->newConnection = QMetaObject::Connection();
         // Clean up any existing connections
         const auto sockets = d->dataMap.keys();
         for (QTcpSocket *socket : sockets) {
@@ -280,7 +299,7 @@ bool QMcpAbstractHttpServer::bind(QTcpServer *server)
     if (d->server) {
         while (server->hasPendingConnections())
             d->handleNewConnection();
-        connection = connect(server, &QTcpServer::newConnection, this, [this]() {
+        d->newConnection = connect(server, &QTcpServer::newConnection, this, [this]() {
             d->handleNewConnection();
         });
     }
@@ -299,7 +318,7 @@ QUuid QMcpAbstractHttpServer::registerSseRequest(const QNetworkRequest &request)
     for (QTcpSocket *socket : sockets) {
         if (d->dataMap.value(socket).request == request) {
             ret = QUuid::createUuid();
-            d->sessions.insert(ret, socket);
+            d->insertSession(ret, socket);
             socket->write(response);
             socket->flush();
             break;
@@ -322,7 +341,7 @@ void QMcpAbstractHttpServer::sendSseEvent(const QUuid &id, const QByteArray &dat
     // Defensive check: ensure socket is valid and connected
     if (!socket || socket->state() != QAbstractSocket::ConnectedState) {
         qWarning() << "sse" << id << "socket is null or not connected, removing session";
-        d->sessions.remove(id);
+        d->takeSession(id);
         return;
     }
 
@@ -340,7 +359,7 @@ void QMcpAbstractHttpServer::closeSseConnection(const QUuid &id)
         qWarning() << "sse" << id << "not found";
         return;
     }
-    auto *socket = d->sessions.take(id);
+    auto *socket = d->takeSession(id);
     d->dataMap.remove(socket);
     socket->close();
     socket->deleteLater();
@@ -358,7 +377,7 @@ void QMcpAbstractHttpServer::registerSession(const QUuid &session, const QNetwor
     const auto sockets = d->dataMap.keys();
     for (QTcpSocket *socket : sockets) {
         if (d->dataMap.value(socket).request == request) {
-            d->sessions.insert(session, socket);
+            d->insertSession(session, socket);
             qDebug() << "Registered session" << session << "with socket";
             break;
         }
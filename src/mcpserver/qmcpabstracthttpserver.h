@@ -26,6 +26,11 @@ class QTcpSocket;
     \li Call bind() with a QTcpServer instance to start accepting connections
     \li Use the protected SSE methods to manage event streaming
     \endlist
+
+    The server, the QTcpServer it is bound to and their sockets may live on
+    a thread dedicated to I/O, as long as they are all used on that thread.
+    Each server keeps its own state, so several of them can run on different
+    threads.
 */
 class Q_MCPSERVER_EXPORT QMcpAbstractHttpServer : public QObject
 {
@@ -52,6 +57,16 @@ public:
     */
     bool bind(QTcpServer *server);
 
+signals:
+    /*!
+        Emitted when the socket serving \a session was disconnected. A
+        session registered again with another socket is not affected by
+        the disconnection of the previous one.
+
+        \param session UUID of the session or SSE connection
+    */
+    void sessionDisconnected(const QUuid &session);
+
 protected:
     /*!
         Registers a new SSE request and returns a unique identifier for it.
@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpcancellationtoken.h"
+
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+
+#include <atomic>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+struct QMcpCancellationToken::State
+{
+    std::atomic<bool> cancelled = false;
+    QMutex mutex;
+    QList<std::function<void()>> callbacks;
+};
+
+namespace {
+thread_local QMcpCancellationToken currentToken;
+}
+
+QMcpCancellationToken::QMcpCancellationToken()
+    : state(std::make_shared<State>())
+{}
+
+bool QMcpCancellationToken::isCancelled() const
+{
+    return state->cancelled.load(std::memory_order_acquire);
+}
+
+void QMcpCancellationToken::cancel() const
+{
+    QList<std::function<void()>> callbacks;
+    {
+        QMutexLocker locker(&state->mutex);
+        if (state->cancelled.exchange(true, std::memory_order_acq_rel))
+            return;
+        callbacks.swap(state->callbacks);
+    }
+    for (const auto &callback : std::as_const(callbacks))
+        callback();
+}
+
+void QMcpCancellationToken::onCancelled(std::function<void()> callback) const
+{
+    {
+        QMutexLocker locker(&state->mutex);
+        if (!state->cancelled.load(std::memory_order_relaxed)) {
+            state->callbacks.append(std::move(callback));
+            return;
+        }
+    }
+    callback();
+}
+
+QMcpCancellationToken QMcpCancellationToken::current()
+{
+    return currentToken;
+}
+
+// returns the token current before
+QMcpCancellationToken QMcpCancellationToken::setCurrent(const QMcpCancellationToken &token)
+{
+    return std::exchange(currentToken, token);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPCANCELLATIONTOKEN_H
+#define QMCPCANCELLATIONTOKEN_H
+
+#include <QtMcpServer/qmcpserverglobal.h>
+
+#include <functional>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QMcpServer;
+
+/*!
+    \class QMcpCancellationToken
+    \inmodule QtMcpServer
+    \brief The QMcpCancellationToken class tells a request handler that the
+    client cancelled its request.
+
+    QMcpServer creates a token for every request it dispatches and cancels
+    it when the client sends \c notifications/cancelled for the request. The
+    response is not sent then, so a handler checking isCancelled() from time
+    to time can stop early instead of computing a result nobody reads.
+
+    While a handler runs, current() returns the token of its request. This
+    covers the handlers added with QMcpServer::addRequestHandler() as well
+    as the handlers of dynamic tools, on whichever thread they run.
+
+    \code
+    server->registerDynamicTool(tool, [](const QJsonObject &params) {
+        const auto token = QMcpCancellationToken::current();
+        QList<QMcpCallToolResultContent> contents;
+        for (const auto &chunk : chunks(params)) {
+            if (token.isCancelled())
+                break;
+            contents.append(process(chunk));
+        }
+        return contents;
+    });
+    \endcode
+
+    The futures returned by request handlers are cancelled along with the
+    token, so a QPromise behind one sees QPromise::isCanceled().
+
+    Copies of a token share their state. Tokens are thread-safe.
+*/
+class Q_MCPSERVER_EXPORT QMcpCancellationToken
+{
+public:
+    /*!
+        Constructs a token that is not cancelled.
+    */
+    QMcpCancellationToken();
+
+    /*!
+        Returns whether the request was cancelled.
+    */
+    bool isCancelled() const;
+
+    /*!
+        Cancels the token and calls the callbacks added with onCancelled(),
+        on the calling thread. Cancelling a token twice does nothing.
+    */
+    void cancel() const;
+
+    /*!
+        Calls \a callback once the token is cancelled, right away if it is
+        cancelled already.
+    */
+    void onCancelled(std::function<void()> callback) const;
+
+    /*!
+        Returns the token of the request handled on the calling thread, or a
+        token that is never cancelled outside of a request handler.
+    */
+    static QMcpCancellationToken current();
+
+private:
+    friend class QMcpServer;
+    static QMcpCancellationToken setCurrent(const QMcpCancellationToken &token);
+
+    struct State;
+    std::shared_ptr<State> state;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPCANCELLATIONTOKEN_H
@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpprogressreporter.h"
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qtimer.h>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+struct QMcpProgressReporter::State
+{
+    State(QObject *context, int interval, Sender &&sender)
+        : context(context)
+        , interval(interval)
+        , sender(std::move(sender))
+    {}
+
+    // on the thread of the context
+    void flush()
+    {
+        qreal progress;
+        qreal total;
+        {
+            QMutexLocker locker(&mutex);
+            scheduled = false;
+            if (closed || !pending)
+                return;
+            pending = false;
+            progress = this->progress;
+            total = this->total;
+            sent.start();
+        }
+        sender(progress, total);
+    }
+
+    const QPointer<QObject> context;
+    const int interval;
+    const Sender sender;
+
+    QMutex mutex;
+    // invalid until the first value is sent
+    QElapsedTimer sent;
+    qreal progress = 0;
+    qreal total = 0;
+    bool pending = false;
+    bool scheduled = false;
+    bool closed = false;
+};
+
+namespace {
+thread_local QMcpProgressReporter currentReporter;
+}
+
+QMcpProgressReporter::QMcpProgressReporter() = default;
+
+QMcpProgressReporter::QMcpProgressReporter(QObject *context, int interval, Sender sender)
+    : state(std::make_shared<State>(context, interval, std::move(sender)))
+{}
+
+bool QMcpProgressReporter::isActive() const
+{
+    return bool(state);
+}
+
+void QMcpProgressReporter::report(qreal progress, qreal total) const
+{
+    if (!state)
+        return;
+
+    qint64 delay = 0;
+    {
+        QMutexLocker locker(&state->mutex);
+        if (state->closed)
+            return;
+        state->progress = progress;
+        state->total = total;
+        state->pending = true;
+        // coalesced with the value waiting already
+        if (state->scheduled)
+            return;
+        state->scheduled = true;
+        if (state->sent.isValid())
+            delay = qMax(qint64(0), state->interval - state->sent.elapsed());
+    }
+
+    QObject *context = state->context;
+    if (!context)
+        return;
+    // the timer is started on the thread of the context
+    QMetaObject::invokeMethod(context, [state = state, delay]() {
+        QTimer::singleShot(int(delay), state->context.data(), [state]() { state->flush(); });
+    }, Qt::QueuedConnection);
+}
+
+void QMcpProgressReporter::flush() const
+{
+    if (state)
+        state->flush();
+}
+
+void QMcpProgressReporter::close() const
+{
+    if (!state)
+        return;
+    QMutexLocker locker(&state->mutex);
+    state->closed = true;
+    state->pending = false;
+}
+
+QMcpProgressReporter QMcpProgressReporter::current()
+{
+    return currentReporter;
+}
+
+// returns the reporter current before
+QMcpProgressReporter QMcpProgressReporter::setCurrent(const QMcpProgressReporter &reporter)
+{
+    return std::exchange(currentReporter, reporter);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPPROGRESSREPORTER_H
+#define QMCPPROGRESSREPORTER_H
+
+#include <QtMcpServer/qmcpserverglobal.h>
+
+#include <functional>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QObject;
+class QMcpServer;
+
+/*!
+    \class QMcpProgressReporter
+    \inmodule QtMcpServer
+    \brief The QMcpProgressReporter class sends the progress of a request to
+    the client.
+
+    When a request carries a \c progressToken in its \c _meta, QMcpServer
+    hands a reporter to the handler of the request. current() returns it
+    while the handler runs, for the handlers added with
+    QMcpServer::addRequestHandler() as well as for dynamic tools.
+
+    \code
+    server->registerDynamicTool(tool, [](const QJsonObject &params) {
+        const auto progress = QMcpProgressReporter::current();
+        const auto files = filesOf(params);
+        for (qsizetype i = 0; i < files.size(); i++) {
+            index(files.at(i));
+            progress.report(i + 1, files.size());
+        }
+        return contents;
+    });
+    \endcode
+
+    report() may be called as often as convenient, from any thread. At most
+    one \c notifications/progress is sent per QMcpServer::progressInterval,
+    with the latest value reported; the values in between are dropped. The
+    last value is sent before the response.
+*/
+class Q_MCPSERVER_EXPORT QMcpProgressReporter
+{
+public:
+    using Sender = std::function<void(qreal progress, qreal total)>;
+
+    /*!
+        Constructs an inactive reporter, which ignores the reports.
+    */
+    QMcpProgressReporter();
+
+    /*!
+        Constructs a reporter calling \a sender with the latest value at
+        most once per \a interval milliseconds, on the thread of \a context.
+    */
+    QMcpProgressReporter(QObject *context, int interval, Sender sender);
+
+    /*!
+        Returns whether the client asked for progress. Handlers may skip
+        computing it otherwise.
+    */
+    bool isActive() const;
+
+    /*!
+        Reports the \a progress made, out of \a total if it is greater
+        than 0. Thread-safe.
+    */
+    void report(qreal progress, qreal total = 0) const;
+
+    /*!
+        Sends the value reported last now, if it was not sent yet. Must be
+        called on the thread of the context.
+    */
+    void flush() const;
+
+    /*!
+        Drops the value not sent yet and the later reports.
+    */
+    void close() const;
+
+    /*!
+        Returns the reporter of the request handled on the calling thread,
+        an inactive one if the client did not ask for progress or outside
+        of a request handler.
+    */
+    static QMcpProgressReporter current();
+
+private:
+    friend class QMcpServer;
+    static QMcpProgressReporter setCurrent(const QMcpProgressReporter &reporter);
+
+    struct State;
+    std::shared_ptr<State> state;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPPROGRESSREPORTER_H
@@ -0,0 +1,254 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpregistry_p.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qmetaobject.h>
+#include <QtCore/qset.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// matches the URIs of a template, one capture per variable; the full
+// RFC 6570 syntax is not supported
+QRegularExpression templatePattern(const QString &uriTemplate)
+{
+    static const QRegularExpression variable("\\{[^}]+\\}"_L1);
+    QString pattern;
+    qsizetype pos = 0;
+    auto i = variable.globalMatch(uriTemplate);
+    while (i.hasNext()) {
+        const auto match = i.next();
+        pattern += QRegularExpression::escape(uriTemplate.mid(pos, match.capturedStart() - pos));
+        pattern += "([^/]+)"_L1;
+        pos = match.capturedEnd();
+    }
+    pattern += QRegularExpression::escape(uriTemplate.mid(pos));
+    return QRegularExpression(QRegularExpression::anchoredPattern(pattern));
+}
+}
+
+// derives a tool from every public method of toolSet, with its input schema
+QList<QMcpRegistry::Tool> QMcpRegistry::toolSetTools(QObject *toolSet, const QHash<QString, QString> &descriptions)
+{
+    const auto *mo = toolSet->metaObject();
+
+    QString prefix = toolSet->objectName();
+    if (!prefix.isEmpty())
+        prefix.append('/'_L1);
+
+    static const QHash<QString, QString> mcpTypes {
+        { "QString"_L1, "string"_L1 },
+        { "bool"_L1, "bool"_L1 },
+        { "int"_L1, "number"_L1 },
+    };
+    static const QSet<QString> internalTypes { "QUuid"_L1 };
+
+    QList<Tool> ret;
+    for (int i = mo->methodOffset(); i < mo->methodCount(); i++) {
+        const auto mm = mo->method(i);
+        if (mm.access() != QMetaMethod::Public)
+            continue;
+        if (mm.methodType() == QMetaMethod::Signal || mm.methodType() == QMetaMethod::Constructor)
+            continue;
+        QMcpTool tool;
+        const auto name = QString::fromUtf8(mm.name());
+        tool.setName(prefix + name);
+        if (descriptions.contains(name)) {
+            tool.setDescription(descriptions.value(name));
+        }
+        QMcpToolInputSchema inputSchema;
+        auto required = inputSchema.takeRequired();
+        auto properties = inputSchema.takeProperties();
+        const auto types = mm.parameterTypes();
+        const auto names = mm.parameterNames();
+        for (int j = 0; j < mm.parameterCount(); j++) {
+            const auto type = QString::fromUtf8(types.at(j));
+            const auto name = QString::fromUtf8(names.at(j));
+            QJsonObject object;
+            if (mcpTypes.contains(type))
+                object.insert("type"_L1, mcpTypes.value(type));
+            else if (internalTypes.contains(type))
+                continue;
+            else
+                qWarning() << "Unknown type" << type;
+
+            if (descriptions.contains("%1/%2"_L1.arg(tool.name(), name))) {
+                object.insert("description"_L1, descriptions.value("%1/%2"_L1.arg(tool.name(), name)));
+            }
+            properties.insert(name, object);
+            required.append(name);
+        }
+        inputSchema.setProperties(std::move(properties));
+        inputSchema.setRequired(std::move(required));
+        tool.setInputSchema(std::move(inputSchema));
+
+        Tool entry;
+        entry.validator = QMcpToolInputValidator(tool.inputSchema());
+        entry.tool = std::move(tool);
+        entry.kind = Tool::Method;
+        entry.object = toolSet;
+        ret.append(std::move(entry));
+    }
+    return ret;
+}
+
+QMcpRegistry::Tool QMcpRegistry::dynamicTool(const QMcpTool &tool, QMcpServerSession::DynamicToolHandler handler)
+{
+    Tool entry;
+    entry.tool = tool;
+    entry.validator = QMcpToolInputValidator(tool.inputSchema());
+    entry.kind = Tool::Dynamic;
+    entry.handler = std::move(handler);
+    return entry;
+}
+
+QMcpRegistry::Resource QMcpRegistry::dynamicResource(const QMcpResource &resource, QMcpServerSession::DynamicResourceHandler handler)
+{
+    Resource entry;
+    entry.key = resource.uri().toString();
+    entry.resource = resource;
+    entry.handler = std::move(handler);
+    return entry;
+}
+
+QMcpRegistry::Resource QMcpRegistry::dynamicResourceTemplate(const QMcpResourceTemplate &resourceTemplate, QMcpServerSession::DynamicResourceHandler handler)
+{
+    Resource entry;
+    // the template string is kept as is, QUrl would encode {id} as %7Bid%7D
+    entry.key = resourceTemplate.uriTemplate();
+    entry.resource.setName(resourceTemplate.name());
+    entry.resource.setDescription(resourceTemplate.description());
+    entry.resource.setUri(QUrl::fromEncoded(entry.key.toUtf8()));
+    entry.resource.setMimeType(resourceTemplate.mimeType());
+    entry.isTemplate = true;
+    entry.pattern = templatePattern(entry.key);
+    entry.handler = std::move(handler);
+    return entry;
+}
+
+const QMcpRegistry::Tool *QMcpRegistry::tool(const QString &name) const
+{
+    const auto i = toolIndex.constFind(name);
+    return i == toolIndex.cend() ? nullptr : &toolEntries.at(*i);
+}
+
+const QMcpRegistry::Resource *QMcpRegistry::resource(const QString &key) const
+{
+    const auto i = resourceIndex.constFind(key);
+    return i == resourceIndex.cend() ? nullptr : &resourceEntries.at(*i);
+}
+
+const QMcpRegistry::Prompt *QMcpRegistry::prompt(const QString &name) const
+{
+    const auto i = promptIndex.constFind(name);
+    return i == promptIndex.cend() ? nullptr : &promptEntries.at(*i);
+}
+
+void QMcpRegistry::addTools(QList<Tool> &&tools)
+{
+    if (tools.isEmpty())
+        return;
+    for (auto &tool : tools)
+        toolEntries.append(std::move(tool));
+    indexTools();
+}
+
+void QMcpRegistry::addTool(Tool &&tool)
+{
+    toolEntries.append(std::move(tool));
+    indexTools();
+}
+
+bool QMcpRegistry::removeTools(const std::function<bool(const Tool &)> &match)
+{
+    if (toolEntries.removeIf(match) == 0)
+        return false;
+    indexTools();
+    return true;
+}
+
+void QMcpRegistry::addResource(Resource &&resource)
+{
+    const auto i = resourceIndex.constFind(resource.key);
+    if (i != resourceIndex.cend()) {
+        resourceEntries[*i] = std::move(resource);
+    } else {
+        resourceIndex.insert(resource.key, resourceEntries.size());
+        resourceEntries.append(std::move(resource));
+    }
+    resourcesRev++;
+}
+
+bool QMcpRegistry::removeResource(const QString &key)
+{
+    const auto i = resourceIndex.constFind(key);
+    if (i == resourceIndex.cend())
+        return false;
+    resourceEntries.removeAt(*i);
+    indexResources();
+    return true;
+}
+
+void QMcpRegistry::addPrompt(Prompt &&prompt)
+{
+    promptEntries.append(std::move(prompt));
+    indexPrompts();
+}
+
+bool QMcpRegistry::removePrompts(const QString &name)
+{
+    const auto removed = promptEntries.removeIf([&name](const Prompt &prompt) {
+        return prompt.prompt.name() == name;
+    });
+    if (removed == 0)
+        return false;
+    indexPrompts();
+    return true;
+}
+
+void QMcpRegistry::indexTools()
+{
+    toolIndex.clear();
+    sortedTools.clear();
+    sortedTools.reserve(toolEntries.size());
+    for (const auto kind : { Tool::Dynamic, Tool::Method, Tool::Action }) {
+        for (qsizetype i = 0; i < toolEntries.size(); i++) {
+            const auto &entry = toolEntries.at(i);
+            if (entry.kind != kind)
+                continue;
+            if (!toolIndex.contains(entry.tool.name()))
+                toolIndex.insert(entry.tool.name(), i);
+            sortedTools.append(entry.tool);
+        }
+    }
+    std::stable_sort(sortedTools.begin(), sortedTools.end(), [](const QMcpTool &tool1, const QMcpTool &tool2) {
+        return tool1.name() < tool2.name();
+    });
+    toolsRev++;
+}
+
+void QMcpRegistry::indexResources()
+{
+    resourceIndex.clear();
+    for (qsizetype i = 0; i < resourceEntries.size(); i++)
+        resourceIndex.insert(resourceEntries.at(i).key, i);
+    resourcesRev++;
+}
+
+void QMcpRegistry::indexPrompts()
+{
+    promptIndex.clear();
+    for (qsizetype i = 0; i < promptEntries.size(); i++) {
+        const auto name = promptEntries.at(i).prompt.name();
+        if (!promptIndex.contains(name))
+            promptIndex.insert(name, i);
+    }
+    promptsRev++;
+}
+
+QT_END_NAMESPACE
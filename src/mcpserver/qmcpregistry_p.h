@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPREGISTRY_P_H
+#define QMCPREGISTRY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpServer/qmcpserverglobal.h>
+#include <QtMcpServer/qmcpserversession.h>
+#include <QtMcpCommon/qmcptoolinputvalidator.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qregularexpression.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// The tools, dynamic resources and dynamic prompts known to sessions.
+//
+// QMcpServer keeps one registry for all its sessions and never changes it
+// once published: a change is made to a copy, which replaces the registry
+// as a whole, and every session switches to the new one. The containers
+// are implicitly shared, so the copy only duplicates what the change
+// touches. Sessions keep a registry of their own, too, for what is
+// registered with them alone.
+//
+// Each kind of entry has a revision, bumped with every change to it, which
+// tells the sessions which of their lists changed.
+class Q_MCPSERVER_EXPORT QMcpRegistry
+{
+public:
+    struct Tool {
+        enum Kind {
+            // an invokable method of object, the tool set
+            Method,
+            // object is the QAction to trigger
+            Action,
+            // handler does the work
+            Dynamic,
+        };
+        QMcpTool tool;
+        QMcpToolInputValidator validator;
+        Kind kind = Method;
+        QObject *object = nullptr;
+        QMcpServerSession::DynamicToolHandler handler;
+    };
+
+    struct Resource {
+        // the URI, or the URI template as registered
+        QString key;
+        QMcpResource resource;
+        bool isTemplate = false;
+        // matches the URIs of a template
+        QRegularExpression pattern;
+        QMcpServerSession::DynamicResourceHandler handler;
+    };
+
+    struct Prompt {
+        QMcpPrompt prompt;
+        QMcpServerSession::DynamicPromptHandler handler;
+    };
+
+    static QList<Tool> toolSetTools(QObject *toolSet, const QHash<QString, QString> &descriptions);
+    static Tool dynamicTool(const QMcpTool &tool, QMcpServerSession::DynamicToolHandler handler);
+    static Resource dynamicResource(const QMcpResource &resource, QMcpServerSession::DynamicResourceHandler handler);
+    static Resource dynamicResourceTemplate(const QMcpResourceTemplate &resourceTemplate, QMcpServerSession::DynamicResourceHandler handler);
+
+    quint64 toolsRevision() const { return toolsRev; }
+    quint64 resourcesRevision() const { return resourcesRev; }
+    quint64 promptsRevision() const { return promptsRev; }
+    quint64 revision() const { return toolsRev + resourcesRev + promptsRev; }
+
+    // the tool called by name: dynamic tools come first, then methods,
+    // then actions, each in the order they were registered
+    const Tool *tool(const QString &name) const;
+    // sorted by name
+    const QList<QMcpTool> &toolList() const { return sortedTools; }
+
+    const Resource *resource(const QString &key) const;
+    const QList<Resource> &resources() const { return resourceEntries; }
+
+    const Prompt *prompt(const QString &name) const;
+    const QList<Prompt> &prompts() const { return promptEntries; }
+
+    void addTools(QList<Tool> &&tools);
+    void addTool(Tool &&tool);
+    bool removeTools(const std::function<bool(const Tool &)> &match);
+
+    // replaces the resource of the same key
+    void addResource(Resource &&resource);
+    bool removeResource(const QString &key);
+
+    void addPrompt(Prompt &&prompt);
+    bool removePrompts(const QString &name);
+
+private:
+    void indexTools();
+    void indexResources();
+    void indexPrompts();
+
+    QList<Tool> toolEntries;
+    QHash<QString, qsizetype> toolIndex;
+    QList<QMcpTool> sortedTools;
+    QList<Resource> resourceEntries;
+    QHash<QString, qsizetype> resourceIndex;
+    QList<Prompt> promptEntries;
+    QHash<QString, qsizetype> promptIndex;
+    quint64 toolsRev = 0;
+    quint64 resourcesRev = 0;
+    quint64 promptsRev = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPREGISTRY_P_H
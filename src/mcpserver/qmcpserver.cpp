@@ -2,16 +2,25 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpserver.h"
+#include "qmcpregistry_p.h"
 #include "qmcpserversession.h"
+#include "qmcptimerwheel_p.h"
+#include "qmcpworkstealingpool_p.h"
 #include <QtCore/QMetaType>
 #include <QtCore/private/qfactoryloader_p.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
+#include <QtCore/qtimer.h>
 #ifdef QT_GUI_LIB
 #include <QtGui/QAction>
 #endif
 #include <QtMcpCommon>
 #include <QtMcpServer/qmcpserverbackendinterface.h>
 #include <QtMcpServer/qmcpserverbackendplugin.h>
+
+#include <optional>
 QT_BEGIN_NAMESPACE
 
 Q_GLOBAL_STATIC_WITH_ARGS(QFactoryLoader, backendLoader,
@@ -23,40 +32,139 @@ public:
     Private(const QString &type, QMcpServer *parent);
 
     QMcpServerSession *findSession(const QUuid &sessionId, bool isInitialized, QMcpJSONRPCErrorError *error = nullptr) const;
+    void receive(const QUuid &session, const QByteArray &message);
+    // the responses of a batch, written together once all its requests
+    // are answered
+    struct Batch {
+        // one for the batch itself until all its messages are dispatched
+        qsizetype pending = 1;
+        QList<QByteArray> responses;
+        // of the requests, the response answers them
+        QList<QJsonValue> ids;
+    };
+    struct InFlight {
+        RequestContext context;
+        std::shared_ptr<Batch> batch;
+    };
+
+    void dispatch(const QUuid &session, const QJsonObject &object, const std::shared_ptr<Batch> &batch = {});
+    void dispatchBatch(const QUuid &session, const QJsonArray &array);
+    void complete(const QUuid &session, const std::shared_ptr<Batch> &batch, QByteArray &&response);
+    void write(const QUuid &session, QByteArray &&message);
+    void writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&response);
+    void respond(const QUuid &session, const QJsonValue &id, const RequestContext &context, const QMcpJSONRPCErrorError &error, const QByteArray &result);
+    void start(const QUuid &session, const QJsonValue &id, const RequestContext &context, std::function<QByteArray(QMcpJSONRPCErrorError *)> &&handler);
+    bool startDynamicTool(const QUuid &session, const QJsonValue &id, const QJsonObject &object, const RequestContext &context);
+    QMcpWorkStealingPool *workers();
+    int registerRequest(const QUuid &session, ResponseCallback &&callback);
+    bool takeRequest(const QUuid &session, const QJsonValue &id, ResponseCallback *callback);
+    void expireRequests();
+    void dropRequests(const QUuid &session, const QString &reason);
+    void touch(const QUuid &session);
+    void scheduleIdle(const QUuid &session, qint64 msecs);
+    void expireSessions();
+    void closeSession(const QUuid &session);
+    void updateRegistry(const std::function<bool(QMcpRegistry *)> &change);
+    int intern(const QString &method);
+
+    // makes the token and the progress reporter of a request current while
+    // its handler runs
+    class CurrentRequest
+    {
+    public:
+        explicit CurrentRequest(const RequestContext &context)
+            : token(QMcpCancellationToken::setCurrent(context.token))
+            , progress(QMcpProgressReporter::setCurrent(context.progress))
+        {}
+        ~CurrentRequest()
+        {
+            QMcpCancellationToken::setCurrent(token);
+            QMcpProgressReporter::setCurrent(progress);
+        }
+    private:
+        Q_DISABLE_COPY_MOVE(CurrentRequest)
+        const QMcpCancellationToken token;
+        const QMcpProgressReporter progress;
+    };
 private:
     QMcpServer *q;
 public:
     QMcpServerBackendInterface *backend = nullptr;
+    // set if the backend exchanges raw messages
+    QMcpServerBackendInterfaceV2 *backendV2 = nullptr;
     QMcpServerCapabilities capabilities;
     QString instructions;
     QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest; // Default to latest version
     QList<QtMcp::ProtocolVersion> supportedVersions = {QtMcp::ProtocolVersion::v2024_11_05, QtMcp::ProtocolVersion::v2025_03_26};
-    QHash<QUuid, QHash<QJsonValue, std::function<void(const QUuid &session, const QJsonObject &)>>> callbacks;
-    QHash<QString, std::function<QJsonValue(const QUuid &, const QJsonObject&, QMcpJSONRPCErrorError *)>> requestHandlers;
-    QMultiHash<QString, std::function<void(const QUuid &, const QJsonObject&)>> notificationHandlers;
-    QHash<QUuid, QMcpServerSession *> sessions;
-    QHash<QObject *, QHash<QString, QString>> toolSets;
-#ifdef QT_GUI_LIB
-    QHash<QAction *, QString> actions;
-#endif
-    QList<QPair<QMcpTool, QMcpServer::DynamicToolHandler>> dynamicTools;  // NEW: Runtime-registered tools
-
-    // Dynamic resources storage
-    struct DynamicResourceReg {
-        QMcpResource resource;
-        bool isTemplate;
-        QString templateString;  // Original template string (not URL-encoded)
-        QMcpServer::DynamicResourceHandler handler;
+    bool cborEnabled = false;
+    bool gadgetArenaEnabled = false;
+    // sessions switching to CBOR once the client confirms initialization
+    QSet<QUuid> pendingCbor;
+    // requests sent to the clients, waiting for their responses
+    struct Outgoing {
+        int nextId = 0;
+        QHash<QJsonValue, ResponseCallback> callbacks;
     };
-    QList<DynamicResourceReg> dynamicResources;
-
-    // Dynamic prompts storage
-    QList<QPair<QMcpPrompt, QMcpServer::DynamicPromptHandler>> dynamicPrompts;
+    QHash<QUuid, Outgoing> outgoing;
+    // expires the requests not answered within requestTimeout
+    struct Timeout {
+        QUuid session;
+        int id;
+    };
+    QMcpTimerWheel<Timeout> timeouts;
+    QTimer *timeoutTimer = nullptr;
+    int requestTimeout = 60000;
+    static constexpr int timeoutTick = 100;
+    // keeps the table bounded when a client does not answer
+    static constexpr qsizetype maxPendingRequests = 1024;
+    // requests of the clients not responded to yet, by request ID
+    QHash<QUuid, QHash<QJsonValue, InFlight>> inFlight;
+    // handlers indexed by method ID, called in place
+    QMcpMethodTable methods;
+    QList<std::function<QByteArray(const QUuid &, const QJsonObject&, const RequestContext &, QMcpJSONRPCErrorError *)>> requestHandlers;
+    // false for the handlers of the server, which use the sessions
+    QList<bool> pooledHandlers;
+    bool registeringBuiltins = false;
+    QList<QList<std::function<void(const QUuid &, const QJsonObject&)>>> notificationHandlers;
+    QHash<QUuid, QMcpServerSession *> sessions;
+    // when the client of a session last sent a message, on clock
+    QHash<QUuid, qint64> lastActivity;
+    QElapsedTimer clock;
+    // closes the sessions idle for sessionIdleTimeout, each is scheduled
+    // once and checked against lastActivity when it is due
+    QMcpTimerWheel<QUuid> idleSessions;
+    QTimer *idleTimer = nullptr;
+    int sessionIdleTimeout = 0;
+    static constexpr int idleTick = 1000;
+    // the tools, dynamic resources and dynamic prompts of all sessions,
+    // replaced as a whole by updateRegistry()
+    std::shared_ptr<const QMcpRegistry> registry = std::make_shared<const QMcpRegistry>();
+    bool selfRegistered = false;
+
+    QMcpServer::RequestExecution requestExecution = QMcpServer::Direct;
+    int threadPoolSize = 0;
+    int maxQueuedRequests = 1024;
+    int progressInterval = 100;
+    // keeps the requests of a session in order with PooledSerialPerSession
+    QHash<QUuid, std::shared_ptr<QMcpWorkStealingPool::Strand>> strands;
+    // declared last, so the running handlers finish before the rest is destroyed
+    std::unique_ptr<QMcpWorkStealingPool> pool;
 };
 
 QMcpServer::Private::Private(const QString &type, QMcpServer *parent)
     : q(parent)
+    , requestHandlers(QMcpMethod::KnownCount)
+    , pooledHandlers(QMcpMethod::KnownCount)
+    , notificationHandlers(QMcpMethod::KnownCount)
 {
+    timeoutTimer = new QTimer(q);
+    timeoutTimer->setInterval(timeoutTick);
+    connect(timeoutTimer, &QTimer::timeout, q, [this]() { expireRequests(); });
+    idleTimer = new QTimer(q);
+    idleTimer->setInterval(idleTick);
+    connect(idleTimer, &QTimer::timeout, q, [this]() { expireSessions(); });
+    clock.start();
+
     QMcpServerCapabilitiesResources resources;
     resources.setListChanged(true);
     resources.setSubscribe(true);
@@ -78,53 +186,39 @@ QMcpServer::Private::Private(const QString &type, QMcpServer *parent)
 
     backend->setParent(q);
     connect(backend, &QMcpServerBackendInterface::started, q, &QMcpServer::started);
+    connect(backend, &QMcpServerBackendInterface::finished, q, [this]() {
+        const auto sessions = outgoing.keys();
+        for (const auto &session : sessions)
+            dropRequests(session, "Connection closed"_L1);
+    });
     connect(backend, &QMcpServerBackendInterface::newSessionStarted, q, [this](const QUuid &sessionId) {
         auto session = new QMcpServerSession(sessionId, q);
 
-        // register self as tool set if it inherits from QMcpServer
-        if (q->metaObject() != &QMcpServer::staticMetaObject)
-            session->registerToolSet(q, q->toolDescriptions());
-
-        // register known tool set
-        for (auto i = toolSets.cbegin(), end = toolSets.cend(); i != end; ++i)
-            session->registerToolSet(i.key(), i.value());
-#ifdef QT_GUI_LIB
-        for (auto i = actions.cbegin(), end = actions.cend(); i != end; ++i)
-            session->registerTool(i.key(), i.value());
-#endif
-        // register dynamic tools
-        for (const auto &pair : std::as_const(dynamicTools))
-            session->registerDynamicTool(pair.first, pair.second);
-
-        // register dynamic resources
-        for (const auto &entry : std::as_const(dynamicResources)) {
-            if (entry.isTemplate) {
-                QMcpResourceTemplate tmpl;
-                tmpl.setName(entry.resource.name());
-                tmpl.setDescription(entry.resource.description());
-                // Use the stored template string instead of uri().toString()
-                // which would have {id} URL-encoded as %7Bid%7D
-                tmpl.setUriTemplate(entry.templateString);
-                tmpl.setMimeType(entry.resource.mimeType());
-                session->registerDynamicResourceTemplate(tmpl, entry.handler);
-            } else {
-                session->registerDynamicResource(entry.resource, entry.handler);
+        // register self as tool set if it inherits from QMcpServer, once
+        // the subclass is constructed
+        if (!selfRegistered) {
+            selfRegistered = true;
+            if (q->metaObject() != &QMcpServer::staticMetaObject) {
+                updateRegistry([this](QMcpRegistry *registry) {
+                    registry->addTools(QMcpRegistry::toolSetTools(q, q->toolDescriptions()));
+                    return true;
+                });
             }
         }
-
-        // register dynamic prompts
-        for (const auto &pair : std::as_const(dynamicPrompts))
-            session->registerDynamicPrompt(pair.first, pair.second);
+        session->setRegistry(registry);
 
         sessions.insert(sessionId, session);
+        lastActivity.insert(sessionId, clock.elapsed());
+        if (sessionIdleTimeout > 0)
+            scheduleIdle(sessionId, sessionIdleTimeout);
         connect(session, &QMcpServerSession::resourceUpdated, q, [this, session](const QMcpResource &resource) {
             if (!session->isInitialized()) return;
             const auto uri = resource.uri();
             if (session->isSubscribed(uri)) {
                 QMcpResourceUpdatedNotification notification;
-                auto params = notification.params();
+                auto params = notification.takeParams();
                 params.setUri(uri);
-                notification.setParams(params);
+                notification.setParams(std::move(params));
                 q->notify(session->sessionId(), notification, session->protocolVersion());
             }
         });
@@ -146,79 +240,476 @@ QMcpServer::Private::Private(const QString &type, QMcpServer *parent)
 
         emit q->newSession(session);
     });
-    connect(backend, &QMcpServerBackendInterface::received, q, [this](const QUuid &session, const QJsonObject &object) {
-        // response
+    if (auto *v2 = qobject_cast<QMcpServerBackendInterfaceV2 *>(backend)) {
+        backendV2 = v2;
+        connect(v2, &QMcpServerBackendInterfaceV2::sessionClosed, q, [this](const QUuid &session) {
+            closeSession(session);
+        });
+        connect(v2, &QMcpServerBackendInterfaceV2::messageReceived, q, [this](const QUuid &session, const QByteArray &message) {
+            touch(session);
+            receive(session, message);
+        });
+    } else {
+        // backends of the first interface parse the messages themselves
+        connect(backend, &QMcpServerBackendInterface::received, q, [this](const QUuid &session, const QJsonObject &object) {
+            touch(session);
+            dispatch(session, object);
+        });
+    }
+}
+
+void QMcpServer::Private::receive(const QUuid &session, const QByteArray &message)
+{
+    QJsonObject object;
+    if (QMcpCbor::isCbor(message)) {
+        bool ok = false;
+        object = QMcpCbor::toJsonObject(message, &ok);
+        if (!ok)
+            return;
+    } else {
+        QJsonParseError error;
+        const auto document = QJsonDocument::fromJson(message, &error);
+        if (error.error != QJsonParseError::NoError) {
+            qWarning() << "JSON parse error:" << error.errorString();
+            return;
+        }
+        if (document.isArray()) {
+            dispatchBatch(session, document.array());
+            return;
+        }
+        if (!document.isObject()) {
+            qWarning() << "JSON is not an object" << document;
+            return;
+        }
+        object = document.object();
+    }
+    dispatch(session, object);
+}
+
+void QMcpServer::Private::write(const QUuid &session, QByteArray &&message)
+{
+    if (backendV2) {
+        backendV2->writeMessage(session, std::move(message));
+        return;
+    }
+
+    // backends of the first interface take objects; they neither negotiate
+    // CBOR nor deliver batches, so the message is a JSON object
+    backend->send(session, QJsonDocument::fromJson(message).object());
+}
+
+// writes the response to the requests ids, the backend needs not look
+// into it to tell what it answers; an empty response tells they are not
+// answered
+void QMcpServer::Private::writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&response)
+{
+    if (backendV2)
+        backendV2->writeResponse(session, ids, std::move(response));
+    else if (!response.isEmpty())
+        write(session, std::move(response));
+}
+
+void QMcpServer::Private::respond(const QUuid &session, const QJsonValue &id, const RequestContext &context, const QMcpJSONRPCErrorError &error, const QByteArray &result)
+{
+    // nothing yet, the handler responds later
+    if (error.code() == 0 && result.isEmpty())
+        return;
+
+    // the result is encoded for the session already
+    QMcpJsonWriter writer(context.encoding);
+    if (error.code() != 0)
+        writer.writeError(id, error, context.protocolVersion);
+    else
+        writer.writeResponse(id, result);
+    q->finishRequest(session, id, writer.takeData());
+}
+
+void QMcpServer::Private::dispatchBatch(const QUuid &session, const QJsonArray &array)
+{
+    QMcpJSONRPCErrorError invalid;
+    invalid.setCode(-32600);
+    invalid.setMessage("Invalid Request"_L1);
+    const auto version = q->versionToUse(session);
+
+    if (array.isEmpty()) {
+        QMcpJsonWriter writer;
+        writer.writeError(QJsonValue(QJsonValue::Null), invalid, version);
+        writeResponse(session, { QJsonValue(QJsonValue::Null) }, writer.takeData());
+        return;
+    }
+
+    // the requests are dispatched like single ones, their handlers run in
+    // parallel with PooledConcurrent
+    auto batch = std::make_shared<Batch>();
+    for (const auto &value : array) {
+        if (value.isObject()) {
+            dispatch(session, value.toObject(), batch);
+        } else {
+            QMcpJsonWriter writer;
+            writer.writeError(QJsonValue(QJsonValue::Null), invalid, version);
+            batch->pending++;
+            batch->ids.append(QJsonValue(QJsonValue::Null));
+            complete(session, batch, writer.takeData());
+        }
+    }
+    complete(session, batch, {});
+}
+
+void QMcpServer::Private::complete(const QUuid &session, const std::shared_ptr<Batch> &batch, QByteArray &&response)
+{
+    if (!response.isEmpty())
+        batch->responses.append(std::move(response));
+    if (--batch->pending > 0)
+        return;
+    // nothing to answer for notifications only, nor if all requests were
+    // cancelled; the backend releases what waits for them
+    if (batch->responses.isEmpty()) {
+        if (!batch->ids.isEmpty())
+            writeResponse(session, batch->ids, {});
+        return;
+    }
+
+    QMcpJsonWriter writer;
+    writer.beginArray();
+    for (const auto &response : std::as_const(batch->responses))
+        writer.writeRawValue(response);
+    writer.endArray();
+    batch->responses.clear();
+    writeResponse(session, batch->ids, writer.takeData());
+}
+
+// runs the handler on a worker and responds on the thread of the server
+void QMcpServer::Private::start(const QUuid &session, const QJsonValue &id, const RequestContext &context, std::function<QByteArray(QMcpJSONRPCErrorError *)> &&handler)
+{
+    auto task = [this, session, id, context, gadgetArenaEnabled = gadgetArenaEnabled, handler = std::move(handler)]() {
+        // cancelled while queued
+        if (context.token.isCancelled())
+            return;
+        std::optional<QMcpGadgetArena> arena;
+        if (gadgetArenaEnabled)
+            arena.emplace();
+        QMcpJSONRPCErrorError error;
+        QByteArray result;
+        {
+            const CurrentRequest current(context);
+            result = handler(&error);
+        }
+        QMetaObject::invokeMethod(q, [this, session, id, context, error, result]() {
+            respond(session, id, context, error, result);
+        }, Qt::QueuedConnection);
+    };
+
+    auto *pool = workers();
+    bool started = false;
+    if (requestExecution == QMcpServer::PooledSerialPerSession) {
+        auto &strand = strands[session];
+        if (!strand)
+            strand = std::make_shared<QMcpWorkStealingPool::Strand>();
+        started = pool->tryStart(strand, std::move(task));
+    } else {
+        started = pool->tryStart(std::move(task));
+    }
+
+    if (!started) {
+        QMcpJSONRPCErrorError error;
+        error.setCode(-32000);
+        error.setMessage("Server is busy"_L1);
+        respond(session, id, context, error, {});
+    }
+}
+
+// starts a dynamic tool on a worker, the server handles everything else
+bool QMcpServer::Private::startDynamicTool(const QUuid &session, const QJsonValue &id, const QJsonObject &object, const RequestContext &context)
+{
+    const auto *sessionObj = findSession(session, true);
+    if (!sessionObj)
+        return false;
+    const QMcpCallToolRequestView request(object);
+    const auto params = request.params();
+    const auto name = params.name();
+    auto handler = sessionObj->dynamicToolHandler(name);
+    if (!handler)
+        return false;
+    auto arguments = params.arguments();
+    // invalid arguments are reported by the handler of the server
+    if (!sessionObj->validateToolArguments(name, arguments))
+        return false;
+
+    start(session, id, context, [handler = std::move(handler), arguments = std::move(arguments), context](QMcpJSONRPCErrorError *) {
+        QMcpCallToolResult result;
+        result.setContent(handler(arguments));
+        return QMcpJsonWriter::encode(result, context.encoding, context.protocolVersion);
+    });
+    return true;
+}
+
+QMcpWorkStealingPool *QMcpServer::Private::workers()
+{
+    if (!pool)
+        pool = std::make_unique<QMcpWorkStealingPool>(threadPoolSize, maxQueuedRequests);
+    return pool.get();
+}
+
+int QMcpServer::Private::registerRequest(const QUuid &session, ResponseCallback &&callback)
+{
+    auto &requests = outgoing[session];
+    if (requests.callbacks.size() >= maxPendingRequests) {
+        if (callback) {
+            QMetaObject::invokeMethod(q, [session, callback = std::move(callback)]() {
+                QMcpJSONRPCErrorError error;
+                error.setCode(-32000);
+                error.setMessage("Too many pending requests"_L1);
+                callback(session, {}, &error);
+            }, Qt::QueuedConnection);
+        }
+        return -1;
+    }
+
+    // requests without a callback are tracked as well, so their responses
+    // are consumed
+    const int id = requests.nextId++;
+    requests.callbacks.insert(id, std::move(callback));
+    if (requestTimeout > 0) {
+        timeouts.schedule({ session, id }, (requestTimeout + timeoutTick - 1) / timeoutTick);
+        if (!timeoutTimer->isActive())
+            timeoutTimer->start();
+    }
+    return id;
+}
+
+bool QMcpServer::Private::takeRequest(const QUuid &session, const QJsonValue &id, ResponseCallback *callback)
+{
+    auto i = outgoing.find(session);
+    if (i == outgoing.end())
+        return false;
+    auto j = i->callbacks.find(id);
+    if (j == i->callbacks.end())
+        return false;
+    *callback = std::move(*j);
+    i->callbacks.erase(j);
+    return true;
+}
+
+void QMcpServer::Private::expireRequests()
+{
+    // the keys of answered requests expire as well, and are skipped
+    const auto expired = timeouts.advance();
+    if (timeouts.isEmpty())
+        timeoutTimer->stop();
+
+    for (const auto &timeout : expired) {
+        ResponseCallback callback;
+        if (!takeRequest(timeout.session, timeout.id, &callback))
+            continue;
+
+        // the client may stop working on it
+        QMcpCancelledNotification notification;
+        auto params = notification.params();
+        params.setRequestId(timeout.id);
+        params.setReason("Request timed out"_L1);
+        notification.setParams(params);
+        q->notify(timeout.session, notification);
+
+        if (callback) {
+            QMcpJSONRPCErrorError error;
+            error.setCode(-32001);
+            error.setMessage("Request timed out"_L1);
+            callback(timeout.session, {}, &error);
+        }
+    }
+}
+
+// answers the requests waiting for session with an error
+void QMcpServer::Private::dropRequests(const QUuid &session, const QString &reason)
+{
+    const auto requests = outgoing.take(session);
+    QMcpJSONRPCErrorError error;
+    error.setCode(-32000);
+    error.setMessage(reason);
+    for (const auto &callback : requests.callbacks) {
+        if (callback)
+            callback(session, {}, &error);
+    }
+}
+
+void QMcpServer::Private::touch(const QUuid &session)
+{
+    const auto i = lastActivity.find(session);
+    if (i != lastActivity.end())
+        *i = clock.elapsed();
+}
+
+void QMcpServer::Private::scheduleIdle(const QUuid &session, qint64 msecs)
+{
+    idleSessions.schedule(session, (msecs + idleTick - 1) / idleTick);
+    if (!idleTimer->isActive())
+        idleTimer->start();
+}
+
+// closes the sessions due that were idle all along, the others are
+// scheduled again for the rest of their timeout
+void QMcpServer::Private::expireSessions()
+{
+    const auto now = clock.elapsed();
+    const auto due = idleSessions.advance();
+    for (const auto &session : due) {
+        const auto i = lastActivity.constFind(session);
+        // closed already
+        if (i == lastActivity.cend())
+            continue;
+        const auto idle = now - *i;
+        if (inFlight.contains(session)) {
+            scheduleIdle(session, sessionIdleTimeout);
+        } else if (idle < sessionIdleTimeout) {
+            scheduleIdle(session, sessionIdleTimeout - idle);
+        } else {
+            closeSession(session);
+            // the backend forgets it, too
+            if (backendV2)
+                backendV2->closeSession(session);
+        }
+    }
+    if (idleSessions.isEmpty())
+        idleTimer->stop();
+}
+
+// reclaims everything kept for session
+void QMcpServer::Private::closeSession(const QUuid &sessionId)
+{
+    auto *session = sessions.take(sessionId);
+    if (!session)
+        return;
+    lastActivity.remove(sessionId);
+    pendingCbor.remove(sessionId);
+    strands.remove(sessionId);
+
+    // the handlers still running are cancelled, their responses dropped
+    const auto requests = inFlight.take(sessionId);
+    for (const auto &request : requests) {
+        request.context.progress.close();
+        request.context.token.cancel();
+    }
+    dropRequests(sessionId, "Session closed"_L1);
+
+    emit q->sessionClosed(session);
+    session->deleteLater();
+}
+
+// publishes a changed copy of the registry to all sessions; the copy
+// shares everything change does not touch
+void QMcpServer::Private::updateRegistry(const std::function<bool(QMcpRegistry *)> &change)
+{
+    auto next = std::make_shared<QMcpRegistry>(*registry);
+    if (!change(next.get()))
+        return;
+    registry = std::move(next);
+    for (auto *session : std::as_const(sessions))
+        session->setRegistry(registry);
+}
+
+void QMcpServer::Private::dispatch(const QUuid &session, const QJsonObject &object, const std::shared_ptr<Batch> &batch)
+{
+    // the gadgets of the message and its response share one arena
+    std::optional<QMcpGadgetArena> arena;
+    if (gadgetArenaEnabled)
+        arena.emplace();
+
+    // response
+    if (object.contains("id"_L1)) {
+        const auto id = object.value("id"_L1);
+        ResponseCallback callback;
+        if (object.contains("result"_L1)) {
+            if (takeRequest(session, id, &callback)) {
+                if (callback)
+                    callback(session, object.value("result"_L1).toObject(), nullptr);
+                return;
+            }
+        } else if (object.contains("error"_L1)) {
+            if (takeRequest(session, id, &callback)) {
+                QMcpJSONRPCErrorError error;
+                error.fromJsonObject(object.value("error"_L1).toObject(), q->versionToUse(session));
+                if (callback)
+                    callback(session, {}, &error);
+                return;
+            }
+        }
+    }
+    if (object.contains("method"_L1)) {
+        const auto method = methods.find(object.value("method"_L1).toString());
+
+        // request
         if (object.contains("id"_L1)) {
             const auto id = object.value("id"_L1);
-            if (object.contains("result"_L1)) {
-                if (callbacks[session].contains(id)) {
-                    const auto result = object.value("result"_L1).toObject();
-                    callbacks[session].take(id)(session, result);
-                    return;
-                }
-            } else if (object.contains("error"_L1)) {
-                qWarning() << "TODO: error handling" << object;;
-                if (callbacks[session].contains(id)) {
-                    callbacks[session].take(id)(session, {});
-                    return;
-                }
+            auto sessionObj = sessions.value(session);
+            const auto version = sessionObj ? sessionObj->protocolVersion() : protocolVersion;
+            // batches are JSON arrays, their responses are joined as JSON
+            const auto encoding = batch ? QtMcp::Encoding::Json : q->encodingToUse(session);
+            if (batch) {
+                batch->pending++;
+                batch->ids.append(id);
             }
-        }
-        if (object.contains("method"_L1)) {
-            const auto method = object.value("method"_L1).toString();
-
-            // request
-            if (object.contains("id"_L1)) {
-                const auto id = object.value("id"_L1);
-                if (requestHandlers.contains(method)) {
-                    const auto handler = requestHandlers.value(method);
-                    QMcpJSONRPCErrorError error;
-                    const auto result = handler(session, object, &error);
-                    if (error.code() > 0) {
-                        QMcpJSONRPCError response;
-                        response.setId(id);
-                        response.setError(error);
-                        auto sessionObj = sessions.value(session);
-                        q->send(session, response.toJsonObject(sessionObj ?
-                                sessionObj->protocolVersion() :
-                                protocolVersion));
-                    } else if (result.isObject()){
-                        QMcpJSONRPCResponse response;
-                        response.setId(id);
-                        auto sessionObj = sessions.value(session);
-                        auto object = response.toJsonObject(sessionObj ?
-                                     sessionObj->protocolVersion() :
-                                     protocolVersion);
-                        object.insert("result"_L1, result.toObject());
-                        q->send(session, object);
+            if (method >= 0 && requestHandlers.at(method)) {
+                QMcpProgressReporter progress;
+                const auto progressToken = object.value("params"_L1).toObject()
+                        .value("_meta"_L1).toObject().value("progressToken"_L1);
+                // a session without a channel for notifications gets none
+                if (!progressToken.isUndefined() && (!backendV2 || backendV2->canNotify(session))) {
+                    // encoded like the response, for the session
+                    progress = QMcpProgressReporter(q, progressInterval, [this, session, token = progressToken.toVariant(), encoding, version](qreal value, qreal total) {
+                        QMcpProgressNotification notification;
+                        auto params = notification.params();
+                        params.setProgressToken(token);
+                        params.setProgress(value);
+                        if (total > 0)
+                            params.setTotal(total);
+                        notification.setParams(params);
+                        write(session, QMcpJsonWriter::encode(notification, encoding, version));
+                    });
+                }
+                const RequestContext context { version, encoding, {}, progress };
+                inFlight[session].insert(id, { context, batch });
+                const auto &handler = requestHandlers.at(method);
+                if (requestExecution != QMcpServer::Direct) {
+                    if (pooledHandlers.at(method)) {
+                        start(session, id, context, [handler, session, object, context](QMcpJSONRPCErrorError *error) {
+                            return handler(session, object, context, error);
+                        });
+                        return;
                     }
-                } else {
-                    // Respond with error
-                    QMcpJSONRPCError response;
-                    response.setId(id.toVariant());
-                    auto error = response.error();
-                    error.setMessage("Server doesn't handle the request"_L1);
-                    response.setError(error);
-                    auto sessionObj = sessions.value(session);
-                    q->send(session, response.toJsonObject(sessionObj ?
-                            sessionObj->protocolVersion() :
-                            protocolVersion));
+                    if (method == QMcpMethod::ToolsCall && startDynamicTool(session, id, object, context))
+                        return;
                 }
-                return;
-            }
-
-            // notification
-            if (notificationHandlers.contains(method)) {
-                const auto handlers = notificationHandlers.values(method);
-                for (auto &handler : handlers) {
-                    handler(session, object);
+                QMcpJSONRPCErrorError error;
+                QByteArray result;
+                {
+                    const CurrentRequest current(context);
+                    result = handler(session, object, context, &error);
                 }
-                return;
+                respond(session, id, context, error, result);
+            } else {
+                // Respond with error
+                QMcpJsonWriter writer(encoding);
+                QMcpJSONRPCErrorError error;
+                error.setMessage("Server doesn't handle the request"_L1);
+                writer.writeError(id, error, version);
+                if (batch)
+                    complete(session, batch, writer.takeData());
+                else
+                    writeResponse(session, { id }, writer.takeData());
             }
+            return;
         }
 
-        qWarning() << "not handled" << object;
-    });
+        // notification
+        if (method >= 0 && !notificationHandlers.at(method).isEmpty()) {
+            const auto &handlers = notificationHandlers.at(method);
+            for (qsizetype i = 0; i < handlers.size(); i++)
+                handlers.at(i)(session, object);
+            return;
+        }
+    }
+
+    qWarning() << "not handled" << object;
 }
 
 QMcpServerSession *QMcpServer::Private::findSession(const QUuid &sessionId, bool isInitialized, QMcpJSONRPCErrorError *error) const
@@ -241,6 +732,17 @@ QMcpServerSession *QMcpServer::Private::findSession(const QUuid &sessionId, bool
     return session;
 }
 
+int QMcpServer::Private::intern(const QString &method)
+{
+    const auto id = methods.intern(method);
+    if (id >= requestHandlers.size()) {
+        requestHandlers.resize(methods.size());
+        pooledHandlers.resize(methods.size());
+        notificationHandlers.resize(methods.size());
+    }
+    return id;
+}
+
 QStringList QMcpServer::backends()
 {
     return backendLoader()->keyMap().values();
@@ -250,6 +752,8 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
     : QObject(parent)
     , d(new Private(backend, this))
 {
+    // the handlers below use the sessions, they stay on this thread
+    d->registeringBuiltins = true;
     addRequestHandler([this](const QUuid &sessionId, const QMcpInitializeRequest &request, QMcpJSONRPCErrorError *error) {
         QMcpInitializeResult result;
         auto session = d->findSession(sessionId, false, error);
@@ -274,12 +778,25 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
             const_cast<QMcpServerSession*>(session)->setProtocolVersion(negotiatedVersion);
         }
 
-        result.setCapabilities(d->capabilities);
+        auto capabilities = d->capabilities;
+        // offer CBOR to clients announcing it, it is used after initialization
+        const auto cbor = QMcpCbor::capability();
+        if (d->cborEnabled && d->backendV2 && d->backendV2->supportsCbor()
+                && request.params().capabilities().experimental().additionalProperties().contains(cbor)) {
+            auto experimental = capabilities.takeExperimental();
+            auto properties = experimental.takeAdditionalProperties();
+            properties.insert(cbor, QJsonObject());
+            experimental.setAdditionalProperties(std::move(properties));
+            capabilities.setExperimental(std::move(experimental));
+            d->pendingCbor.insert(sessionId);
+        }
+
+        result.setCapabilities(std::move(capabilities));
         result.setInstructions(d->instructions);
-        auto serverInfo = result.serverInfo();
+        auto serverInfo = result.takeServerInfo();
         serverInfo.setName(QCoreApplication::applicationName());
         serverInfo.setVersion(QCoreApplication::applicationVersion());
-        result.setServerInfo(serverInfo);
+        result.setServerInfo(std::move(serverInfo));
         result.setProtocolVersion(QtMcp::protocolVersionToString(negotiatedVersion)); // Use the negotiated version
         return result;
     });
@@ -288,6 +805,8 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
         auto session = d->findSession(sessionId, false);
         if (!session)
             return;
+        if (d->pendingCbor.remove(sessionId))
+            session->setEncoding(QtMcp::Encoding::Cbor);
         session->setInitialized(true);
     });
 
@@ -315,7 +834,7 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
         return result;
     });
 
-    addRequestHandler([this](const QUuid &sessionId, const QMcpReadResourceRequest &request, QMcpJSONRPCErrorError *error) {
+    addRequestHandler([this](const QUuid &sessionId, const QMcpReadResourceRequestView &request, QMcpJSONRPCErrorError *error) {
         QMcpReadResourceResult result;
         auto session = d->findSession(sessionId, true, error);
         if (!session)
@@ -357,16 +876,21 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
         return result;
     });
 
-    addRequestHandler([this](const QUuid &sessionId, const QMcpCallToolRequest &request, QMcpJSONRPCErrorError *error) {
+    addRequestHandler([this](const QUuid &sessionId, const QMcpCallToolRequestView &request, QMcpJSONRPCErrorError *error) {
         QMcpCallToolResult result;
         auto session = d->findSession(sessionId, true, error);
         if (!session)
             return result;
         const auto params = request.params();
         bool ok;
-        auto contents = session->callTool(params.name(), params.arguments(), &ok);
+        QString message;
+        auto contents = session->callTool(params.name(), params.arguments(), &ok, &message);
         if (ok) {
-            result.setContent(contents);
+            result.setContent(std::move(contents));
+        } else if (!message.isEmpty()) {
+            // Invalid params
+            error->setCode(-32602);
+            error->setMessage(message);
         }
         return result;
     });
@@ -377,13 +901,12 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
         if (!session)
             return result;
         auto cursor = request.params().cursor();
-        auto prompts = session->prompts(&cursor);
-        result.setPrompts(prompts);
+        result.setPrompts(session->prompts(&cursor));
         result.setNextCursor(cursor);
         return result;
     });
 
-    addRequestHandler([this](const QUuid &sessionId, const QMcpGetPromptRequest &request, QMcpJSONRPCErrorError *error) {
+    addRequestHandler([this](const QUuid &sessionId, const QMcpGetPromptRequestView &request, QMcpJSONRPCErrorError *error) {
         QMcpGetPromptResult result;
         auto session = d->findSession(sessionId, true, error);
         if (!session)
@@ -401,12 +924,38 @@ QMcpServer::QMcpServer(const QString &backend, QObject *parent)
             return;
 
         QMcpListRootsRequest request;
-        this->request(sessionId, request, [this](const QUuid &sessionId, const QMcpListRootsResult &result) {
+        this->request(sessionId, request, [this](const QUuid &sessionId, const QMcpListRootsResult &result, const QMcpJSONRPCErrorError *error) {
+            // the roots known are kept
+            if (error)
+                return;
             auto session = d->findSession(sessionId, true);
             if (session)
                 session->setRoots(result.roots());
         });
     });
+    addNotificationHandler([this](const QUuid &sessionId, const QMcpCancelledNotification &notification) {
+        // the request may be done already
+        const auto id = QJsonValue::fromVariant(notification.params().requestId());
+        auto i = d->inFlight.find(sessionId);
+        if (i == d->inFlight.end())
+            return;
+        auto j = i->find(id);
+        if (j == i->end())
+            return;
+        const auto entry = *j;
+        i->erase(j);
+        if (i->isEmpty())
+            d->inFlight.erase(i);
+        entry.context.progress.close();
+        entry.context.token.cancel();
+        // the rest of the batch is answered without it, a single request
+        // is not answered at all
+        if (entry.batch)
+            d->complete(sessionId, entry.batch, {});
+        else
+            d->writeResponse(sessionId, { id }, {});
+    });
+    d->registeringBuiltins = false;
 }
 
 QMcpServer::~QMcpServer() = default;
@@ -419,165 +968,171 @@ void QMcpServer::start(const QString &args)
 
 void QMcpServer::registerToolSet(QObject *toolSet, const QHash<QString, QString> &descriptions)
 {
-    d->toolSets.insert(toolSet, descriptions);
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerToolSet(toolSet, descriptions);
-    }
+    d->updateRegistry([toolSet, &descriptions](QMcpRegistry *registry) {
+        // registering again replaces the descriptions
+        registry->removeTools([toolSet](const QMcpRegistry::Tool &tool) {
+            return tool.kind == QMcpRegistry::Tool::Method && tool.object == toolSet;
+        });
+        registry->addTools(QMcpRegistry::toolSetTools(toolSet, descriptions));
+        return true;
+    });
 }
 
 void QMcpServer::unregisterToolSet(QObject *toolSet)
 {
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->unregisterToolSet(toolSet);
-    }
-    d->toolSets.remove(toolSet);
+    d->updateRegistry([toolSet](QMcpRegistry *registry) {
+        return registry->removeTools([toolSet](const QMcpRegistry::Tool &tool) {
+            return tool.kind == QMcpRegistry::Tool::Method && tool.object == toolSet;
+        });
+    });
 }
 
 #ifdef QT_GUI_LIB
 void QMcpServer::registerTool(QAction *action, const QString &name)
 {
-    QString name2 = name.isEmpty() ? action->text() : name;
-    d->actions.insert(action, name2);
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerTool(action, name2);
-    }
+    QMcpRegistry::Tool entry;
+    entry.tool.setName(name.isEmpty() ? action->text() : name);
+    entry.tool.setDescription(action->toolTip());
+    entry.kind = QMcpRegistry::Tool::Action;
+    entry.object = action;
+    d->updateRegistry([action, &entry](QMcpRegistry *registry) {
+        registry->removeTools([action](const QMcpRegistry::Tool &tool) {
+            return tool.kind == QMcpRegistry::Tool::Action && tool.object == action;
+        });
+        registry->addTool(std::move(entry));
+        return true;
+    });
 }
 
 void QMcpServer::unregisterTool(QAction *action)
 {
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->unregisterTool(action);
-    }
-    d->actions.remove(action);
+    d->updateRegistry([action](QMcpRegistry *registry) {
+        return registry->removeTools([action](const QMcpRegistry::Tool &tool) {
+            return tool.kind == QMcpRegistry::Tool::Action && tool.object == action;
+        });
+    });
 }
 #endif
 
 void QMcpServer::registerDynamicTool(const QMcpTool &tool, DynamicToolHandler handler)
 {
-    d->dynamicTools.append(std::make_pair(tool, handler));
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerDynamicTool(tool, handler);
-    }
+    d->updateRegistry([&](QMcpRegistry *registry) {
+        registry->addTool(QMcpRegistry::dynamicTool(tool, std::move(handler)));
+        return true;
+    });
 }
 
 void QMcpServer::unregisterDynamicTool(const QString &name)
 {
-    // Remove from stored list
-    for (int i = d->dynamicTools.length() - 1; i >= 0; i--) {
-        if (d->dynamicTools.at(i).first.name() == name) {
-            d->dynamicTools.removeAt(i);
-        }
-    }
-    // Remove from all sessions
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->unregisterDynamicTool(name);
-    }
+    d->updateRegistry([&name](QMcpRegistry *registry) {
+        return registry->removeTools([&name](const QMcpRegistry::Tool &tool) {
+            return tool.kind == QMcpRegistry::Tool::Dynamic && tool.tool.name() == name;
+        });
+    });
 }
 
 void QMcpServer::registerDynamicResourceTemplate(const QMcpResourceTemplate &resourceTemplate,
                                                    DynamicResourceHandler handler)
 {
-    Private::DynamicResourceReg entry;
-    entry.resource.setName(resourceTemplate.name());
-    entry.resource.setDescription(resourceTemplate.description());
-    entry.resource.setUri(QUrl(resourceTemplate.uriTemplate()));
-    entry.resource.setMimeType(resourceTemplate.mimeType());
-    entry.isTemplate = true;
-    entry.templateString = resourceTemplate.uriTemplate();  // Store original template string
-    entry.handler = handler;
-
-    d->dynamicResources.append(entry);
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerDynamicResourceTemplate(resourceTemplate, handler);
-    }
+    d->updateRegistry([&](QMcpRegistry *registry) {
+        registry->addResource(QMcpRegistry::dynamicResourceTemplate(resourceTemplate, std::move(handler)));
+        return true;
+    });
 }
 
 void QMcpServer::registerDynamicResource(const QMcpResource &resource,
                                           DynamicResourceHandler handler)
 {
-    Private::DynamicResourceReg entry;
-    entry.resource = resource;
-    entry.isTemplate = false;
-    entry.handler = handler;
-
-    d->dynamicResources.append(entry);
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerDynamicResource(resource, handler);
-    }
+    d->updateRegistry([&](QMcpRegistry *registry) {
+        registry->addResource(QMcpRegistry::dynamicResource(resource, std::move(handler)));
+        return true;
+    });
 }
 
 void QMcpServer::unregisterDynamicResource(const QUrl &uri)
 {
-    // Remove from stored list
-    for (int i = d->dynamicResources.length() - 1; i >= 0; i--) {
-        if (d->dynamicResources.at(i).resource.uri() == uri) {
-            d->dynamicResources.removeAt(i);
-        }
-    }
-    // Remove from all sessions
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->unregisterDynamicResource(uri);
-    }
+    d->updateRegistry([&uri](QMcpRegistry *registry) {
+        return registry->removeResource(uri.toString());
+    });
 }
 
 void QMcpServer::registerDynamicPrompt(const QMcpPrompt &prompt, DynamicPromptHandler handler)
 {
-    d->dynamicPrompts.append(std::make_pair(prompt, handler));
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->registerDynamicPrompt(prompt, handler);
-    }
+    d->updateRegistry([&](QMcpRegistry *registry) {
+        registry->addPrompt({ prompt, std::move(handler) });
+        return true;
+    });
 }
 
 void QMcpServer::unregisterDynamicPrompt(const QString &name)
 {
-    // Remove from stored list
-    for (int i = d->dynamicPrompts.length() - 1; i >= 0; i--) {
-        if (d->dynamicPrompts.at(i).first.name() == name) {
-            d->dynamicPrompts.removeAt(i);
-        }
-    }
-    // Remove from all sessions
-    const auto sessions = d->sessions.values();
-    for (auto *session : sessions) {
-        session->unregisterDynamicPrompt(name);
-    }
+    d->updateRegistry([&name](QMcpRegistry *registry) {
+        return registry->removePrompts(name);
+    });
 }
 
-void QMcpServer::send(const QUuid &session, const QJsonObject &request, std::function<void(const QUuid &session, const QJsonObject &)> callback)
+void QMcpServer::send(const QUuid &session, const QJsonObject &request, ResponseCallback callback)
 {
     if (!d->backend) return;
-    static int id = 0;
+    auto request2 = request;
     if (request.contains("id"_L1) && request.value("id"_L1).isNull()) {
-        auto request2 = request;
+        const int id = registerRequest(session, std::move(callback));
+        if (id < 0)
+            return;
         request2.insert("id"_L1, id);
-
-        if (callback)
-            d->callbacks[session].insert(id, callback);
-        id++;
-        d->backend->send(session, request2);
-    } else {
-        d->backend->send(session, request);
     }
+    if (encodingToUse(session) == QtMcp::Encoding::Cbor)
+        d->write(session, QMcpJsonWriter::toCbor(request2));
+    else if (d->backendV2)
+        d->write(session, QMcpJsonWriter::toJson(request2));
+    else
+        d->backend->send(session, request2);
+}
+
+void QMcpServer::send(const QUuid &session, QByteArray message)
+{
+    if (!d->backend) return;
+    d->write(session, std::move(message));
+}
+
+int QMcpServer::registerRequest(const QUuid &session, ResponseCallback callback)
+{
+    return d->registerRequest(session, std::move(callback));
 }
 
-void QMcpServer::registerRequestHandler(const QString &method, std::function<QJsonValue(const QUuid &, const QJsonObject &, QMcpJSONRPCErrorError *)> callback)
+void QMcpServer::registerRequestHandler(const QString &method, std::function<QByteArray(const QUuid &, const QJsonObject &, const RequestContext &, QMcpJSONRPCErrorError *)> callback)
 {
-    d->requestHandlers.insert(method, callback);
+    const auto id = d->intern(method);
+    d->requestHandlers[id] = std::move(callback);
+    d->pooledHandlers[id] = !d->registeringBuiltins;
+}
+
+bool QMcpServer::finishRequest(const QUuid &session, const QJsonValue &id, QByteArray response)
+{
+    auto i = d->inFlight.find(session);
+    if (i == d->inFlight.end())
+        return false;
+    auto j = i->find(id);
+    if (j == i->end())
+        return false;
+    const auto entry = *j;
+    i->erase(j);
+    if (i->isEmpty())
+        d->inFlight.erase(i);
+
+    // the last value goes out before the response
+    entry.context.progress.flush();
+    entry.context.progress.close();
+    if (entry.batch)
+        d->complete(session, entry.batch, std::move(response));
+    else
+        d->writeResponse(session, { id }, std::move(response));
+    return true;
 }
 
 void QMcpServer::registerNotificationHandler(const QString &method, std::function<void(const QUuid &, const QJsonObject &)> callback)
 {
-    d->notificationHandlers.insert(method, callback);
+    d->notificationHandlers[d->intern(method)].append(std::move(callback));
 }
 
 QMcpServerCapabilities QMcpServer::capabilities() const
@@ -634,6 +1189,114 @@ bool QMcpServer::isProtocolVersionSupported(QtMcp::ProtocolVersion version) cons
     return d->supportedVersions.contains(version);
 }
 
+bool QMcpServer::isCborEnabled() const
+{
+    return d->cborEnabled;
+}
+
+void QMcpServer::setCborEnabled(bool enabled)
+{
+    if (d->cborEnabled == enabled) return;
+    d->cborEnabled = enabled;
+    emit cborEnabledChanged(enabled);
+}
+
+bool QMcpServer::isGadgetArenaEnabled() const
+{
+    return d->gadgetArenaEnabled;
+}
+
+void QMcpServer::setGadgetArenaEnabled(bool enabled)
+{
+    if (d->gadgetArenaEnabled == enabled) return;
+    d->gadgetArenaEnabled = enabled;
+    emit gadgetArenaEnabledChanged(enabled);
+}
+
+QMcpServer::RequestExecution QMcpServer::requestExecution() const
+{
+    return d->requestExecution;
+}
+
+void QMcpServer::setRequestExecution(RequestExecution execution)
+{
+    if (d->requestExecution == execution) return;
+    d->requestExecution = execution;
+    emit requestExecutionChanged(execution);
+}
+
+int QMcpServer::threadPoolSize() const
+{
+    return d->threadPoolSize;
+}
+
+void QMcpServer::setThreadPoolSize(int size)
+{
+    if (d->threadPoolSize == size) return;
+    d->threadPoolSize = size;
+    // started again with the next request
+    d->pool.reset();
+    emit threadPoolSizeChanged(size);
+}
+
+int QMcpServer::maxQueuedRequests() const
+{
+    return d->maxQueuedRequests;
+}
+
+void QMcpServer::setMaxQueuedRequests(int count)
+{
+    if (d->maxQueuedRequests == count) return;
+    d->maxQueuedRequests = count;
+    d->pool.reset();
+    emit maxQueuedRequestsChanged(count);
+}
+
+int QMcpServer::requestTimeout() const
+{
+    return d->requestTimeout;
+}
+
+void QMcpServer::setRequestTimeout(int msecs)
+{
+    if (d->requestTimeout == msecs) return;
+    d->requestTimeout = msecs;
+    emit requestTimeoutChanged(msecs);
+}
+
+int QMcpServer::sessionIdleTimeout() const
+{
+    return d->sessionIdleTimeout;
+}
+
+void QMcpServer::setSessionIdleTimeout(int msecs)
+{
+    if (d->sessionIdleTimeout == msecs) return;
+    d->sessionIdleTimeout = msecs;
+
+    // the sessions are scheduled again, for the rest of the new timeout
+    d->idleSessions = QMcpTimerWheel<QUuid>();
+    d->idleTimer->stop();
+    if (msecs > 0) {
+        const auto now = d->clock.elapsed();
+        for (auto i = d->lastActivity.cbegin(), end = d->lastActivity.cend(); i != end; ++i)
+            d->scheduleIdle(i.key(), qMax(msecs - (now - i.value()), qint64(1)));
+    }
+    emit sessionIdleTimeoutChanged(msecs);
+}
+
+int QMcpServer::progressInterval() const
+{
+    return d->progressInterval;
+}
+
+void QMcpServer::setProgressInterval(int msecs)
+{
+    if (d->progressInterval == msecs) return;
+    d->progressInterval = msecs;
+    emit progressIntervalChanged(msecs);
+}
+
 QtMcp::ProtocolVersion QMcpServer::versionToUse(const QUuid &session, QtMcp::ProtocolVersion defaultVersion) const
 {
     // If defaultVersion is not Latest, use it directly
@@ -642,17 +1305,19 @@ QtMcp::ProtocolVersion QMcpServer::versionToUse(const QUuid &session, QtMcp::Pro
     }
 
     // Try to find the session's negotiated version
-    const auto sessions = this->sessions();
-    for (const auto *s : sessions) {
-        if (s->sessionId() == session) {
-            return s->protocolVersion();
-        }
-    }
+    if (const auto *s = d->sessions.value(session))
+        return s->protocolVersion();
 
     // If session not found, use server's default protocol version
     return protocolVersion();
 }
 
+QtMcp::Encoding QMcpServer::encodingToUse(const QUuid &session) const
+{
+    const auto *s = d->sessions.value(session);
+    return s ? s->encoding() : QtMcp::Encoding::Json;
+}
+
 QHash<QString, QString> QMcpServer::toolDescriptions() const
 {
     return {};
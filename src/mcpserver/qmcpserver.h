@@ -14,7 +14,11 @@
 #include <QtMcpCommon/QMcpResult>
 #include <QtMcpCommon/QMcpServerCapabilities>
 #include <QtMcpCommon/QMcpTool>
+#include <QtMcpCommon/qmcpjsonview.h>
+#include <QtMcpCommon/qmcpjsonwriter.h>
 #include <QtMcpCommon/qtmcpnamespace.h>
+#include <QtMcpServer/qmcpcancellationtoken.h>
+#include <QtMcpServer/qmcpprogressreporter.h>
 #include <QtMcpServer/qmcpserverglobal.h>
 #include <QtMcpServer/qmcpserversession.h>
 #include <concepts>
@@ -59,6 +63,11 @@ class QAction;
     server->start("--log-level=debug");
     \endcode
 
+    A JSON-RPC batch is handled as a unit: its requests are dispatched one
+    after the other, and their responses are written together in one
+    message once the last one is ready. With PooledConcurrent, the handlers
+    of a batch run in parallel.
+
     \sa QMcpClient
 */
 class Q_MCPSERVER_EXPORT QMcpServer : public QObject
@@ -98,7 +107,124 @@ class Q_MCPSERVER_EXPORT QMcpServer : public QObject
         a compatible protocol version with clients.
     */
     Q_PROPERTY(QList<QtMcp::ProtocolVersion> supportedProtocolVersions READ supportedProtocolVersions NOTIFY supportedProtocolVersionsChanged FINAL)
+
+    /*!
+        \property QMcpServer::cborEnabled
+        This property holds whether the server offers the CBOR encoding.
+
+        When enabled and supported by the backend, clients announcing the
+        encoding during initialization exchange CBOR messages with the server
+        instead of JSON text. Other clients keep using JSON. Disabled by
+        default.
+
+        \sa QMcpCbor
+    */
+    Q_PROPERTY(bool cborEnabled READ isCborEnabled WRITE setCborEnabled NOTIFY cborEnabledChanged FINAL)
+
+    /*!
+        \property QMcpServer::gadgetArenaEnabled
+        This property holds whether the gadgets of a message are allocated
+        from a QMcpGadgetArena.
+
+        When enabled, the gadgets created while a message is dispatched and
+        while its handler runs share one arena, which saves allocations per
+        message. A gadget kept past the message, for example a result cached
+        by a handler, keeps all memory of the arena alive until it is
+        destroyed. Disabled by default.
+
+        \sa QMcpGadgetArena::retainedSize()
+    */
+    Q_PROPERTY(bool gadgetArenaEnabled READ isGadgetArenaEnabled WRITE setGadgetArenaEnabled NOTIFY gadgetArenaEnabledChanged FINAL)
+
+    /*!
+        \property QMcpServer::requestExecution
+        This property holds where the handlers added with addRequestHandler()
+        and the handlers of dynamic tools run.
+
+        By default they run on the thread of the server. Otherwise they run
+        on a pool of worker threads and their responses are sent from the
+        thread of the server once they return, so a slow handler no longer
+        holds up the other sessions. The handlers the server provides for
+        initialization, listing and subscriptions always run on the thread
+        of the server.
+
+        \sa threadPoolSize, maxQueuedRequests
+    */
+    Q_PROPERTY(RequestExecution requestExecution READ requestExecution WRITE setRequestExecution NOTIFY requestExecutionChanged FINAL)
+
+    /*!
+        \property QMcpServer::threadPoolSize
+        This property holds the number of worker threads running request
+        handlers, or 0 for QThread::idealThreadCount().
+
+        The threads are started with the first request handed to them.
+    */
+    Q_PROPERTY(int threadPoolSize READ threadPoolSize WRITE setThreadPoolSize NOTIFY threadPoolSizeChanged FINAL)
+
+    /*!
+        \property QMcpServer::maxQueuedRequests
+        This property holds how many requests may wait for a worker thread.
+
+        Requests received while the queue is full are answered with an
+        error instead of being queued. The default is 1024.
+    */
+    Q_PROPERTY(int maxQueuedRequests READ maxQueuedRequests WRITE setMaxQueuedRequests NOTIFY maxQueuedRequestsChanged FINAL)
+
+    /*!
+        \property QMcpServer::progressInterval
+        This property holds the minimum interval in milliseconds between two
+        progress notifications for one request.
+
+        The values reported in between are coalesced, only the latest one is
+        sent. The default is 100.
+
+        \sa QMcpProgressReporter
+    */
+    Q_PROPERTY(int progressInterval READ progressInterval WRITE setProgressInterval NOTIFY progressIntervalChanged FINAL)
+
+    /*!
+        \property QMcpServer::requestTimeout
+        This property holds how long in milliseconds the server waits for
+        the response to a request sent with request(), or 0 to wait as long
+        as the session lasts.
+
+        The callback of a request timing out gets an error, a late response
+        is ignored. The default is 60000.
+    */
+    Q_PROPERTY(int requestTimeout READ requestTimeout WRITE setRequestTimeout NOTIFY requestTimeoutChanged FINAL)
+
+    /*!
+        \property QMcpServer::sessionIdleTimeout
+        This property holds how long in milliseconds a session may go without
+        a message from its client before the server closes it, or 0 to keep
+        sessions until the backend closes them.
+
+        A session with requests still running is not idle. The default is 0.
+
+        \sa sessionClosed()
+    */
+    Q_PROPERTY(int sessionIdleTimeout READ sessionIdleTimeout WRITE setSessionIdleTimeout NOTIFY sessionIdleTimeoutChanged FINAL)
 public:
+    /*!
+        This enum describes where request handlers run.
+
+        \value Direct Handlers run on the thread of the server, one after the other.
+        \value PooledSerialPerSession Handlers run on worker threads. The
+               requests of one session are handled one after the other, in the
+               order they were received; different sessions are handled in parallel.
+        \value PooledConcurrent Handlers run on worker threads, the requests
+               of one session in parallel as well. Responses may then be sent
+               in a different order than the requests were received, backends
+               answering every request on a connection of its own, such as
+               streamable HTTP, match them to the requests by their ID.
+    */
+    enum RequestExecution {
+        Direct,
+        PooledSerialPerSession,
+        PooledConcurrent,
+    };
+    Q_ENUM(RequestExecution)
+
     /*!
         Returns a list of available backend implementations for the MCP server.
     */
@@ -128,6 +254,11 @@ public:
         using type = Arg;
     };
 
+    template<typename T, typename Arg>
+    struct CallbackArg<void(T::*)(const QUuid &, const Arg &, const QMcpJSONRPCErrorError *) const> {
+        using type = Arg;
+    };
+
     template<typename T>
     struct CallbackArg : CallbackArg<decltype(&T::operator())> {};
 
@@ -138,11 +269,22 @@ public:
         Sends a request to a specific client session and handles the response with a callback.
 
         The callback will be invoked with the session ID and response result.
+        A callback taking a third \c{const QMcpJSONRPCErrorError *} argument
+        gets the error the client answered with, or an error with code
+        -32001 if the client did not answer within requestTimeout, or -32000
+        if the session closed or too many requests were waiting for it. The
+        argument is nullptr on success. A callback without it is called with
+        an empty result then.
 
         Example:
         \code
-        server->request(sessionId, QMcpInitializeRequest(), [](const QUuid &session, const QMcpInitializeResult &result) {
-            qDebug() << "Session" << session << "initialized with version:" << result.protocolVersion();
+        server->request(sessionId, QMcpListRootsRequest(), [](const QUuid &session, const QMcpListRootsResult &result,
+                                                             const QMcpJSONRPCErrorError *error) {
+            if (error) {
+                qDebug() << "Session" << session << "failed:" << error->message();
+                return;
+            }
+            qDebug() << "Session" << session << "roots:" << result.roots().size();
         });
         \endcode
 
@@ -152,6 +294,7 @@ public:
     */
     template<typename Request, typename Callback>
         requires std::invocable<Callback, const QUuid &, const CallbackResult<Callback>&>
+              || std::invocable<Callback, const QUuid &, const CallbackResult<Callback>&, const QMcpJSONRPCErrorError *>
     void request(const QUuid &session, const Request &request, Callback callback)
     {
         using Result = CallbackResult<Callback>;
@@ -161,12 +304,23 @@ public:
 
         QtMcp::ProtocolVersion versionToUse = this->versionToUse(session);
 
-        auto json = request.toJsonObject(versionToUse);
-        send(session, json, [callback, this, versionToUse](const QUuid & session, const QJsonObject &json) {
-            Result result;
-            result.fromJsonObject(json, versionToUse);
-            callback(session, result);
-        });
+        auto message = request;
+        if (message.id().isNull()) {
+            const int id = registerRequest(session, [callback, versionToUse](const QUuid &session, const QJsonObject &json, const QMcpJSONRPCErrorError *error) {
+                Result result;
+                if (!error)
+                    result.fromJsonObject(json, versionToUse);
+                if constexpr (std::is_invocable_v<Callback, const QUuid &, const Result &, const QMcpJSONRPCErrorError *>)
+                    callback(session, result, error);
+                else
+                    callback(session, result);
+            });
+            // the callback gets the error
+            if (id < 0)
+                return;
+            message.setId(id);
+        }
+        send(session, QMcpJsonWriter::encode(message, encodingToUse(session), versionToUse));
     }
 
     /*!
@@ -183,8 +337,14 @@ public:
 
         QtMcp::ProtocolVersion versionToUse = this->versionToUse(session);
 
-        auto json = request.toJsonObject(versionToUse);
-        send(session, json);
+        auto message = request;
+        if (message.id().isNull()) {
+            const int id = registerRequest(session);
+            if (id < 0)
+                return;
+            message.setId(id);
+        }
+        send(session, QMcpJsonWriter::encode(message, encodingToUse(session), versionToUse));
     }
 
     /*!
@@ -209,11 +369,25 @@ public:
 
         QtMcp::ProtocolVersion versionToUse = this->versionToUse(session, protocolVersion);
 
-        auto json = notification.toJsonObject(versionToUse);
-        send(session, json);
+        send(session, QMcpJsonWriter::encode(notification, encodingToUse(session), versionToUse));
     }
 
 
+    /*!
+        \internal
+        The state of the session a request is handled for, taken when the
+        request is dispatched, so handlers running on a worker thread do not
+        look up the session.
+    */
+    struct RequestContext {
+        QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest;
+        QtMcp::Encoding encoding = QtMcp::Encoding::Json;
+        // cancelled by notifications/cancelled
+        QMcpCancellationToken token;
+        // inactive unless the request has a progress token
+        QMcpProgressReporter progress;
+    };
+
     template <typename T> struct RequestHandlerTraits;
 
     // Helper to detect QFuture
@@ -229,15 +403,38 @@ public:
         using ResultType = std::decay_t<R>;
     };
 
+    /*!
+        Registers \a handler for the request type of its second argument.
+
+        The argument can also be a view such as QMcpCallToolRequestView,
+        which reads fields from the received message on demand instead of
+        parsing the whole request gadget first.
+
+        Unless requestExecution is Direct, \a handler runs on a worker thread
+        and must not touch the sessions or other objects of the server
+        thread. A returned QFuture is continued on the thread of the server.
+
+        When the client cancels the request, a returned QFuture is cancelled
+        and no response is sent. See QMcpCancellationToken.
+
+        QMcpProgressReporter::current() returns the reporter for the
+        progress of the request while \a handler runs.
+    */
     template <typename Handler>
     void addRequestHandler(Handler handler)
     {
         using Traits = RequestHandlerTraits<decltype(&Handler::operator())>;
         using Req = typename Traits::RequestType;
         using Result = typename Traits::ResultType;
+        constexpr bool isView = std::is_base_of<QMcpJsonView, Req>::value;
 
-        static_assert(std::is_base_of<QMcpRequest, Req>::value,
-                      "Request type must inherit from QMcpRequest");
+        if constexpr (isView) {
+            static_assert(std::is_base_of<QMcpRequest, typename Req::Gadget>::value,
+                          "View must be of a type inheriting from QMcpRequest");
+        } else {
+            static_assert(std::is_base_of<QMcpRequest, Req>::value,
+                          "Request type must inherit from QMcpRequest");
+        }
 
         if constexpr (is_future<Result>::value) {
             static_assert(std::is_base_of<QMcpResult, typename Result::value_type>::value,
@@ -247,38 +444,59 @@ public:
                           "Result type must inherit from QMcpResult");
         }
 
-        auto wrapper = [this, handler](const QUuid &session, const QJsonObject &json, QMcpJSONRPCErrorError *error) -> QJsonValue {
-            QtMcp::ProtocolVersion versionToUse = this->versionToUse(session);
+        // returns the serialized result, or nothing if the response is sent later
+        auto wrapper = [this, handler](const QUuid &session, const QJsonObject &json, const RequestContext &context, QMcpJSONRPCErrorError *error) -> QByteArray {
+            const QtMcp::ProtocolVersion versionToUse = context.protocolVersion;
 
-            Req req;
-            req.fromJsonObject(json, versionToUse);
+            auto req = [&]() {
+                if constexpr (isView) {
+                    return Req(json);
+                } else {
+                    Req request;
+                    request.fromJsonObject(json, versionToUse);
+                    return request;
+                }
+            }();
 
             if constexpr (is_future<Result>::value) {
                 // For async handlers
                 auto future = handler(session, req, error);
 
+                // the error is the response then
+                if (error->code() != 0)
+                    return QByteArray();
+
                 // Get the request ID from the JSON object
                 const auto id = json.value("id"_L1);
 
-                // Set up continuation to send response when ready
-                future.then([this, session, id, versionToUse](const auto &result) {
-                    QMcpJSONRPCResponse response;
-                    response.setId(id.toVariant());
-                    auto object = response.toJsonObject(versionToUse);
-                    object.insert("result"_L1, result.toJsonObject(versionToUse));
-                    send(session, object);
+                // cancelling the future lets a QPromise behind it stop early
+                context.token.onCancelled([future]() mutable { future.cancel(); });
+
+                // Set up continuation to send response when ready, on the
+                // thread of the server, unless the request was cancelled
+                const auto encoding = context.encoding;
+                const auto protocolVersion = context.protocolVersion;
+                future.then(this, [this, session, id, encoding, protocolVersion](const auto &result) {
+                    QMcpJsonWriter writer(encoding);
+                    writer.writeResponse(id, result, protocolVersion);
+                    finishRequest(session, id, writer.takeData());
+                }).onCanceled(this, [this, session, id]() {
+                    finishRequest(session, id);
                 });
 
                 // Return empty value since we'll send response later
-                return QJsonValue();
+                return QByteArray();
             } else {
                 // For sync handlers
                 auto res = handler(session, req, error);
-                return QJsonValue(res.toJsonObject(versionToUse));
+                return QMcpJsonWriter::encode(res, context.encoding, versionToUse);
             }
         };
 
-        registerRequestHandler(Req().method(), wrapper);
+        if constexpr (isView)
+            registerRequestHandler(typename Req::Gadget().method(), wrapper);
+        else
+            registerRequestHandler(Req().method(), wrapper);
     }
 
     template <typename T> struct NotificationHandlerTraits;
@@ -340,6 +558,54 @@ public:
     */
     bool isProtocolVersionSupported(QtMcp::ProtocolVersion version) const;
 
+    /*!
+        Returns whether the server offers the CBOR encoding.
+        \sa setCborEnabled()
+    */
+    bool isCborEnabled() const;
+
+    /*!
+        Returns whether the gadgets of a message are allocated from an arena.
+        \sa setGadgetArenaEnabled()
+    */
+    bool isGadgetArenaEnabled() const;
+
+    /*!
+        Returns where request handlers run.
+        \sa setRequestExecution()
+    */
+    RequestExecution requestExecution() const;
+
+    /*!
+        Returns the number of worker threads, 0 for the ideal thread count.
+        \sa setThreadPoolSize()
+    */
+    int threadPoolSize() const;
+
+    /*!
+        Returns how many requests may wait for a worker thread.
+        \sa setMaxQueuedRequests()
+    */
+    int maxQueuedRequests() const;
+
+    /*!
+        Returns the minimum interval between two progress notifications.
+        \sa setProgressInterval()
+    */
+    int progressInterval() const;
+
+    /*!
+        Returns how long the server waits for the response to a request.
+        \sa setRequestTimeout()
+    */
+    int requestTimeout() const;
+
+    /*!
+        Returns how long a session may be idle before it is closed.
+        \sa setSessionIdleTimeout()
+    */
+    int sessionIdleTimeout() const;
+
     /*!
         Returns a mapping of feature identifiers to their toolDescriptions.
         Can be overridden by derived classes to provide custom toolDescriptions.
@@ -381,6 +647,68 @@ public slots:
     */
     void setSupportedProtocolVersions(const QList<QtMcp::ProtocolVersion> &versions);
 
+    /*!
+        Sets whether the server offers the CBOR encoding to new sessions.
+        \param enabled Whether to offer the encoding
+        \sa isCborEnabled()
+    */
+    void setCborEnabled(bool enabled);
+
+    /*!
+        Sets whether the gadgets of the messages received from now on are
+        allocated from an arena.
+        \param enabled Whether to use an arena per message
+        \sa isGadgetArenaEnabled()
+    */
+    void setGadgetArenaEnabled(bool enabled);
+
+    /*!
+        Sets where request handlers run. Requests received before keep
+        running where they were started.
+        \param execution Where to run the handlers
+        \sa requestExecution()
+    */
+    void setRequestExecution(QMcpServer::RequestExecution execution);
+
+    /*!
+        Sets the number of worker threads. Waits for the running handlers
+        if the threads are started already.
+        \param size Number of threads, 0 for QThread::idealThreadCount()
+        \sa threadPoolSize()
+    */
+    void setThreadPoolSize(int size);
+
+    /*!
+        Sets how many requests may wait for a worker thread. Waits for the
+        running handlers if the threads are started already.
+        \param count Maximum number of waiting requests
+        \sa maxQueuedRequests()
+    */
+    void setMaxQueuedRequests(int count);
+
+    /*!
+        Sets the minimum interval between two progress notifications for one
+        request. Applies to the requests received from then on.
+        \param msecs Interval in milliseconds
+        \sa progressInterval()
+    */
+    void setProgressInterval(int msecs);
+
+    /*!
+        Sets how long the server waits for the response to a request. Applies
+        to the requests sent from then on.
+        \param msecs Timeout in milliseconds, 0 for none
+        \sa requestTimeout()
+    */
+    void setRequestTimeout(int msecs);
+
+    /*!
+        Sets how long a session may be idle before it is closed.
+        \param msecs Timeout in milliseconds, 0 for none
+        \sa sessionIdleTimeout()
+    */
+    void setSessionIdleTimeout(int msecs);
+
     /*!
         Starts the MCP server with the given arguments.
         \param args Command-line style arguments to pass to the backend (e.g., "--log-level=debug")
@@ -434,6 +762,54 @@ signals:
     */
     void supportedProtocolVersionsChanged(const QList<QtMcp::ProtocolVersion> &versions);
 
+    /*!
+        Emitted when offering the CBOR encoding is enabled or disabled.
+        \param enabled Whether the encoding is offered
+    */
+    void cborEnabledChanged(bool enabled);
+
+    /*!
+        Emitted when allocating gadgets from arenas is enabled or disabled.
+        \param enabled Whether an arena is used per message
+    */
+    void gadgetArenaEnabledChanged(bool enabled);
+
+    /*!
+        Emitted when the execution of request handlers changes.
+        \param execution Where the handlers run
+    */
+    void requestExecutionChanged(QMcpServer::RequestExecution execution);
+
+    /*!
+        Emitted when the number of worker threads changes.
+        \param size The new number of threads
+    */
+    void threadPoolSizeChanged(int size);
+
+    /*!
+        Emitted when the number of requests allowed to wait changes.
+        \param count The new maximum
+    */
+    void maxQueuedRequestsChanged(int count);
+
+    /*!
+        Emitted when the minimum interval between progress notifications changes.
+        \param msecs The new interval in milliseconds
+    */
+    void progressIntervalChanged(int msecs);
+
+    /*!
+        Emitted when the timeout of requests changes.
+        \param msecs The new timeout in milliseconds
+    */
+    void requestTimeoutChanged(int msecs);
+
+    /*!
+        Emitted when the idle timeout of sessions changes.
+        \param msecs The new timeout in milliseconds
+    */
+    void sessionIdleTimeoutChanged(int msecs);
+
     /*!
         Emitted when the server has successfully started.
     */
@@ -445,6 +821,14 @@ signals:
     */
     void newSession(QMcpServerSession *session);
 
+    /*!
+        Emitted when a client session is closed by the backend or for being
+        idle. The requests of the session still running are cancelled, and
+        \a session is deleted once control returns to the event loop.
+        \param session The closed session object
+    */
+    void sessionClosed(QMcpServerSession *session);
+
     /*!
         Emitted when a raw JSON message is received from a client.
         \param session UUID of the client session
@@ -473,10 +857,32 @@ private:
     */
     QtMcp::ProtocolVersion versionToUse(const QUuid &session,
                                         QtMcp::ProtocolVersion defaultVersion = QtMcp::ProtocolVersion::Latest) const;
+
+    /*!
+        \internal
+        Returns the encoding negotiated with the client of \a session,
+        QtMcp::Encoding::Json if it is not known.
+    */
+    QtMcp::Encoding encodingToUse(const QUuid &session) const;
     
     void notifyResourceUpdated(const QUuid &session, const QMcpResource &resource);
-    void send(const QUuid &session, const QJsonObject &message, std::function<void(const QUuid &session, const QJsonObject &)> callback = nullptr);
-    void registerRequestHandler(const QString &method, std::function<QJsonValue(const QUuid &, const QJsonObject &, QMcpJSONRPCErrorError *)>);
+    // called with the result, or with the error if error is not nullptr
+    using ResponseCallback = std::function<void(const QUuid &session, const QJsonObject &result, const QMcpJSONRPCErrorError *error)>;
+    void send(const QUuid &session, const QJsonObject &message, ResponseCallback callback = nullptr);
+    void send(const QUuid &session, QByteArray message);
+    // returns the ID of the next request to session, or -1 if too many
+    // requests wait for it already
+    int registerRequest(const QUuid &session, ResponseCallback callback = nullptr);
+    void registerRequestHandler(const QString &method, std::function<QByteArray(const QUuid &, const QJsonObject &, const RequestContext &, QMcpJSONRPCErrorError *)>);
+    /*!
+        \internal
+        Stops tracking the request \a id of \a session, sends its last
+        progress and then its \a response, with the other responses if the
+        request came in a batch. An empty \a response leaves the request
+        unanswered. Returns false if the request was cancelled, then no
+        response is sent.
+    */
+    bool finishRequest(const QUuid &session, const QJsonValue &id, QByteArray response = QByteArray());
     void registerNotificationHandler(const QString &method, std::function<void(const QUuid &, const QJsonObject &)>);
 
 private:
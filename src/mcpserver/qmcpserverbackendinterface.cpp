@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpserverbackendinterface.h"
+#include <QtMcpCommon/qmcpjsonwriter.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -38,4 +39,45 @@ void QMcpServerBackendInterface::request(const QUuid &session, const QJsonObject
     }
 }
 
+QMcpServerBackendInterfaceV2::QMcpServerBackendInterfaceV2(QObject *parent)
+    : QMcpServerBackendInterface(parent)
+{
+    connect(this, &QMcpServerBackendInterfaceV2::sessionClosed, this, [this](const QUuid &session) {
+        callbacks.remove(session);
+    });
+}
+
+void QMcpServerBackendInterfaceV2::writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&message)
+{
+    Q_UNUSED(ids);
+    if (!message.isEmpty())
+        writeMessage(session, std::move(message));
+}
+
+bool QMcpServerBackendInterfaceV2::supportsCbor() const
+{
+    return false;
+}
+
+bool QMcpServerBackendInterfaceV2::canNotify(const QUuid &session) const
+{
+    Q_UNUSED(session);
+    return true;
+}
+
+void QMcpServerBackendInterfaceV2::send(const QUuid &session, const QJsonObject &object)
+{
+    writeMessage(session, QMcpJsonWriter::toJson(object));
+}
+
+void QMcpServerBackendInterfaceV2::notify(const QUuid &session, const QJsonObject &object)
+{
+    writeMessage(session, QMcpJsonWriter::toJson(object));
+}
+
+void QMcpServerBackendInterfaceV2::closeSession(const QUuid &session)
+{
+    emit sessionClosed(session);
+}
+
 QT_END_NAMESPACE
@@ -106,9 +106,131 @@ signals:
     void result(const QUuid &session, const QJsonObject &result);
 
 private:
+    friend class QMcpServerBackendInterfaceV2;
     QHash<QUuid, QHash<QJsonValue, std::function<void(const QJsonObject &)>>> callbacks;
 };
 
+/*!
+    \class QMcpServerBackendInterfaceV2
+    \inmodule QtMcpServer
+    \brief The QMcpServerBackendInterfaceV2 class is the interface for MCP server backends exchanging raw messages.
+
+    A backend implementing this interface does not parse or serialize
+    messages. It emits messageReceived() with the bytes of every complete
+    message it reads, JSON text or CBOR, and QMcpServer parses them. In the
+    other direction QMcpServer hands the already serialized messages to
+    writeMessage(), moving the buffer so the backend can queue it without a
+    copy.
+
+    The QJsonObject based slots of QMcpServerBackendInterface are
+    implemented on top of writeMessage(), and received() and result() are
+    not emitted. Backends implementing only QMcpServerBackendInterface keep
+    working; QMcpServer talks to them through the QJsonObject API.
+
+    QMcpServerBackendInterface is frozen so that backend plugins built
+    against it keep loading; everything added since is declared here.
+    Backends of this interface also tell when a session ends, with
+    sessionClosed().
+*/
+class Q_MCPSERVER_EXPORT QMcpServerBackendInterfaceV2 : public QMcpServerBackendInterface
+{
+    Q_OBJECT
+public:
+    /*!
+        Constructs a server backend interface with the given parent.
+        \param parent The parent object
+    */
+    explicit QMcpServerBackendInterfaceV2(QObject *parent = nullptr);
+
+    /*!
+        Writes the complete message \a message to the client of \a session.
+        Must be implemented by backend classes.
+
+        The message is compact JSON text without a trailing newline, or CBOR
+        if the session negotiated it, which QMcpCbor::isCbor() tells. The
+        backend takes over \a message and adds whatever framing its
+        transport needs.
+    */
+    virtual void writeMessage(const QUuid &session, QByteArray &&message) = 0;
+
+    /*!
+        Writes the response \a message to the requests \a ids of
+        \a session, like writeMessage(). The response to a batch comes
+        with the IDs of all requests of the batch, including those it
+        leaves out because they were cancelled.
+
+        Backends answering every request on a channel of its own, such as
+        the POST of streamable HTTP, find it by \a ids without parsing
+        \a message. Notifications and requests of the server are written
+        with writeMessage().
+
+        An empty \a message tells that the requests are not answered,
+        because they were cancelled; backends release what waits for their
+        response.
+
+        The default implementation calls writeMessage() unless \a message
+        is empty.
+
+        \param session UUID of the client session
+        \param ids JSON-RPC IDs of the requests answered
+        \param message The serialized response
+    */
+    virtual void writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&message);
+
+    /*!
+        Returns \c true if the backend can carry messages encoded as CBOR in
+        both directions. The server only offers the CBOR encoding to clients
+        of such backends, see QMcpCbor.
+
+        The default implementation returns \c false.
+    */
+    virtual bool supportsCbor() const;
+
+    /*!
+        Returns \c true if the backend can send messages to \a session that
+        do not answer one of its requests, such as notifications or requests
+        of the server. The server does not report the progress of requests
+        to sessions it returns \c false for.
+
+        The default implementation returns \c true.
+
+        \param session UUID of the client session
+    */
+    virtual bool canNotify(const QUuid &session) const;
+
+public slots:
+    void send(const QUuid &session, const QJsonObject &object) final;
+    void notify(const QUuid &session, const QJsonObject &object) final;
+
+    /*!
+        Closes \a session, called by the server when the session was idle
+        for too long. The backend forgets the session and emits
+        sessionClosed().
+
+        The default implementation only emits sessionClosed(); backends
+        keeping state per session should override it.
+
+        \param session UUID of the client session
+    */
+    virtual void closeSession(const QUuid &session);
+
+signals:
+    /*!
+        Emitted when a client session has ended, because the client closed
+        it or its connection, or after closeSession(). The server releases
+        everything it keeps for the session.
+        \param session UUID of the closed client session
+    */
+    void sessionClosed(const QUuid &session);
+
+    /*!
+        Emitted when a complete message was read from the client of
+        \a session. \a message holds the JSON text or CBOR of exactly one
+        message, without framing.
+    */
+    void messageReceived(const QUuid &session, const QByteArray &message);
+};
+
 QT_END_NAMESPACE
 
 #endif // QMCPSERVERBACKENDINTERFACE_H
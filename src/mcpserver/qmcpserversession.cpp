@@ -2,15 +2,19 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpserversession.h"
+#include "qmcpregistry_p.h"
 #include "qmcpserver.h"
 #include <QtCore/QMultiHash>
-#include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
 #ifdef QT_GUI_LIB
 #include <QtGui/QAction>
 #endif
 #include <QtMcpCommon/QMcpCreateMessageRequest>
 
+#include <algorithm>
+#include <array>
+#include <utility>
+
 QT_BEGIN_NAMESPACE
 
 class QMcpServerSession::Private
@@ -18,6 +22,10 @@ class QMcpServerSession::Private
 public:
     Private(const QUuid &id, QMcpServerSession *parent);
 
+    // where to look things up, the registry of the session first
+    std::array<const QMcpRegistry *, 2> layers() const { return { &overlay, registry.get() }; }
+    const QMcpRegistry::Tool *findTool(const QString &name) const;
+
 private:
     QMcpServerSession *q;
 
@@ -25,25 +33,15 @@ public:
     QUuid sessionId;
     bool initialized = false;
     QtMcp::ProtocolVersion protocolVersion = QtMcp::ProtocolVersion::Latest; // Default to latest version
+    QtMcp::Encoding encoding = QtMcp::Encoding::Json;
     QList<QMcpResourceTemplate> resourceTemplates;
     QList<QPair<QMcpResource, QMcpReadResourceResultContents>> resources;
     QList<QPair<QMcpPrompt, QMcpPromptMessage>> prompts;
-    QList<QPair<QMcpTool, QObject *>> tools;
-#ifdef QT_GUI_LIB
-    QList<QPair<QMcpTool, QAction *>> actions;
-#endif
-    QList<QPair<QMcpTool, QMcpServerSession::DynamicToolHandler>> dynamicTools;  // NEW: Runtime-registered tools
-
-    // Dynamic resources storage
-    struct DynamicResourceEntry {
-        QMcpResource resource;               // or QMcpResourceTemplate
-        bool isTemplate;
-        QMcpServerSession::DynamicResourceHandler handler;
-    };
-    QHash<QString, DynamicResourceEntry> dynamicResources;  // Key by URI/template string
-
-    // Dynamic prompts storage
-    QList<QPair<QMcpPrompt, QMcpServerSession::DynamicPromptHandler>> dynamicPrompts;
+    // tools, dynamic resources and dynamic prompts registered with the
+    // server, shared with its other sessions
+    std::shared_ptr<const QMcpRegistry> registry;
+    // those registered with this session only
+    QMcpRegistry overlay;
 
     QList<QMcpRoot> roots;
     QMultiHash<QUrl, QUrl> subscriptions;
@@ -70,6 +68,17 @@ QMcpServerSession::Private::Private(const QUuid &id, QMcpServerSession *parent)
     connect(&notifyToolListChanged, &QTimer::timeout, q, &QMcpServerSession::toolListChanged);
 }
 
+const QMcpRegistry::Tool *QMcpServerSession::Private::findTool(const QString &name) const
+{
+    for (const auto *layer : layers()) {
+        if (!layer)
+            continue;
+        if (const auto *tool = layer->tool(name))
+            return tool;
+    }
+    return nullptr;
+}
+
 QMcpServerSession::QMcpServerSession(const QUuid &sessionId, QMcpServer *parent)
     : QObject(parent)
     , d(new Private(sessionId, this))
@@ -104,6 +113,16 @@ void QMcpServerSession::setProtocolVersion(const QString &protocolVersionStr)
     setProtocolVersion(version);
 }
 
+QtMcp::Encoding QMcpServerSession::encoding() const
+{
+    return d->encoding;
+}
+
+void QMcpServerSession::setEncoding(QtMcp::Encoding encoding)
+{
+    d->encoding = encoding;
+}
+
 bool QMcpServerSession::isInitialized() const
 {
     return d->initialized;
@@ -186,14 +205,21 @@ QList<QMcpResourceTemplate> QMcpServerSession::resourceTemplates() const
 {
     QList<QMcpResourceTemplate> ret = d->resourceTemplates;
 
-    // Add dynamic resource templates
-    for (auto it = d->dynamicResources.constBegin(); it != d->dynamicResources.constEnd(); ++it) {
-        if (it.value().isTemplate) {
+    // Add dynamic resource templates, the shared ones first unless the
+    // session has its own
+    for (const auto *layer : { d->registry.get(), static_cast<const QMcpRegistry *>(&d->overlay) }) {
+        if (!layer)
+            continue;
+        for (const auto &entry : layer->resources()) {
+            if (!entry.isTemplate)
+                continue;
+            if (layer != &d->overlay && d->overlay.resource(entry.key))
+                continue;
             QMcpResourceTemplate tmpl;
-            tmpl.setName(it.value().resource.name());
-            tmpl.setDescription(it.value().resource.description());
-            tmpl.setUriTemplate(it.key());
-            tmpl.setMimeType(it.value().resource.mimeType());
+            tmpl.setName(entry.resource.name());
+            tmpl.setDescription(entry.resource.description());
+            tmpl.setUriTemplate(entry.key);
+            tmpl.setMimeType(entry.resource.mimeType());
             ret.append(tmpl);
         }
     }
@@ -208,16 +234,24 @@ QList<QMcpResource> QMcpServerSession::resources(QString *cursor) const
 
     // Collect all resources first (static + dynamic)
     QList<QMcpResource> allResources;
-    allResources.reserve(d->resources.count() + d->dynamicResources.count());
+    allResources.reserve(d->resources.count() + d->overlay.resources().count()
+                         + (d->registry ? d->registry->resources().count() : 0));
 
     // Add static resources
     for (const auto &pair : std::as_const(d->resources))
         allResources.append(pair.first);
 
-    // Add dynamic resources (non-templates only)
-    for (auto it = d->dynamicResources.constBegin(); it != d->dynamicResources.constEnd(); ++it) {
-        if (!it.value().isTemplate) {
-            allResources.append(it.value().resource);
+    // Add dynamic resources (non-templates only), the shared ones first
+    // unless the session has its own
+    for (const auto *layer : { d->registry.get(), static_cast<const QMcpRegistry *>(&d->overlay) }) {
+        if (!layer)
+            continue;
+        for (const auto &entry : layer->resources()) {
+            if (entry.isTemplate)
+                continue;
+            if (layer != &d->overlay && d->overlay.resource(entry.key))
+                continue;
+            allResources.append(entry.resource);
         }
     }
 
@@ -249,82 +283,32 @@ QList<QMcpReadResourceResultContents> QMcpServerSession::contents(const QUrl &ur
     qDebug() << Q_FUNC_INFO << __LINE__ << uri;
     QList<QMcpReadResourceResultContents> ret;
 
-    // Check dynamic handlers FIRST (templates and exact matches)
-    QString uriString = uri.toString();
-    qDebug() << "[QMcpServerSession] Looking up URI:" << uriString;
-    qDebug() << "[QMcpServerSession] Dynamic resources count:" << d->dynamicResources.size();
-
-    // First check for exact match in dynamic resources
-    if (d->dynamicResources.contains(uriString)) {
-        qDebug() << "[QMcpServerSession] Found exact match for:" << uriString;
-        const auto &entry = d->dynamicResources[uriString];
-        if (!entry.isTemplate && entry.handler) {
-            ret.append(entry.handler(uri));
+    // Check dynamic handlers FIRST (exact matches, then templates); the
+    // handler is copied as it may change the registries
+    const QString uriString = uri.toString();
+    for (const auto *layer : d->layers()) {
+        if (!layer)
+            continue;
+        const auto *entry = layer->resource(uriString);
+        if (entry && !entry->isTemplate && entry->handler) {
+            const auto handler = entry->handler;
+            ret.append(handler(uri));
             return ret;
         }
     }
 
-    qDebug() << "[QMcpServerSession] No exact match, checking templates...";
-    // Then check for URI template matches (simple pattern matching for now)
-    // Full RFC 6570 implementation would be more complex
-    for (auto it = d->dynamicResources.constBegin(); it != d->dynamicResources.constEnd(); ++it) {
-        if (it.value().isTemplate) {
-            QString template_ = it.key();
-            qDebug() << "[QMcpServerSession] Checking template:" << template_ << "against URI:" << uriString;
-
-            // Build regex pattern by manually processing the template
-            QString pattern;
-            int pos = 0;
-            QRegularExpression varRegex("\\{[^}]+\\}");
-            QRegularExpressionMatchIterator matchIt = varRegex.globalMatch(template_);
-
-            // Helper lambda to escape regex special characters
-            auto escapeRegex = [](const QString &str) {
-                QString result = str;
-                result.replace("\\", "\\\\");
-                result.replace(".", "\\.");
-                result.replace("^", "\\^");
-                result.replace("$", "\\$");
-                result.replace("*", "\\*");
-                result.replace("+", "\\+");
-                result.replace("?", "\\?");
-                result.replace("{", "\\{");
-                result.replace("}", "\\}");
-                result.replace("[", "\\[");
-                result.replace("]", "\\]");
-                result.replace("|", "\\|");
-                result.replace("(", "\\(");
-                result.replace(")", "\\)");
-                return result;
-            };
-
-            while (matchIt.hasNext()) {
-                QRegularExpressionMatch match = matchIt.next();
-                // Add escaped literal part before this variable
-                pattern += escapeRegex(template_.mid(pos, match.capturedStart() - pos));
-                // Add regex pattern for the variable
-                pattern += "([^/]+)";
-                pos = match.capturedEnd();
-            }
-
-            // Add any remaining literal part
-            if (pos < template_.length()) {
-                pattern += escapeRegex(template_.mid(pos));
-            }
-
-            // Add anchors
-            pattern = "^" + pattern + "$";
-            qDebug() << "[QMcpServerSession] Generated pattern:" << pattern;
-
-            QRegularExpression regex(pattern);
-            auto match = regex.match(uriString);
-            qDebug() << "[QMcpServerSession] Match result:" << match.hasMatch();
-            if (match.hasMatch()) {
-                if (it.value().handler) {
-                    qDebug() << "[QMcpServerSession] Calling handler for template:" << template_;
-                    ret.append(it.value().handler(uri));
-                    return ret;
-                }
+    // The patterns of the templates are compiled when they are registered
+    for (const auto *layer : d->layers()) {
+        if (!layer)
+            continue;
+        for (const auto &entry : layer->resources()) {
+            if (!entry.isTemplate || !entry.handler)
+                continue;
+            if (entry.pattern.match(uriString).hasMatch()) {
+                qDebug() << "[QMcpServerSession] Calling handler for template:" << entry.key;
+                const auto handler = entry.handler;
+                ret.append(handler(uri));
+                return ret;
             }
         }
     }
@@ -369,15 +353,23 @@ QList<QMcpPrompt> QMcpServerSession::prompts(QString *cursor) const
 
     // Collect all prompts first (static + dynamic)
     QList<QMcpPrompt> allPrompts;
-    allPrompts.reserve(d->prompts.count() + d->dynamicPrompts.count());
+    allPrompts.reserve(d->prompts.count() + d->overlay.prompts().count()
+                       + (d->registry ? d->registry->prompts().count() : 0));
 
     // Add static prompts
     for (const auto &pair : std::as_const(d->prompts))
         allPrompts.append(pair.first);
 
-    // Add dynamic prompts
-    for (const auto &pair : std::as_const(d->dynamicPrompts))
-        allPrompts.append(pair.first);
+    // Add dynamic prompts, the shared ones first unless the session has its own
+    for (const auto *layer : { d->registry.get(), static_cast<const QMcpRegistry *>(&d->overlay) }) {
+        if (!layer)
+            continue;
+        for (const auto &entry : layer->prompts()) {
+            if (layer != &d->overlay && d->overlay.prompt(entry.prompt.name()))
+                continue;
+            allPrompts.append(entry.prompt);
+        }
+    }
 
     // Start from the cursor position if provided
     int startIndex = cursor && !cursor->isEmpty() ? cursor->toInt() : 0;
@@ -407,10 +399,13 @@ QList<QMcpPromptMessage> QMcpServerSession::messages(const QString &name, const
     QList<QMcpPromptMessage> ret;
 
     // Check dynamic prompts FIRST (they need arguments)
-    for (const auto &pair : std::as_const(d->dynamicPrompts)) {
-        if (pair.first.name() == name) {
-            if (pair.second) {
-                ret = pair.second(name, arguments);
+    for (const auto *layer : d->layers()) {
+        if (!layer)
+            continue;
+        if (const auto *entry = layer->prompt(name)) {
+            if (entry->handler) {
+                const auto handler = entry->handler;
+                ret = handler(name, arguments);
                 return ret;
             }
         }
@@ -425,73 +420,18 @@ QList<QMcpPromptMessage> QMcpServerSession::messages(const QString &name, const
 
 void QMcpServerSession::registerToolSet(QObject *toolSet, const QHash<QString, QString> &descriptions)
 {
-    const auto *mo = toolSet->metaObject();
-
-    QString prefix = toolSet->objectName();
-    if (!prefix.isEmpty())
-        prefix.append('/'_L1);
-
-    bool changed = false;
-    for (int i = mo->methodOffset(); i < mo->methodCount(); i++) {
-        const auto mm = mo->method(i);
-        if (mm.access() != QMetaMethod::Public)
-            continue;
-        if (mm.methodType() == QMetaMethod::Signal || mm.methodType() == QMetaMethod::Constructor)
-            continue;
-        QMcpTool tool;
-        const auto name = QString::fromUtf8(mm.name());
-        tool.setName(prefix + name);
-        if (descriptions.contains(name)) {
-            tool.setDescription(descriptions.value(name));
-        }
-        QMcpToolInputSchema inputSchema;
-        auto required = inputSchema.required();
-        auto properties = inputSchema.properties();
-        const auto types = mm.parameterTypes();
-        const auto names = mm.parameterNames();
-        for (int j = 0; j < mm.parameterCount(); j++) {
-            const auto type = QString::fromUtf8(types.at(j));
-            const auto name = QString::fromUtf8(names.at(j));
-            // message
-            QHash<QString, QString> mcpTypes {
-                                             { "QString", "string" },
-                                             { "bool", "bool" },
-                                             { "int", "number" },
-                                             };
-            QSet<QString> internalTypes { "QUuid"_L1 };
-            QJsonObject object;
-            if (mcpTypes.contains(type))
-                object.insert("type"_L1, mcpTypes.value(type));
-            else if (internalTypes.contains(type))
-                continue;
-            else
-                qWarning() << "Unknown type" << type;
-
-            if (descriptions.contains("%1/%2"_L1.arg(tool.name(), name))) {
-                object.insert("description"_L1, descriptions.value("%1/%2"_L1.arg(tool.name(), name)));
-            }
-            properties.insert(name, object);
-            required.append(name);
-        }
-        inputSchema.setProperties(properties);
-        inputSchema.setRequired(required);
-        tool.setInputSchema(inputSchema);
-        d->tools.append(std::make_pair(tool, toolSet));
-        changed = true;
-    }
-    if (changed)
-        d->notifyToolListChanged.start();
+    auto tools = QMcpRegistry::toolSetTools(toolSet, descriptions);
+    if (tools.isEmpty())
+        return;
+    d->overlay.addTools(std::move(tools));
+    d->notifyToolListChanged.start();
 }
 
 void QMcpServerSession::unregisterToolSet(const QObject *toolSet)
 {
-    bool changed = false;
-    for (int i = d->tools.length() - 1; i >= 0; i--) {
-        if (d->tools.at(i).second == toolSet) {
-            d->tools.removeAt(i);
-            changed = true;
-        }
-    }
+    const auto changed = d->overlay.removeTools([toolSet](const QMcpRegistry::Tool &tool) {
+        return tool.kind == QMcpRegistry::Tool::Method && tool.object == toolSet;
+    });
     if (changed)
         d->notifyToolListChanged.start();
 }
@@ -499,40 +439,36 @@ void QMcpServerSession::unregisterToolSet(const QObject *toolSet)
 #ifdef QT_GUI_LIB
 void QMcpServerSession::registerTool(QAction *action, const QString &name)
 {
-    QMcpTool tool;
-    tool.setName(name);
-    tool.setDescription(action->toolTip());
-    d->actions.append(std::make_pair(tool, action));
+    QMcpRegistry::Tool tool;
+    tool.tool.setName(name);
+    tool.tool.setDescription(action->toolTip());
+    tool.kind = QMcpRegistry::Tool::Action;
+    tool.object = action;
+    d->overlay.addTool(std::move(tool));
     d->notifyToolListChanged.start();
 }
 
 void QMcpServerSession::unregisterTool(const QAction *action)
 {
-    for (int i = d->actions.length() - 1; i >= 0; i--) {
-        if (d->actions.at(i).second == action) {
-            d->actions.removeAt(i);
-            d->notifyToolListChanged.start();
-            return;
-        }
-    }
+    const auto changed = d->overlay.removeTools([action](const QMcpRegistry::Tool &tool) {
+        return tool.kind == QMcpRegistry::Tool::Action && tool.object == action;
+    });
+    if (changed)
+        d->notifyToolListChanged.start();
 }
 #endif
 
 void QMcpServerSession::registerDynamicTool(const QMcpTool &tool, DynamicToolHandler handler)
 {
-    d->dynamicTools.append(std::make_pair(tool, handler));
+    d->overlay.addTool(QMcpRegistry::dynamicTool(tool, std::move(handler)));
     d->notifyToolListChanged.start();
 }
 
 void QMcpServerSession::unregisterDynamicTool(const QString &name)
 {
-    bool changed = false;
-    for (int i = d->dynamicTools.length() - 1; i >= 0; i--) {
-        if (d->dynamicTools.at(i).first.name() == name) {
-            d->dynamicTools.removeAt(i);
-            changed = true;
-        }
-    }
+    const auto changed = d->overlay.removeTools([&name](const QMcpRegistry::Tool &tool) {
+        return tool.kind == QMcpRegistry::Tool::Dynamic && tool.tool.name() == name;
+    });
     if (changed)
         d->notifyToolListChanged.start();
 }
@@ -540,67 +476,47 @@ void QMcpServerSession::unregisterDynamicTool(const QString &name)
 void QMcpServerSession::registerDynamicResourceTemplate(const QMcpResourceTemplate &resourceTemplate,
                                                          DynamicResourceHandler handler)
 {
-    QString templateUri = resourceTemplate.uriTemplate();
-    qDebug() << "[QMcpServerSession] Registering template, uriTemplate:" << templateUri;
-
-    Private::DynamicResourceEntry entry;
-    entry.resource.setName(resourceTemplate.name());
-    entry.resource.setDescription(resourceTemplate.description());
-    // DON'T convert template to QUrl - it will encode {id} as %7Bid%7D
-    // Just store the template string as-is
-    entry.resource.setUri(QUrl::fromEncoded(templateUri.toUtf8()));
-    entry.resource.setMimeType(resourceTemplate.mimeType());
-    entry.isTemplate = true;
-    entry.handler = handler;
-
-    qDebug() << "[QMcpServerSession] Storing with key:" << templateUri;
-    qDebug() << "[QMcpServerSession] Current dynamicResources keys before insert:";
-    for (auto it = d->dynamicResources.constBegin(); it != d->dynamicResources.constEnd(); ++it) {
-        qDebug() << "  -" << it.key();
-    }
-    d->dynamicResources[templateUri] = entry;
-    qDebug() << "[QMcpServerSession] After insert, key in map:" << (d->dynamicResources.contains(templateUri) ? "YES" : "NO");
-    qDebug() << "[QMcpServerSession] Keys after insert:";
-    for (auto it = d->dynamicResources.constBegin(); it != d->dynamicResources.constEnd(); ++it) {
-        qDebug() << "  -" << it.key();
-    }
+    qDebug() << "[QMcpServerSession] Registering template, uriTemplate:" << resourceTemplate.uriTemplate();
+    d->overlay.addResource(QMcpRegistry::dynamicResourceTemplate(resourceTemplate, std::move(handler)));
     d->notifyResourceListChanged.start();
 }
 
 void QMcpServerSession::registerDynamicResource(const QMcpResource &resource,
                                                  DynamicResourceHandler handler)
 {
-    Private::DynamicResourceEntry entry;
-    entry.resource = resource;
-    entry.isTemplate = false;
-    entry.handler = handler;
-
-    d->dynamicResources[resource.uri().toString()] = entry;
+    d->overlay.addResource(QMcpRegistry::dynamicResource(resource, std::move(handler)));
     d->notifyResourceListChanged.start();
 }
 
 void QMcpServerSession::unregisterDynamicResource(const QUrl &uri)
 {
-    if (d->dynamicResources.remove(uri.toString()) > 0)
+    if (d->overlay.removeResource(uri.toString()))
         d->notifyResourceListChanged.start();
 }
 
 void QMcpServerSession::registerDynamicPrompt(const QMcpPrompt &prompt, DynamicPromptHandler handler)
 {
-    d->dynamicPrompts.append(std::make_pair(prompt, handler));
+    d->overlay.addPrompt({ prompt, std::move(handler) });
     d->notifyPromptListChanged.start();
 }
 
 void QMcpServerSession::unregisterDynamicPrompt(const QString &name)
 {
-    bool changed = false;
-    for (int i = d->dynamicPrompts.length() - 1; i >= 0; i--) {
-        if (d->dynamicPrompts.at(i).first.name() == name) {
-            d->dynamicPrompts.removeAt(i);
-            changed = true;
-        }
-    }
-    if (changed)
+    if (d->overlay.removePrompts(name))
+        d->notifyPromptListChanged.start();
+}
+
+void QMcpServerSession::setRegistry(const std::shared_ptr<const QMcpRegistry> &registry)
+{
+    const auto previous = std::exchange(d->registry, registry);
+    // the lists of a new session have not been sent yet
+    if (!previous || !registry)
+        return;
+    if (previous->toolsRevision() != registry->toolsRevision())
+        d->notifyToolListChanged.start();
+    if (previous->resourcesRevision() != registry->resourcesRevision())
+        d->notifyResourceListChanged.start();
+    if (previous->promptsRevision() != registry->promptsRevision())
         d->notifyPromptListChanged.start();
 }
 
@@ -647,56 +563,79 @@ T callMethod(QObject *object, const QMetaMethod *method, const QVariantList &arg
 QList<QMcpTool> QMcpServerSession::tools(QString *cursor) const
 {
     Q_UNUSED(cursor);
-    QList<QMcpTool> ret;
-    // Add static tools (Q_INVOKABLE)
-    for (const auto &pair : std::as_const(d->tools))
-        ret.append(pair.first);
-#ifdef QT_GUI_LIB
-    for (const auto &pair : std::as_const(d->actions))
-        ret.append(pair.first);
-#endif
-    // Add dynamic tools (runtime-registered)
-    for (const auto &pair : std::as_const(d->dynamicTools))
-        ret.append(pair.first);
-    std::sort(ret.begin(), ret.end(), [](const QMcpTool &tool1, const QMcpTool &tool2) {
-        return tool1.name() < tool2.name();
-    });
+    // both lists are sorted already, and the shared one is not copied
+    // unless the session has tools of its own
+    if (d->overlay.toolList().isEmpty())
+        return d->registry ? d->registry->toolList() : QList<QMcpTool>();
+    QList<QMcpTool> ret = d->overlay.toolList();
+    if (d->registry) {
+        const auto middle = ret.size();
+        for (const auto &tool : d->registry->toolList()) {
+            if (!d->overlay.tool(tool.name()))
+                ret.append(tool);
+        }
+        std::inplace_merge(ret.begin(), ret.begin() + middle, ret.end(), [](const QMcpTool &tool1, const QMcpTool &tool2) {
+            return tool1.name() < tool2.name();
+        });
+    }
     return ret;
 }
 
-QList<QMcpCallToolResultContent> QMcpServerSession::callTool(const QString &name, const QJsonObject &params, bool *ok)
+bool QMcpServerSession::validateToolArguments(const QString &name, const QJsonObject &params, QString *errorMessage) const
+{
+    const auto *tool = d->findTool(name);
+    if (!tool)
+        return true;
+    return tool->validator.validate(params, errorMessage);
+}
+
+QMcpServerSession::DynamicToolHandler QMcpServerSession::dynamicToolHandler(const QString &name) const
+{
+    const auto *tool = d->findTool(name);
+    if (tool && tool->kind == QMcpRegistry::Tool::Dynamic)
+        return tool->handler;
+    return {};
+}
+
+QList<QMcpCallToolResultContent> QMcpServerSession::callTool(const QString &name, const QJsonObject &params, bool *ok, QString *errorMessage)
 {
     bool found = false;
     QList<QMcpCallToolResultContent> ret;
 
-    // Check dynamic tools FIRST (runtime-registered with handlers)
-    for (const auto &pair : std::as_const(d->dynamicTools)) {
-        const auto &tool = pair.first;
-        const auto &handler = pair.second;
-
-        if (tool.name() == name) {
-            // Call the dynamic handler
-            ret = handler(params);
-            found = true;
-            if (ok)
-                *ok = true;
-            return ret;
-        }
+    // Reject invalid parameters before converting them or calling a handler
+    QString message;
+    if (!validateToolArguments(name, params, &message)) {
+        qWarning() << name << message;
+        if (ok)
+            *ok = false;
+        if (errorMessage)
+            *errorMessage = message;
+        return ret;
     }
 
-    // Then check static tools (Q_INVOKABLE methods)
-    for (const auto &pair : std::as_const(d->tools)) {
-        const auto tool = pair.first;
-        // check name first
-        if (tool.name() != name)
-            continue;
+    // One hashed lookup, copied as the tool may change the registries
+    QMcpRegistry::Tool tool;
+    if (const auto *entry = d->findTool(name))
+        tool = *entry;
+
+    // Dynamic tools come first (runtime-registered with handlers)
+    if (tool.kind == QMcpRegistry::Tool::Dynamic && tool.handler) {
+        ret = tool.handler(params);
+        found = true;
+        if (ok)
+            *ok = true;
+        return ret;
+    }
 
-        QString prefix = pair.second->objectName();
+    // Then static tools (Q_INVOKABLE methods)
+    if (tool.kind == QMcpRegistry::Tool::Method && tool.object) {
+        QObject *toolSet = tool.object;
+        QString prefix = toolSet->objectName();
         if (!prefix.isEmpty())
             prefix.append('/'_L1);
 
         // check params next
-        const auto *mo = pair.second->metaObject();
+        const auto *mo = toolSet->metaObject();
         for (int i = mo->methodOffset(); i < mo->methodCount(); i++) {
             const auto mm = mo->method(i);
             if (prefix + QString::fromUtf8(mm.name()) != name)
@@ -760,25 +699,25 @@ QList<QMcpCallToolResultContent> QMcpServerSession::callTool(const QString &name
             case QMetaType::Void: {
                 switch (mm.parameterCount()) {
                 case 0:
-                    mm.invoke(pair.second,
+                    mm.invoke(toolSet,
                               Qt::DirectConnection
                               );
                     break;
                 case 1:
-                    mm.invoke(pair.second,
+                    mm.invoke(toolSet,
                               Qt::DirectConnection,
                               QGenericArgument(convertedArgs[0].typeName(), convertedArgs[0].constData())
                               );
                     break;
                 case 2:
-                    mm.invoke(pair.second,
+                    mm.invoke(toolSet,
                               Qt::DirectConnection,
                               QGenericArgument(convertedArgs[0].typeName(), convertedArgs[0].constData()),
                               QGenericArgument(convertedArgs[1].typeName(), convertedArgs[1].constData())
                               );
                     break;
                 case 3:
-                    mm.invoke(pair.second,
+                    mm.invoke(toolSet,
                               Qt::DirectConnection,
                               QGenericArgument(convertedArgs[0].typeName(), convertedArgs[0].constData()),
                               QGenericArgument(convertedArgs[1].typeName(), convertedArgs[1].constData()),
@@ -792,24 +731,24 @@ QList<QMcpCallToolResultContent> QMcpServerSession::callTool(const QString &name
                 break; }
             case QMetaType::Bool: {
                 found = true;
-                bool boolean = callMethod<bool>(pair.second, &mm, convertedArgs);
+                bool boolean = callMethod<bool>(toolSet, &mm, convertedArgs);
                 ret.append(QMcpTextContent(boolean ? "true"_L1 : "false"_L1));
                 break; }
             case QMetaType::QString: {
                 found = true;
-                QString text = callMethod<QString>(pair.second, &mm, convertedArgs);
+                QString text = callMethod<QString>(toolSet, &mm, convertedArgs);
                 ret.append(QMcpTextContent(text));
                 break; }
             case QMetaType::QStringList: {
                 found = true;
-                const QStringList texts = callMethod<QStringList>(pair.second, &mm, convertedArgs);
+                const QStringList texts = callMethod<QStringList>(toolSet, &mm, convertedArgs);
                 for (const auto &text : texts)
                     ret.append(QMcpTextContent(text));
                 break; }
 #ifdef QT_GUI_LIB
             case QMetaType::QImage: {
                 found = true;
-                QImage image = callMethod<QImage>(pair.second, &mm, convertedArgs);
+                QImage image = callMethod<QImage>(toolSet, &mm, convertedArgs);
                 ret.append(QMcpImageContent(image));
                 break; }
 #endif // QT_GUI_LIB
@@ -822,16 +761,9 @@ QList<QMcpCallToolResultContent> QMcpServerSession::callTool(const QString &name
     }
 
 #ifdef QT_GUI_LIB
-    if (!found) {
-        for (const auto &pair : std::as_const(d->actions)) {
-            const auto tool = pair.first;
-            if (tool.name() != name)
-                continue;
-            auto action = pair.second;
-            action->trigger();
-            found = true;
-            break;
-        }
+    if (!found && tool.kind == QMcpRegistry::Tool::Action && tool.object) {
+        static_cast<QAction *>(tool.object)->trigger();
+        found = true;
     }
 #endif
 
@@ -22,6 +22,8 @@
 #include <QtMcpCommon/qtmcpnamespace.h>
 #include <QtMcpServer/qmcpserverglobal.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 #ifdef QT_GUI_LIB
@@ -29,6 +31,7 @@ class QAction;
 #endif
 
 class QMcpServer;
+class QMcpRegistry;
 
 /*!
     \class QMcpServerSession
@@ -46,6 +49,11 @@ class QMcpServer;
 
     Each session is identified by a unique UUID and maintains its own state independently
     of other sessions.
+
+    The tools, dynamic resources and dynamic prompts registered with
+    QMcpServer are shared by all its sessions, not copied into each. Those
+    registered with a session are added to the shared ones for this session
+    only, and take precedence over them.
 */
 class Q_MCPSERVER_EXPORT QMcpServerSession : public QObject
 {
@@ -93,6 +101,18 @@ public:
     */
     void setProtocolVersion(const QString &protocolVersionStr);
 
+    /*!
+        Returns the encoding of the messages sent to the client.
+        This is QtMcp::Encoding::Json unless CBOR was negotiated.
+        \sa QMcpCbor
+    */
+    QtMcp::Encoding encoding() const;
+
+    /*!
+        Sets the encoding of the messages sent to the client.
+    */
+    void setEncoding(QtMcp::Encoding encoding);
+
     /*!
         Returns whether the session has been initialized.
         \sa initialized
@@ -162,9 +182,23 @@ public:
         \param name Name of the tool to execute
         \param params Parameters for the tool
         \param ok Optional pointer to bool that will be set to true if successful
+        \param errorMessage Optional pointer to a string describing why the
+        parameters do not match the input schema of the tool
         \return List of tool execution results
+
+        The parameters are checked against the input schema of the tool
+        before the tool is called.
      */
-    QList<QMcpCallToolResultContent> callTool(const QString &name, const QJsonObject &params, bool *ok = nullptr);
+    QList<QMcpCallToolResultContent> callTool(const QString &name, const QJsonObject &params, bool *ok = nullptr, QString *errorMessage = nullptr);
+
+    /*!
+        Checks \a params against the input schema of the tool \a name.
+        \param name Name of the tool
+        \param params Parameters for the tool
+        \param errorMessage Optional pointer to a string describing the mismatch
+        \return true if the parameters match or the tool has no schema
+     */
+    bool validateToolArguments(const QString &name, const QJsonObject &params, QString *errorMessage = nullptr) const;
 
     /*!
         Returns the list of roots available in this session.
@@ -178,6 +212,15 @@ public:
     using DynamicPromptHandler = std::function<QList<QMcpPromptMessage>(const QString &name,
                                                                           const QJsonObject &arguments)>;
 
+    /*!
+        Returns the handler of the dynamic tool \a name, or an empty handler
+        if no dynamic tool of that name is registered.
+
+        The handler does not depend on the session and may be called from
+        another thread.
+     */
+    DynamicToolHandler dynamicToolHandler(const QString &name) const;
+
 public slots:
     /*!
         Appends a resource template to the session.
@@ -257,6 +300,10 @@ signals:
     void createMessageFinished(const QMcpCreateMessageResult &result);
 
 private:
+    // switches to the registry shared by the sessions of the server
+    void setRegistry(const std::shared_ptr<const QMcpRegistry> &registry);
+    friend class QMcpServer;
+
     class Private;
     QScopedPointer<Private> d;
 };
@@ -0,0 +1,130 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPSPSCQUEUE_P_H
+#define QMCPSPSCQUEUE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpServer/qmcpserverglobal.h>
+#include <QtCore/qobject.h>
+
+#include <atomic>
+#include <functional>
+#include <new>
+#include <optional>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+// An unbounded queue between exactly one producer thread and one consumer
+// thread. Neither side takes a lock: the producer links a new node behind
+// the last one, the consumer unlinks the first one.
+template <typename T>
+class QMcpSpscQueue
+{
+public:
+    QMcpSpscQueue()
+        : head(new Node)
+        , tail(head)
+    {}
+
+    ~QMcpSpscQueue()
+    {
+        while (head)
+            delete std::exchange(head, head->next.load(std::memory_order_relaxed));
+    }
+
+    // producer only
+    void push(T &&value)
+    {
+        auto *node = new Node;
+        node->value.emplace(std::move(value));
+        tail->next.store(node, std::memory_order_release);
+        tail = node;
+    }
+
+    // consumer only
+    bool pop(T *value)
+    {
+        auto *next = head->next.load(std::memory_order_acquire);
+        if (!next)
+            return false;
+        *value = std::move(*next->value);
+        next->value.reset();
+        // the popped node stays as the empty head
+        delete std::exchange(head, next);
+        return true;
+    }
+
+    // consumer only
+    bool isEmpty() const
+    {
+        return !head->next.load(std::memory_order_acquire);
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QMcpSpscQueue)
+
+    struct Node {
+        std::optional<T> value;
+        std::atomic<Node *> next = nullptr;
+    };
+
+    // apart, so the two threads do not share a cache line
+    alignas(64) Node *head;
+    alignas(64) Node *tail;
+};
+
+// Hands values from one producer thread to the thread of the channel,
+// where the handler is called for each of them in order.
+//
+// post() wakes the consumer thread with a queued call only if no call is
+// pending already, so a burst of values costs one event.
+template <typename T>
+class QMcpSpscChannel : public QObject
+{
+public:
+    using Handler = std::function<void(T &&)>;
+
+    explicit QMcpSpscChannel(Handler handler, QObject *parent = nullptr)
+        : QObject(parent)
+        , handler(std::move(handler))
+    {}
+
+    // producer only
+    void post(T &&value)
+    {
+        queue.push(std::move(value));
+        if (!scheduled.exchange(true, std::memory_order_acq_rel))
+            QMetaObject::invokeMethod(this, [this]() { flush(); }, Qt::QueuedConnection);
+    }
+
+    // consumer only, delivers the values posted so far
+    void flush()
+    {
+        // values posted from here on schedule another call
+        scheduled.exchange(false, std::memory_order_acq_rel);
+        T value;
+        while (queue.pop(&value))
+            handler(std::move(value));
+    }
+
+private:
+    Handler handler;
+    QMcpSpscQueue<T> queue;
+    std::atomic<bool> scheduled = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPSPSCQUEUE_P_H
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPTIMERWHEEL_P_H
+#define QMCPTIMERWHEEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpServer/qmcpserverglobal.h>
+#include <QtCore/qlist.h>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+// Expires keys after a number of ticks. Scheduling and expiring a key cost
+// O(1) whatever the number of keys: a key waits in the slot of the tick it
+// expires at, for as many turns of the wheel as its delay needs.
+//
+// Keys are not removed before they expire, the owner ignores the keys that
+// are no longer of interest.
+template <typename Key>
+class QMcpTimerWheel
+{
+public:
+    explicit QMcpTimerWheel(qsizetype slotCount = 64)
+        : slots(slotCount)
+    {}
+
+    // expires key with the ticks-th call of advance() from now, at least 1
+    void schedule(Key key, qsizetype ticks)
+    {
+        ticks = qMax(ticks, qsizetype(1));
+        const auto size = slots.size();
+        slots[(cursor + ticks) % size].append({ std::move(key), (ticks - 1) / size });
+        count++;
+    }
+
+    // moves on by one tick, returns the keys expiring with it
+    QList<Key> advance()
+    {
+        cursor = (cursor + 1) % slots.size();
+        QList<Key> expired;
+        auto &slot = slots[cursor];
+        for (qsizetype i = 0; i < slot.size();) {
+            if (slot[i].turns-- > 0) {
+                i++;
+                continue;
+            }
+            expired.append(std::move(slot[i].key));
+            // the order within a slot does not matter
+            if (i != slot.size() - 1)
+                slot[i] = std::move(slot.last());
+            slot.removeLast();
+            count--;
+        }
+        return expired;
+    }
+
+    bool isEmpty() const { return count == 0; }
+    qsizetype size() const { return count; }
+
+private:
+    struct Entry {
+        Key key;
+        qsizetype turns;
+    };
+    QList<QList<Entry>> slots;
+    qsizetype cursor = 0;
+    qsizetype count = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPTIMERWHEEL_P_H
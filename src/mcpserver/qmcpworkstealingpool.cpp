@@ -0,0 +1,194 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmcpworkstealingpool_p.h"
+
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// the pool and the queue of the worker running on this thread
+thread_local const QMcpWorkStealingPool *currentPool = nullptr;
+thread_local int currentWorker = -1;
+}
+
+QMcpWorkStealingPool::QMcpWorkStealingPool(int threadCount, qsizetype maxQueued)
+    : maxQueuedTasks(maxQueued > 0 ? maxQueued : 1)
+{
+    if (threadCount <= 0)
+        threadCount = qMax(1, QThread::idealThreadCount());
+
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; i++)
+        workers.push_back(std::make_unique<Worker>());
+    for (int i = 0; i < threadCount; i++) {
+        auto *thread = QThread::create([this, i]() { run(i); });
+        thread->setObjectName("QMcpWorkStealingPool "_L1 + QString::number(i));
+        workers[i]->thread = thread;
+        thread->start();
+    }
+}
+
+// runs the tasks still queued before the workers exit
+QMcpWorkStealingPool::~QMcpWorkStealingPool()
+{
+    {
+        QMutexLocker locker(&idleMutex);
+        stopping = true;
+        taskAvailable.wakeAll();
+    }
+    for (const auto &worker : workers) {
+        worker->thread->wait();
+        delete worker->thread;
+    }
+}
+
+// Starts \a task unless maxQueued() tasks are waiting already.
+bool QMcpWorkStealingPool::tryStart(Task task)
+{
+    if (!reserve())
+        return false;
+    push(std::move(task));
+    return true;
+}
+
+// Starts \a task once the tasks started before with \a strand are done.
+bool QMcpWorkStealingPool::tryStart(const std::shared_ptr<Strand> &strand, Task task)
+{
+    if (!reserve())
+        return false;
+    {
+        QMutexLocker locker(&strand->mutex);
+        if (strand->running) {
+            strand->pending.push_back(std::move(task));
+            return true;
+        }
+        strand->running = true;
+    }
+    push([this, strand, task = std::move(task)]() mutable {
+        runStrand(strand, task);
+    });
+    return true;
+}
+
+// Waits until no task is queued or running, at most \a msecs milliseconds
+// unless \a msecs is negative.
+bool QMcpWorkStealingPool::waitForDone(int msecs)
+{
+    const QDeadlineTimer deadline = msecs < 0 ? QDeadlineTimer(QDeadlineTimer::Forever) : QDeadlineTimer(msecs);
+    QMutexLocker locker(&idleMutex);
+    while (queuedTasks.load() > 0 || activeTasks.load() > 0) {
+        if (!done.wait(&idleMutex, deadline))
+            return false;
+    }
+    return true;
+}
+
+bool QMcpWorkStealingPool::reserve()
+{
+    auto queued = queuedTasks.load(std::memory_order_relaxed);
+    do {
+        if (queued >= maxQueuedTasks)
+            return false;
+    } while (!queuedTasks.compare_exchange_weak(queued, queued + 1));
+    return true;
+}
+
+void QMcpWorkStealingPool::push(Task &&task)
+{
+    const int count = threadCount();
+    const int index = currentPool == this ? currentWorker : int(nextWorker.fetch_add(1, std::memory_order_relaxed) % count);
+    {
+        auto &worker = *workers[index];
+        QMutexLocker locker(&worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    QMutexLocker locker(&idleMutex);
+    available++;
+    taskAvailable.wakeOne();
+}
+
+bool QMcpWorkStealingPool::take(int index, Task *task)
+{
+    const int count = threadCount();
+    for (int i = 0; i < count; i++) {
+        auto &worker = *workers[(index + i) % count];
+        QMutexLocker locker(&worker.mutex);
+        if (worker.tasks.empty())
+            continue;
+        // the oldest of the own queue, the newest of another one
+        if (i == 0) {
+            *task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+        } else {
+            *task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void QMcpWorkStealingPool::run(int index)
+{
+    currentPool = this;
+    currentWorker = index;
+
+    while (true) {
+        {
+            QMutexLocker locker(&idleMutex);
+            while (available == 0 && !stopping)
+                taskAvailable.wait(&idleMutex);
+            if (available == 0)
+                break;
+            available--;
+        }
+
+        // another worker may have stolen the task announced to this one,
+        // but then the task announced to that worker is still queued
+        Task task;
+        while (!take(index, &task)) {}
+
+        activeTasks++;
+        queuedTasks--;
+        task();
+        task = nullptr;
+        finished();
+    }
+
+    currentPool = nullptr;
+    currentWorker = -1;
+}
+
+void QMcpWorkStealingPool::runStrand(const std::shared_ptr<Strand> &strand, Task &task)
+{
+    task();
+    task = nullptr;
+
+    Task next;
+    {
+        QMutexLocker locker(&strand->mutex);
+        if (strand->pending.empty()) {
+            strand->running = false;
+            return;
+        }
+        next = std::move(strand->pending.front());
+        strand->pending.pop_front();
+    }
+    // queued behind the tasks of the other strands on this worker
+    push([this, strand, next = std::move(next)]() mutable {
+        runStrand(strand, next);
+    });
+}
+
+void QMcpWorkStealingPool::finished()
+{
+    if (--activeTasks == 0 && queuedTasks.load() == 0) {
+        QMutexLocker locker(&idleMutex);
+        done.wakeAll();
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMCPWORKSTEALINGPOOL_P_H
+#define QMCPWORKSTEALINGPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMcpServer/qmcpserverglobal.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+
+// Runs the request handlers of QMcpServer off the thread of the backend.
+//
+// Every worker has a queue of its own. Tasks started from outside the pool
+// are spread over the queues round robin, tasks started by a worker go to
+// its own queue. A worker takes the oldest task of its queue and, once
+// that is empty, steals the newest task of another one, so a slow handler
+// only holds up its own worker while the others drain its queue.
+//
+// Tasks started with the same Strand run one after the other, in the order
+// they were started, on whichever worker is free.
+class Q_MCPSERVER_EXPORT QMcpWorkStealingPool
+{
+public:
+    using Task = std::function<void()>;
+
+    class Strand
+    {
+        friend class QMcpWorkStealingPool;
+        QMutex mutex;
+        std::deque<Task> pending;
+        bool running = false;
+    };
+
+    explicit QMcpWorkStealingPool(int threadCount = 0, qsizetype maxQueued = 1024);
+    ~QMcpWorkStealingPool();
+
+    int threadCount() const { return int(workers.size()); }
+    qsizetype maxQueued() const { return maxQueuedTasks; }
+    qsizetype queued() const { return queuedTasks.load(std::memory_order_relaxed); }
+
+    bool tryStart(Task task);
+    bool tryStart(const std::shared_ptr<Strand> &strand, Task task);
+    bool waitForDone(int msecs = -1);
+
+private:
+    Q_DISABLE_COPY_MOVE(QMcpWorkStealingPool)
+
+    struct Worker {
+        QThread *thread = nullptr;
+        QMutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool reserve();
+    void push(Task &&task);
+    bool take(int index, Task *task);
+    void run(int index);
+    void runStrand(const std::shared_ptr<Strand> &strand, Task &task);
+    void finished();
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    const qsizetype maxQueuedTasks;
+    // started but not yet running, including the tasks waiting in strands
+    std::atomic<qsizetype> queuedTasks = 0;
+    std::atomic<qsizetype> activeTasks = 0;
+    std::atomic<quint32> nextWorker = 0;
+
+    QMutex idleMutex;
+    // queued tasks not yet claimed by a worker, guarded by idleMutex
+    qsizetype available = 0;
+    QWaitCondition taskAvailable;
+    QWaitCondition done;
+    bool stopping = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QMCPWORKSTEALINGPOOL_P_H
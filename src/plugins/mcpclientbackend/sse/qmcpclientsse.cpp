@@ -176,13 +176,8 @@ void QMcpClientSse::Private::fallbackToLegacyProtocol()
                     }
                     emit q->started();
                 } else if (key == "message") {
-                    QJsonParseError error;
-                    const auto json = QJsonDocument::fromJson(data, &error);
-                    if (error.error) {
-                        qCWarning(lcQMcpClientSsePlugin) << error.errorString();
-                    } else {
-                        emit q->received(json.object());
-                    }
+                    // parsed by QMcpClient
+                    emit q->messageReceived(data);
                 } else {
                     qCWarning(lcQMcpClientSsePlugin) << "unknown key" << key;
                 }
@@ -202,7 +197,7 @@ void QMcpClientSse::Private::fallbackToLegacyProtocol()
 }
 
 QMcpClientSse::QMcpClientSse(QObject *parent)
-    : QMcpClientBackendInterface(parent)
+    : QMcpClientBackendInterfaceV2(parent)
     , d(new Private(this))
 {}
 
@@ -213,7 +208,7 @@ void QMcpClientSse::start(const QString &server)
     d->start(QUrl(server));
 }
 
-void QMcpClientSse::send(const QJsonObject &object)
+void QMcpClientSse::writeMessage(QByteArray &&message)
 {
     if (d->message.isEmpty()) {
         qCWarning(lcQMcpClientSsePlugin) << "Message URL is empty";
@@ -229,24 +224,18 @@ void QMcpClientSse::send(const QJsonObject &object)
         qCDebug(lcQMcpClientSsePlugin) << "Sending with Mcp-Session-Id:" << d->sessionId;
     }
 
-    QJsonDocument doc(object);
-    QByteArray data = doc.toJson(QJsonDocument::Compact);
-    qCDebug(lcQMcpClientSsePlugin) << data;
+    qCDebug(lcQMcpClientSsePlugin) << message;
 
-    auto *reply = d->networkAccessManager.post(request, data);
+    auto *reply = d->networkAccessManager.post(request, message);
 
     // For new protocol, handle the response
     if (d->usesNewProtocol) {
         connect(reply, &QNetworkReply::finished, this, [this, reply]() {
             if (reply->error() == QNetworkReply::NoError) {
-                QByteArray responseData = reply->readAll();
-                QJsonParseError error;
-                QJsonDocument doc = QJsonDocument::fromJson(responseData, &error);
-                if (error.error == QJsonParseError::NoError && doc.isObject()) {
-                    emit received(doc.object());
-                } else {
-                    qCWarning(lcQMcpClientSsePlugin) << "Error parsing response:" << error.errorString();
-                }
+                // notifications are answered without a body
+                const auto responseData = reply->readAll();
+                if (!responseData.isEmpty())
+                    emit messageReceived(responseData);
             } else {
                 qCWarning(lcQMcpClientSsePlugin) << "Request error:" << reply->errorString();
             }
@@ -267,9 +256,4 @@ void QMcpClientSse::send(const QJsonObject &object)
     });
 }
 
-void QMcpClientSse::notify(const QJsonObject &object)
-{
-    send(object); // For SSE, notifications are sent the same way as regular messages
-}
-
 QT_END_NAMESPACE
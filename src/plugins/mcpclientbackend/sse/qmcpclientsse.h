@@ -11,17 +11,17 @@
 
 QT_BEGIN_NAMESPACE
 
-class QMcpClientSse : public QMcpClientBackendInterface
+class QMcpClientSse : public QMcpClientBackendInterfaceV2
 {
     Q_OBJECT
 public:
     explicit QMcpClientSse(QObject *parent = nullptr);
     ~QMcpClientSse() override;
 
+    void writeMessage(QByteArray &&message) override;
+
 public slots:
     void start(const QString &server) override;
-    void send(const QJsonObject &object) override;
-    void notify(const QJsonObject &object) override;
 
 private:
     class Private;
@@ -2,11 +2,9 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpclientstdio.h"
+#include <QtMcpCommon/qmcpcbor.h>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QProcess>
-#include <QtCore/QJsonDocument>
-#include <QtCore/QJsonParseError>
-#include <QtCore/QJsonObject>
 #include <QtCore/QDebug>
 #include <QtCore/QUrl>
 #include <QtCore/QStringList>
@@ -47,19 +45,28 @@ QMcpClientStdio::Private::Private(QMcpClientStdio *parent)
         static QByteArray data;
         data.append(server.readAllStandardOutput());
         while (true) {
+            // CBOR messages tell their own length, JSON messages end with a newline
+            if (QMcpCbor::isCbor(data)) {
+                const auto size = QMcpCbor::messageSize(data);
+                if (size == 0)
+                    break;
+                if (size < 0) {
+                    data.clear();
+                    break;
+                }
+                emit q->messageReceived(data.first(size));
+                data.remove(0, size);
+                continue;
+            }
             int lf = data.indexOf('\n');
             if (lf < 0)
                 break;
-            const auto line = data.left(lf);
+            const auto line = data.first(lf).trimmed();
             data.remove(0, lf + 1);
-            QJsonParseError error;
-            const auto json = QJsonDocument::fromJson(line, &error);
-            if (error.error) {
-                qWarning() << error.errorString();
-            } else {
-                qDebug() << json;
-                emit q->received(json.object());
-            }
+            if (line.isEmpty())
+                continue;
+            qCDebug(lcQMcpClientStdioPlugin) << line;
+            emit q->messageReceived(line);
         }
     });
     connect(&server, &QProcess::readyReadStandardError, q, [this]() {
@@ -68,12 +75,17 @@ QMcpClientStdio::Private::Private(QMcpClientStdio *parent)
 }
 
 QMcpClientStdio::QMcpClientStdio(QObject *parent)
-    : QMcpClientBackendInterface(parent)
+    : QMcpClientBackendInterfaceV2(parent)
     , d(new Private(this))
 {}
 
 QMcpClientStdio::~QMcpClientStdio() = default;
 
+bool QMcpClientStdio::supportsCbor() const
+{
+    return true;
+}
+
 void QMcpClientStdio::start(const QString &server)
 {
     QStringList arguments = server.split(' ');
@@ -81,17 +93,13 @@ void QMcpClientStdio::start(const QString &server)
     d->server.start(program, arguments);
 }
 
-void QMcpClientStdio::send(const QJsonObject &object)
-{
-    qDebug() << d->server.state();
-    const auto data = QJsonDocument(object).toJson(QJsonDocument::Compact);
-    qDebug().noquote() << data;
-    d->server.write(data + "\n");
-}
-
-void QMcpClientStdio::notify(const QJsonObject &object)
+void QMcpClientStdio::writeMessage(QByteArray &&message)
 {
-    send(object);
+    qCDebug(lcQMcpClientStdioPlugin).noquote() << message;
+    // CBOR needs no terminator, a newline would be read as a value
+    if (!QMcpCbor::isCbor(message))
+        message.append('\n');
+    d->server.write(message);
 }
 
 QT_END_NAMESPACE
@@ -6,21 +6,21 @@
 
 #include <QtMcpClient/qmcpclientbackendplugin.h>
 #include <QtMcpClient/qmcpclientbackendinterface.h>
-#include <QtCore/QJsonObject>
 
 QT_BEGIN_NAMESPACE
 
-class QMcpClientStdio : public QMcpClientBackendInterface
+class QMcpClientStdio : public QMcpClientBackendInterfaceV2
 {
     Q_OBJECT
 public:
     explicit QMcpClientStdio(QObject *parent = nullptr);
     ~QMcpClientStdio() override;
 
+    bool supportsCbor() const override;
+    void writeMessage(QByteArray &&message) override;
+
 public slots:
     void start(const QString &server) override;
-    void send(const QJsonObject &object) override;
-    void notify(const QJsonObject &object) override;
 
 private:
     class Private;
@@ -1,30 +1,326 @@
 #include "httpserver.h"
 #include <QtCore/QUrlQuery>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
-#include <QtCore/QJsonObject>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QPointer>
 #include <QtNetwork/QTcpSocket>
 
 Q_DECLARE_LOGGING_CATEGORY(lcQMcpServerSsePlugin)
 
+namespace {
+// reads the IDs of the requests in a JSON-RPC message or batch without
+// building a document, QMcpServer parses the message anyway; the rest of
+// the message is only checked to be valid JSON
+class RequestScanner
+{
+public:
+    explicit RequestScanner(QByteArrayView json) : json(json) {}
+
+    // returns false if the message is not JSON, an object or an array
+    bool scan(QList<QJsonValue> *ids, qsizetype *count)
+    {
+        skipSpace();
+        if (peek() == '[') {
+            pos++;
+            if (!next(']')) {
+                do {
+                    skipSpace();
+                    // anything but an object is an invalid request
+                    if (peek() == '{' ? !message(ids) : !value())
+                        return false;
+                    ++*count;
+                } while (next(','));
+                if (!next(']'))
+                    return false;
+            }
+        } else if (peek() == '{') {
+            if (!message(ids))
+                return false;
+            *count = 1;
+        } else {
+            return false;
+        }
+        skipSpace();
+        return pos == json.size();
+    }
+
+private:
+    static constexpr int maxDepth = 1024;
+
+    char peek() const { return pos < json.size() ? json.at(pos) : '\0'; }
+
+    void skipSpace()
+    {
+        while (pos < json.size() && (json.at(pos) == ' ' || json.at(pos) == '\t' || json.at(pos) == '\n' || json.at(pos) == '\r'))
+            pos++;
+    }
+
+    // consumes c after white space if it is next
+    bool next(char c)
+    {
+        skipSpace();
+        if (peek() != c)
+            return false;
+        pos++;
+        return true;
+    }
+
+    // an object at the top level, which is a request if it has an ID and
+    // a method
+    bool message(QList<QJsonValue> *ids)
+    {
+        QByteArrayView id;
+        bool method = false;
+        if (!object(&id, &method))
+            return false;
+        if (!id.isNull() && method)
+            ids->append(idValue(id));
+        return true;
+    }
+
+    bool object(QByteArrayView *id = nullptr, bool *method = nullptr)
+    {
+        pos++;
+        if (++depth > maxDepth)
+            return false;
+        if (!next('}')) {
+            do {
+                skipSpace();
+                QByteArrayView key;
+                if (!string(&key) || !next(':'))
+                    return false;
+                skipSpace();
+                const auto start = pos;
+                if (!value())
+                    return false;
+                if (id && key == "id")
+                    *id = json.sliced(start, pos - start);
+                else if (method && key == "method")
+                    *method = true;
+            } while (next(','));
+            if (!next('}'))
+                return false;
+        }
+        depth--;
+        return true;
+    }
+
+    bool array()
+    {
+        pos++;
+        if (++depth > maxDepth)
+            return false;
+        if (!next(']')) {
+            do {
+                skipSpace();
+                if (!value())
+                    return false;
+            } while (next(','));
+            if (!next(']'))
+                return false;
+        }
+        depth--;
+        return true;
+    }
+
+    // the raw contents of a string go to contents
+    bool string(QByteArrayView *contents = nullptr)
+    {
+        if (peek() != '"')
+            return false;
+        const auto start = ++pos;
+        while (pos < json.size()) {
+            const auto c = uchar(json.at(pos));
+            if (c == '"') {
+                if (contents)
+                    *contents = json.sliced(start, pos - start);
+                pos++;
+                return true;
+            }
+            if (c < 0x20)
+                return false;
+            pos++;
+            if (c != '\\')
+                continue;
+            switch (peek()) {
+            case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                pos++;
+                break;
+            case 'u':
+                pos++;
+                for (int i = 0; i < 4; i++, pos++) {
+                    if (!isAsciiHexDigit(peek()))
+                        return false;
+                }
+                break;
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool digits()
+    {
+        const auto start = pos;
+        while (isAsciiDigit(peek()))
+            pos++;
+        return pos > start;
+    }
+
+    bool number()
+    {
+        if (peek() == '-')
+            pos++;
+        if (peek() == '0')
+            pos++;
+        else if (!digits())
+            return false;
+        if (peek() == '.') {
+            pos++;
+            if (!digits())
+                return false;
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            pos++;
+            if (peek() == '+' || peek() == '-')
+                pos++;
+            if (!digits())
+                return false;
+        }
+        return true;
+    }
+
+    bool literal(QByteArrayView word)
+    {
+        if (!json.sliced(pos).startsWith(word))
+            return false;
+        pos += word.size();
+        return true;
+    }
+
+    bool value()
+    {
+        switch (peek()) {
+        case '{': return object();
+        case '[': return array();
+        case '"': return string();
+        case 't': return literal("true");
+        case 'f': return literal("false");
+        case 'n': return literal("null");
+        default: return number();
+        }
+    }
+
+    // plain strings and integers are read directly, the rest the way
+    // QMcpServer reads them
+    static QJsonValue idValue(QByteArrayView id)
+    {
+        if (id.startsWith('"') && !id.contains('\\'))
+            return QString::fromUtf8(id.sliced(1, id.size() - 2));
+        bool ok = false;
+        const auto integer = id.toLongLong(&ok);
+        if (ok)
+            return integer;
+        return QJsonDocument::fromJson("[" + id.toByteArray() + "]").array().at(0);
+    }
+
+    static bool isAsciiDigit(char c) { return c >= '0' && c <= '9'; }
+    static bool isAsciiHexDigit(char c)
+    {
+        return isAsciiDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    }
+
+    QByteArrayView json;
+    qsizetype pos = 0;
+    int depth = 0;
+};
+}
+
 class HttpServer::Private{
 public:
+    bool forget(const QUuid &session);
+    bool queue(const QUuid &session, const QList<QJsonValue> &ids, QTcpSocket *socket);
+    bool take(const QUuid &session, const QList<QJsonValue> &ids, QPointer<QTcpSocket> *socket);
+
     QSet<QUuid> sessions;
     QUuid implicitSession;  // For handling direct POSTs without prior SSE connection
     QHash<QUuid, bool> sessionUsesNewProtocol;  // Track which sessions use new protocol
 
-    // For new protocol: store pending requests that need responses
-    struct PendingRequest {
-        QTcpSocket *socket;
-        QUuid sessionId;
-    };
-    QList<PendingRequest> pendingRequests;
+    // For new protocol: the sockets of the POSTs waiting for their
+    // responses, by session and JSON-RPC ID, as the server may answer them
+    // in any order; all requests of a batch share the socket, null once it
+    // is gone
+    QHash<QUuid, QHash<QJsonValue, QPointer<QTcpSocket>>> pendingRequests;
 };
 
+// drops everything kept for session, returns whether it was known
+bool HttpServer::Private::forget(const QUuid &session)
+{
+    bool known = sessions.remove(session);
+    known = sessionUsesNewProtocol.remove(session) || known;
+    if (implicitSession == session) {
+        implicitSession = QUuid();
+        known = true;
+    }
+    pendingRequests.remove(session);
+    return known;
+}
+
+// waits with socket for the responses to the requests ids, returns whether
+// there is one; a batch gets one response for all its requests
+bool HttpServer::Private::queue(const QUuid &session, const QList<QJsonValue> &ids, QTcpSocket *socket)
+{
+    if (ids.isEmpty())
+        return false;
+
+    auto &pending = pendingRequests[session];
+    for (const auto &id : std::as_const(ids))
+        pending.insert(id, socket);
+    return true;
+}
+
+// finds the socket waiting for the response to the requests ids, which
+// are no longer pending then; returns false if no request waits for it
+bool HttpServer::Private::take(const QUuid &session, const QList<QJsonValue> &ids, QPointer<QTcpSocket> *socket)
+{
+    const auto i = pendingRequests.find(session);
+    if (i == pendingRequests.end())
+        return false;
+
+    // the responses to a batch are sent together
+    for (const auto &id : std::as_const(ids)) {
+        const auto j = i->constFind(id);
+        if (j == i->cend())
+            continue;
+        *socket = *j;
+        // the requests of a batch left out of its response wait no longer
+        for (auto k = i->begin(); k != i->end();) {
+            if (*k == *socket)
+                k = i->erase(k);
+            else
+                ++k;
+        }
+        if (i->isEmpty())
+            pendingRequests.erase(i);
+        return true;
+    }
+    return false;
+}
+
 HttpServer::HttpServer(QObject *parent)
     : QMcpAbstractHttpServer(parent)
     , d(new Private)
 {
+    // the event stream of a legacy session is the session, streamable HTTP
+    // sessions outlive their connections until deleted or closed as idle
+    connect(this, &QMcpAbstractHttpServer::sessionDisconnected, this, [this](const QUuid &session) {
+        if (!d->sessions.contains(session) || d->sessionUsesNewProtocol.value(session, false))
+            return;
+        d->forget(session);
+        emit sessionClosed(session);
+    });
 }
 
 HttpServer::~HttpServer() = default;
@@ -70,15 +366,12 @@ QByteArray HttpServer::post(const QNetworkRequest &request, const QByteArray &bo
             return QByteArray();
         }
 
-        // Queue this request for async response
+        // Queue the requests for async response
+        QList<QJsonValue> ids;
+        qsizetype count = 0;
         QTcpSocket *socket = getSocketForRequest(request);
-        if (socket) {
-            Private::PendingRequest pending;
-            pending.socket = socket;
-            pending.sessionId = session;
-            d->pendingRequests.append(pending);
+        if (socket && RequestScanner(body).scan(&ids, &count) && d->queue(session, ids, socket))
             qCDebug(lcQMcpServerSsePlugin) << "Queued request for session" << session;
-        }
     } else {
         // Legacy protocol: create or reuse implicit session
         if (!d->sessions.isEmpty()) {
@@ -96,15 +389,9 @@ QByteArray HttpServer::post(const QNetworkRequest &request, const QByteArray &bo
         }
     }
 
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(body, &error);
-    if (error.error == QJsonParseError::NoError && doc.isObject()) {
-        qCDebug(lcQMcpServerSsePlugin) << "POST: forwarding to session" << session;
-        emit received(session, doc.object());
-    } else {
-        qWarning() << body;
-        qWarning() << "error parsing message" << error.errorString();
-    }
+    // parsed by QMcpServer
+    qCDebug(lcQMcpServerSsePlugin) << "POST: forwarding to session" << session;
+    emit received(session, body);
 
     // For new protocol, return empty (response will be sent via sendWithHeader)
     // For legacy, return "Accept"
@@ -124,56 +411,89 @@ QByteArray HttpServer::postMessages(const QNetworkRequest &request, const QByteA
         return QByteArray();
     }
 
-    // Parse message body for target client ID
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(body, &error);
-    if (error.error == QJsonParseError::NoError && doc.isObject()) {
-        emit received(session, doc.object());
-    } else {
-        qWarning() << body;
-        qWarning() << "error parsing message" << error.errorString();
-    }
+    // parsed by QMcpServer
+    emit received(session, body);
     return "Accept"_ba;
 }
 
-void HttpServer::send(const QUuid &session, const QJsonObject &object)
+void HttpServer::send(const QUuid &session, const QByteArray &data)
 {
     // Check if this session uses the new protocol
     if (d->sessionUsesNewProtocol.value(session, false)) {
-        sendWithHeader(session, object);
+        // there is no event stream for notifications and requests
+        qCDebug(lcQMcpServerSsePlugin) << "Dropped message, session" << session << "has no event stream";
     } else {
         // Legacy SSE protocol
-        sendSseEvent(session, QJsonDocument(object).toJson(QJsonDocument::Compact), "message"_L1);
+        sendSseEvent(session, data, "message"_L1);
     }
 }
 
-void HttpServer::sendWithHeader(const QUuid &session, const QJsonObject &object)
+void HttpServer::sendResponse(const QUuid &session, const QList<QJsonValue> &ids, const QByteArray &data)
 {
-    // New protocol: Send response with Mcp-Session-Id header
-    // Find the pending request for this session
-    for (int i = 0; i < d->pendingRequests.size(); ++i) {
-        if (d->pendingRequests[i].sessionId == session) {
-            auto pending = d->pendingRequests.takeAt(i);
-            QTcpSocket *socket = pending.socket;
+    // the new protocol answers on the POST of the requests, even if they
+    // are not answered at all
+    if (d->sessionUsesNewProtocol.value(session, false))
+        sendWithHeader(session, ids, data);
+    else if (!data.isEmpty())
+        sendSseEvent(session, data, "message"_L1);
+}
 
-            QByteArray jsonData = QJsonDocument(object).toJson(QJsonDocument::Compact);
+bool HttpServer::hasEventStream(const QUuid &session) const
+{
+    // streamable HTTP sessions are answered on their POSTs only
+    return d->sessions.contains(session) && !d->sessionUsesNewProtocol.value(session, false);
+}
 
-            QByteArray response = QByteArrayLiteral("HTTP/1.1 200 OK\r\n")
-                                  + "Content-Type: application/json\r\n"
-                                  + "Mcp-Session-Id: " + session.toByteArray(QUuid::WithoutBraces) + "\r\n"
-                                  + "Content-Length: " + QByteArray::number(jsonData.size()) + "\r\n"
-                                  + "Connection: keep-alive\r\n"
-                                  + "\r\n"
-                                  + jsonData;
+void HttpServer::sendWithHeader(const QUuid &session, const QList<QJsonValue> &ids, const QByteArray &jsonData)
+{
+    // New protocol: Send response with Mcp-Session-Id header
+    // on the POST of the requests it answers
+    QPointer<QTcpSocket> socket;
+    if (!d->take(session, ids, &socket)) {
+        qWarning() << "No pending request found for session" << session;
+        return;
+    }
+    if (!socket) {
+        qCDebug(lcQMcpServerSsePlugin) << "Dropped response, the connection of session" << session << "is closed";
+        return;
+    }
 
-            socket->write(response);
-            socket->flush();
-            qCDebug(lcQMcpServerSsePlugin) << "Sent response with Mcp-Session-Id header for session" << session;
-            return;
-        }
+    // the requests were cancelled, the POST ends like one of notifications
+    if (jsonData.isEmpty()) {
+        QByteArray response = QByteArrayLiteral("HTTP/1.1 202 Accepted\r\n")
+                              + "Mcp-Session-Id: " + session.toByteArray(QUuid::WithoutBraces) + "\r\n"
+                              + "Content-Length: 0\r\n"
+                              + "Connection: keep-alive\r\n"
+                              + "\r\n";
+        socket->write(response);
+        socket->flush();
+        qCDebug(lcQMcpServerSsePlugin) << "Sent 202 Accepted for requests without response, session" << session;
+        return;
     }
 
-    qWarning() << "No pending request found for session" << session;
+    QByteArray response = QByteArrayLiteral("HTTP/1.1 200 OK\r\n")
+                          + "Content-Type: application/json\r\n"
+                          + "Mcp-Session-Id: " + session.toByteArray(QUuid::WithoutBraces) + "\r\n"
+                          + "Content-Length: " + QByteArray::number(jsonData.size()) + "\r\n"
+                          + "Connection: keep-alive\r\n"
+                          + "\r\n"
+                          + jsonData;
+
+    socket->write(response);
+    socket->flush();
+    qCDebug(lcQMcpServerSsePlugin) << "Sent response with Mcp-Session-Id header for session" << session;
+}
+
+void HttpServer::closeSession(const QUuid &session)
+{
+    const bool stream = d->sessions.contains(session) && !d->sessionUsesNewProtocol.value(session, false);
+    if (!d->forget(session))
+        return;
+    // ends the event stream of a legacy client
+    if (stream)
+        closeSseConnection(session);
+    qCDebug(lcQMcpServerSsePlugin) << "Closed session" << session;
+    emit sessionClosed(session);
 }
 
 QByteArray HttpServer::getMcp(const QNetworkRequest &request)
@@ -216,6 +536,8 @@ QByteArray HttpServer::getMcp(const QNetworkRequest &request)
             qWarning() << "Invalid Mcp-Session-Id in GET:" << sessionIdHeader;
             return QByteArray();
         }
+        if (!d->sessionUsesNewProtocol.contains(session))
+            return sessionNotFound(request, session);
         qCDebug(lcQMcpServerSsePlugin) << "GET for existing session:" << session;
     } else {
         // Initial connection - create a new session
@@ -300,16 +622,9 @@ QByteArray HttpServer::deleteMcp(const QNetworkRequest &request)
     // Register this socket as a session to prevent automatic HTTP wrapper
     registerSession(session, request);
 
-    // Clean up session state
-    d->sessionUsesNewProtocol.remove(session);
-    d->sessions.remove(session);
-
-    // Remove any pending requests for this session
-    for (int i = d->pendingRequests.size() - 1; i >= 0; --i) {
-        if (d->pendingRequests[i].sessionId == session) {
-            d->pendingRequests.removeAt(i);
-        }
-    }
+    // Clean up session state, pending requests included
+    if (d->forget(session))
+        emit sessionClosed(session);
 
     qCDebug(lcQMcpServerSsePlugin) << "Terminated session" << session;
 
@@ -329,6 +644,28 @@ QByteArray HttpServer::deleteMcp(const QNetworkRequest &request)
     return QByteArray();
 }
 
+// answers a request for a session closed or never started, the client has
+// to start a new one
+QByteArray HttpServer::sessionNotFound(const QNetworkRequest &request, const QUuid &session)
+{
+    qWarning() << "Unknown session" << session;
+
+    QTcpSocket *socket = getSocketForRequest(request);
+    if (!socket)
+        return QByteArray();
+
+    // Register this socket as a session to prevent automatic HTTP wrapper
+    registerSession(session, request);
+
+    QByteArray response = QByteArrayLiteral("HTTP/1.1 404 Not Found\r\n")
+                          + "Content-Length: 0\r\n"
+                          + "Connection: close\r\n"
+                          + "\r\n";
+    socket->write(response);
+    socket->flush();
+    return QByteArray();
+}
+
 QByteArray HttpServer::postMcp(const QNetworkRequest &request, const QByteArray &body)
 {
     // New Streamable HTTP protocol endpoint
@@ -348,6 +685,8 @@ QByteArray HttpServer::postMcp(const QNetworkRequest &request, const QByteArray
             // Create new session as fallback
             session = QUuid::createUuid();
             isNewSession = true;
+        } else if (!d->sessionUsesNewProtocol.contains(session)) {
+            return sessionNotFound(request, session);
         }
     }
 
@@ -376,21 +715,16 @@ QByteArray HttpServer::postMcp(const QNetworkRequest &request, const QByteArray
         emit newSession(session);
     }
 
-    // Parse and forward the request
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(body, &error);
-    if (error.error == QJsonParseError::NoError && doc.isObject()) {
-        auto jsonObj = doc.object();
-        qCDebug(lcQMcpServerSsePlugin) << "/mcp: forwarding to session" << session << "method:" << jsonObj.value("method").toString();
+    // Scan the request to tell requests from notifications, QMcpServer
+    // parses the forwarded body
+    QList<QJsonValue> ids;
+    qsizetype count = 0;
+    if (RequestScanner(body).scan(&ids, &count)) {
+        qCDebug(lcQMcpServerSsePlugin) << "/mcp: forwarding" << count << "messages to session" << session << "requests:" << ids;
 
-        // Only queue requests that expect a response (have an "id" field)
-        // Notifications don't have an id and don't get responses
-        if (jsonObj.contains("id")) {
+        // Notifications and responses don't get responses
+        if (d->queue(session, ids, socket)) {
             // Queue this request for async response
-            Private::PendingRequest pending;
-            pending.socket = socket;
-            pending.sessionId = session;
-            d->pendingRequests.append(pending);
             qCDebug(lcQMcpServerSsePlugin) << "Queued request for session" << session;
         } else {
             // Notifications must receive HTTP 202 Accepted per MCP spec
@@ -404,19 +738,11 @@ QByteArray HttpServer::postMcp(const QNetworkRequest &request, const QByteArray
             socket->flush();
         }
 
-        emit received(session, jsonObj);
+        emit received(session, body);
     } else {
-        qWarning() << "Error parsing /mcp request:" << error.errorString();
-        qWarning() << body;
-
-        // Remove from pending and send error response immediately
-        for (int i = 0; i < d->pendingRequests.size(); ++i) {
-            if (d->pendingRequests[i].sessionId == session) {
-                d->pendingRequests.removeAt(i);
-                break;
-            }
-        }
+        qWarning() << "Error parsing /mcp request:" << body;
 
+        // Nothing was queued, send error response immediately
         QByteArray errorJson = QByteArrayLiteral("{\"error\":\"Invalid JSON\"}");
         QByteArray response = QByteArrayLiteral("HTTP/1.1 400 Bad Request\r\n")
                               + "Content-Type: application/json\r\n"
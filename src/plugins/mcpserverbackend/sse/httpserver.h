@@ -5,6 +5,8 @@
 #include <QtNetwork/QNetworkRequest>
 #include <QtCore/QSet>
 #include <QtCore/QHash>
+#include <QtCore/QJsonValue>
+#include <QtCore/QList>
 
 class HttpServer : public QMcpAbstractHttpServer
 {
@@ -21,15 +23,22 @@ public:
     Q_INVOKABLE QByteArray postMessages(const QNetworkRequest &request, const QByteArray &body);
     Q_INVOKABLE QByteArray postMcp(const QNetworkRequest &request, const QByteArray &body);
 
+    bool hasEventStream(const QUuid &session) const;
+
 public slots:
-    void send(const QUuid &session, const QJsonObject &object);
-    void sendWithHeader(const QUuid &session, const QJsonObject &object);
+    void send(const QUuid &session, const QByteArray &data);
+    void sendResponse(const QUuid &session, const QList<QJsonValue> &ids, const QByteArray &data);
+    void closeSession(const QUuid &session);
 
 signals:
     void newSession(const QUuid &session);
-    void received(const QUuid &session, const QJsonObject &object);
+    void sessionClosed(const QUuid &session);
+    void received(const QUuid &session, const QByteArray &message);
 
 private:
+    void sendWithHeader(const QUuid &session, const QList<QJsonValue> &ids, const QByteArray &data);
+    QByteArray sessionNotFound(const QNetworkRequest &request, const QUuid &session);
+
     class Private;
     QScopedPointer<Private> d;
 };
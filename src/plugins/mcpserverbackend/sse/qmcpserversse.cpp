@@ -3,11 +3,10 @@
 
 #include "qmcpserversse.h"
 #include "httpserver.h"
+#include <QtMcpServer/private/qmcpspscqueue_p.h>
 #include <QtCore/QDebug>
-#include <QtCore/QJsonDocument>
-#include <QtCore/QJsonObject>
-#include <QtCore/QJsonParseError>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QThread>
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
 
@@ -19,31 +18,108 @@ class QMcpServerSse::Private
 {
 public:
     Private(QMcpServerSse *parent);
+    ~Private();
+
+    // what the I/O thread hands over, in order
+    struct Event {
+        enum Type {
+            Message,
+            Response,
+            NewSession,
+            SessionClosed,
+        };
+        QUuid session;
+        QByteArray message;
+        Type type = Message;
+        // of a new session, whether it has an event stream
+        bool eventStream = true;
+        // of a response, the requests it answers
+        QList<QJsonValue> ids;
+    };
 
 private:
     QMcpServerSse *q;
 public:
-    QTcpServer tcpServer;
-    HttpServer httpServer;
+    // the sockets are served by a thread of their own
+    QThread ioThread;
+    QTcpServer *tcpServer = nullptr;
+    HttpServer *httpServer = nullptr;
+    QMcpSpscChannel<Event> *inbound = nullptr;
+    QMcpSpscChannel<Event> *outbound = nullptr;
     QSet<QUuid> uuids;
+    // the streamable HTTP sessions, only answered on their POSTs
+    QSet<QUuid> withoutEventStream;
 };
 
 QMcpServerSse::Private::Private(QMcpServerSse *parent)
     : q(parent)
 {
-    connect(&httpServer, &HttpServer::newSession, q, [this](const QUuid &uuid) {
-        uuids.insert(uuid);
+    inbound = new QMcpSpscChannel<Event>([this](Event &&event) {
+        switch (event.type) {
+        case Event::NewSession:
+            uuids.insert(event.session);
+            if (!event.eventStream)
+                withoutEventStream.insert(event.session);
+            emit q->newSessionStarted(event.session);
+            break;
+        case Event::SessionClosed:
+            // closed by the client or by closeSession()
+            withoutEventStream.remove(event.session);
+            if (uuids.remove(event.session))
+                emit q->sessionClosed(event.session);
+            break;
+        case Event::Message:
+            emit q->messageReceived(event.session, event.message);
+            break;
+        case Event::Response:
+            // responses are only written
+            Q_UNREACHABLE();
+        }
+    }, q);
+
+    tcpServer = new QTcpServer;
+    httpServer = new HttpServer;
+    outbound = new QMcpSpscChannel<Event>([this](Event &&event) {
+        // a session is closed after the messages sent to it before
+        if (event.type == Event::SessionClosed)
+            httpServer->closeSession(event.session);
+        else if (event.type == Event::Response)
+            httpServer->sendResponse(event.session, event.ids, event.message);
+        else
+            httpServer->send(event.session, event.message);
     });
+    ioThread.setObjectName("QMcpServerSse"_L1);
+    for (QObject *object : std::initializer_list<QObject *> { tcpServer, httpServer, outbound }) {
+        object->moveToThread(&ioThread);
+        connect(&ioThread, &QThread::finished, object, &QObject::deleteLater);
+    }
+
+    // direct, all are emitted on the I/O thread; new and closed sessions
+    // pass the same queue as messages so they keep their order
+    connect(httpServer, &HttpServer::newSession, httpServer, [this](const QUuid &session) {
+        inbound->post(Event { session, QByteArray(), Event::NewSession, httpServer->hasEventStream(session) });
+    }, Qt::DirectConnection);
+    connect(httpServer, &HttpServer::sessionClosed, httpServer, [this](const QUuid &session) {
+        inbound->post(Event { session, QByteArray(), Event::SessionClosed });
+    }, Qt::DirectConnection);
+    connect(httpServer, &HttpServer::received, httpServer, [this](const QUuid &session, const QByteArray &message) {
+        inbound->post(Event { session, message });
+    }, Qt::DirectConnection);
+    connect(&ioThread, &QThread::finished, outbound, [this]() { outbound->flush(); });
+    ioThread.start();
 }
 
-QMcpServerSse::QMcpServerSse(QObject *parent)
-    : QMcpServerBackendInterface(parent)
-    , d(new Private(this))
+QMcpServerSse::Private::~Private()
 {
-    connect(&d->httpServer, &HttpServer::newSession, this, &QMcpServerSse::newSessionStarted);
-    connect(&d->httpServer, &HttpServer::received, this, &QMcpServerSse::received);
+    ioThread.quit();
+    ioThread.wait();
 }
 
+QMcpServerSse::QMcpServerSse(QObject *parent)
+    : QMcpServerBackendInterfaceV2(parent)
+    , d(new Private(this))
+{}
+
 QMcpServerSse::~QMcpServerSse() = default;
 
 void QMcpServerSse::start(const QString &server)
@@ -57,24 +133,47 @@ void QMcpServerSse::start(const QString &server)
         address = QHostAddress(server.left(colon));
         port = server.mid(colon + 1).toInt();
     }
-    if (!d->tcpServer.listen(address, port) || !d->httpServer.bind(&d->tcpServer)) {
+    // the sockets have to be set up on their thread
+    bool ok = false;
+    quint16 serverPort = 0;
+    QMetaObject::invokeMethod(d->tcpServer, [&]() {
+        ok = d->tcpServer->listen(address, port) && d->httpServer->bind(d->tcpServer);
+        serverPort = d->tcpServer->serverPort();
+    }, Qt::BlockingQueuedConnection);
+    if (!ok) {
         qWarning() << "server start failed." << server;
         return;
     }
-    qCDebug(lcQMcpServerSsePlugin) << "Listening on port" << d->tcpServer.serverPort();
+    qCDebug(lcQMcpServerSsePlugin) << "Listening on port" << serverPort;
     emit started();
 }
 
-void QMcpServerSse::send(const QUuid &session, const QJsonObject &object)
+bool QMcpServerSse::canNotify(const QUuid &session) const
+{
+    return !d->withoutEventStream.contains(session);
+}
+
+void QMcpServerSse::writeMessage(const QUuid &session, QByteArray &&message)
 {
     qCDebug(lcQMcpServerSsePlugin) << "Sending message:" << session;
 
-    d->httpServer.send(session, object);
+    d->outbound->post(Private::Event { session, std::move(message) });
+}
+
+void QMcpServerSse::writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&message)
+{
+    qCDebug(lcQMcpServerSsePlugin) << "Sending response:" << session << ids;
+
+    Private::Event event { session, std::move(message), Private::Event::Response };
+    event.ids = ids;
+    d->outbound->post(std::move(event));
 }
 
-void QMcpServerSse::notify(const QUuid &session, const QJsonObject &object)
+void QMcpServerSse::closeSession(const QUuid &session)
 {
-    send(session, object);
+    qCDebug(lcQMcpServerSsePlugin) << "Closing session:" << session;
+
+    d->outbound->post(Private::Event { session, QByteArray(), Private::Event::SessionClosed });
 }
 
 QT_END_NAMESPACE
@@ -6,21 +6,23 @@
 
 #include <QtMcpServer/qmcpserverbackendplugin.h>
 #include <QtMcpServer/qmcpserverbackendinterface.h>
-#include <QtCore/QJsonObject>
 
 QT_BEGIN_NAMESPACE
 
-class QMcpServerSse : public QMcpServerBackendInterface
+class QMcpServerSse : public QMcpServerBackendInterfaceV2
 {
     Q_OBJECT
 public:
     explicit QMcpServerSse(QObject *parent = nullptr);
     ~QMcpServerSse() override;
 
+    bool canNotify(const QUuid &session) const override;
+    void writeMessage(const QUuid &session, QByteArray &&message) override;
+    void writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&message) override;
+
 public slots:
     void start(const QString &server) override;
-    void send(const QUuid &session, const QJsonObject &object) override;
-    void notify(const QUuid &session, const QJsonObject &object) override;
+    void closeSession(const QUuid &session) override;
 
 private:
     class Private;
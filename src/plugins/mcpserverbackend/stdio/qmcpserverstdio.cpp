@@ -2,12 +2,12 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qmcpserverstdio.h"
+#include <QtMcpCommon/qmcpcbor.h>
+#include <QtMcpServer/private/qmcpspscqueue_p.h>
 #include <QtCore/QLoggingCategory>
-#include <QtCore/QJsonDocument>
-#include <QtCore/QJsonParseError>
-#include <QtCore/QJsonObject>
 #include <QtCore/QDebug>
 #include <QtCore/QSocketNotifier>
+#include <QtCore/QThread>
 #ifdef Q_OS_WIN
 #include <io.h>
 #include <fcntl.h>
@@ -26,28 +26,71 @@ class QMcpServerStdio::Private
 {
 public:
     Private(QMcpServerStdio *parent);
+    ~Private();
 
-private:
+    // runs on the I/O thread
     void readData(QSocketDescriptor socket, QSocketNotifier::Type activationEvent);
 
 private:
     QMcpServerStdio *q;
-    QSocketNotifier *notifier;
     const QUuid uuid = QUuid::createUuid();
+    // stdin and stdout are served by a thread of their own, the messages
+    // pass the queues below; a null message marks the end of the input
+    QThread ioThread;
+    QObject *reader = nullptr;
+    QSocketNotifier *notifier = nullptr;
+    QByteArray data;
+public:
+    QMcpSpscChannel<QByteArray> *inbound = nullptr;
+    QMcpSpscChannel<QByteArray> *outbound = nullptr;
 };
 
 QMcpServerStdio::Private::Private(QMcpServerStdio *parent)
     : q(parent)
-    , notifier(new QSocketNotifier(STDIN_FILENO, QSocketNotifier::Read, q))
 {
 #ifdef Q_OS_WIN
     // Set stdin to binary mode to avoid CRLF translation
     _setmode(_fileno(stdin), _O_BINARY);
 #endif
     QMetaObject::invokeMethod(q, "newSessionStarted", Qt::QueuedConnection, Q_ARG(QUuid, uuid));
-    connect(notifier, &QSocketNotifier::activated, q, [this](QSocketDescriptor socket, QSocketNotifier::Type activationEvent) {
-        readData(socket, activationEvent);
+
+    inbound = new QMcpSpscChannel<QByteArray>([this](QByteArray &&message) {
+        if (message.isNull()) {
+            // the only session ends with the input
+            emit q->sessionClosed(uuid);
+            emit q->finished();
+        } else {
+            emit q->messageReceived(uuid, message);
+        }
+    }, q);
+
+    outbound = new QMcpSpscChannel<QByteArray>([](QByteArray &&message) {
+        std::cout.write(message.constData(), message.size());
+        std::cout.flush();
+    });
+    reader = new QObject;
+    ioThread.setObjectName("QMcpServerStdio"_L1);
+    outbound->moveToThread(&ioThread);
+    reader->moveToThread(&ioThread);
+
+    // the notifier has to be created on the thread it is used on
+    connect(&ioThread, &QThread::started, reader, [this]() {
+        notifier = new QSocketNotifier(STDIN_FILENO, QSocketNotifier::Read, reader);
+        connect(notifier, &QSocketNotifier::activated, reader, [this](QSocketDescriptor socket, QSocketNotifier::Type activationEvent) {
+            readData(socket, activationEvent);
+        });
     });
+    // write what is left before the objects are deleted on their thread
+    connect(&ioThread, &QThread::finished, outbound, [this]() { outbound->flush(); });
+    connect(&ioThread, &QThread::finished, outbound, &QObject::deleteLater);
+    connect(&ioThread, &QThread::finished, reader, &QObject::deleteLater);
+    ioThread.start();
+}
+
+QMcpServerStdio::Private::~Private()
+{
+    ioThread.quit();
+    ioThread.wait();
 }
 
 void QMcpServerStdio::Private::readData(QSocketDescriptor socket, QSocketNotifier::Type type) {
@@ -61,72 +104,72 @@ void QMcpServerStdio::Private::readData(QSocketDescriptor socket, QSocketNotifie
         return;
     }
     if (bytesRead == 0) {
-        // EOF reached (no more data)
-        emit q->finished();
+        // EOF reached (no more data), it stays readable
+        notifier->setEnabled(false);
+        inbound->post(QByteArray());
         return;
     }
 
     // Append to buffer (may accumulate partial data from previous reads)
-    static QByteArray data;
     data.append(buffer, static_cast<int>(bytesRead));
 
-    // Process complete lines in the buffer (assuming JSON messages are newline-terminated)
+    // Process complete messages in the buffer. JSON messages are newline-terminated,
+    // CBOR messages tell their own length.
     while (true) {
+        if (QMcpCbor::isCbor(data)) {
+            const auto size = QMcpCbor::messageSize(data);
+            if (size == 0)
+                break;
+            if (size < 0) {
+                // nothing after malformed CBOR can be trusted
+                data.clear();
+                break;
+            }
+            inbound->post(data.first(size));
+            data.remove(0, size);
+            continue;
+        }
+
         int newlineIndex = data.indexOf('\n');
         if (newlineIndex < 0)
             break;
 
-        QByteArray lineData = data.left(newlineIndex);
-        data.remove(0, newlineIndex + 1);  // remove this line from buffer
-
         // Trim to avoid empty lines
-        QByteArray jsonData = lineData.trimmed();
-        if (jsonData.isEmpty()) {
-            continue;
-        }
-
-        // Parse JSON data
-        QJsonParseError parseError;
-        QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonData, &parseError);
-        if (parseError.error != QJsonParseError::NoError) {
-            qWarning() << "JSON parse error: "
-                       << parseError.errorString().toStdString();
-            continue;
-        }
-
-        if (!jsonDoc.isObject()) {
-            qWarning() << "JSON is not an object" << jsonDoc;
+        auto message = data.first(newlineIndex).trimmed();
+        data.remove(0, newlineIndex + 1);  // remove this line from buffer
+        if (message.isEmpty())
             continue;
-        }
 
-        emit q->received(uuid, jsonDoc.object());
+        inbound->post(std::move(message));
     }
 }
 
 QMcpServerStdio::QMcpServerStdio(QObject *parent)
-    : QMcpServerBackendInterface(parent)
+    : QMcpServerBackendInterfaceV2(parent)
     , d(new Private(this))
 {}
 
 QMcpServerStdio::~QMcpServerStdio() = default;
 
+bool QMcpServerStdio::supportsCbor() const
+{
+    return true;
+}
+
 void QMcpServerStdio::start(const QString &server)
 {
     Q_UNUSED(server);
     emit started();
 }
 
-void QMcpServerStdio::send(const QUuid &session, const QJsonObject &object)
+void QMcpServerStdio::writeMessage(const QUuid &session, QByteArray &&message)
 {
     Q_UNUSED(session)
-    const auto data = QJsonDocument(object).toJson(QJsonDocument::Compact);
-    qDebug() << data;
-    std::cout << data.toStdString() << std::endl;
-}
-
-void QMcpServerStdio::notify(const QUuid &session, const QJsonObject &object)
-{
-    send(session, object);
+    qCDebug(lcQMcpServerStdioPlugin) << message;
+    // CBOR needs no terminator, a newline would be read as a value
+    if (!QMcpCbor::isCbor(message))
+        message.append('\n');
+    d->outbound->post(std::move(message));
 }
 
 QT_END_NAMESPACE
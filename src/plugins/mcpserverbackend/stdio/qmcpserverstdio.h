@@ -6,21 +6,21 @@
 
 #include <QtMcpServer/qmcpserverbackendplugin.h>
 #include <QtMcpServer/qmcpserverbackendinterface.h>
-#include <QtCore/QJsonObject>
 
 QT_BEGIN_NAMESPACE
 
-class QMcpServerStdio : public QMcpServerBackendInterface
+class QMcpServerStdio : public QMcpServerBackendInterfaceV2
 {
     Q_OBJECT
 public:
     explicit QMcpServerStdio(QObject *parent = nullptr);
     ~QMcpServerStdio() override;
 
+    bool supportsCbor() const override;
+    void writeMessage(const QUuid &session, QByteArray &&message) override;
+
 public slots:
     void start(const QString &server) override;
-    void send(const QUuid &session, const QJsonObject &object) override;
-    void notify(const QUuid &session, const QJsonObject &object) override;
 
 private:
     class Private;
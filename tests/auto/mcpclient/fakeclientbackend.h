@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef FAKECLIENTBACKEND_H
+#define FAKECLIENTBACKEND_H
+
+#include <QtCore/QJsonDocument>
+#include <QtMcpClient/qmcpclientbackendinterface.h>
+#include <QtMcpClient/qmcpclientbackendplugin.h>
+
+QT_BEGIN_NAMESPACE
+
+// Backends without a transport, built into the tests as a static plugin.
+// The tests inject the messages of a server and inspect what the client
+// sent.
+
+// implements the first interface, exchanging QJsonObject
+class FakeClientBackend : public QMcpClientBackendInterface
+{
+    Q_OBJECT
+public:
+    using QMcpClientBackendInterface::QMcpClientBackendInterface;
+
+    void start(const QString &) override { emit started(); }
+    void send(const QJsonObject &object) override { sent.append(object); }
+    void notify(const QJsonObject &object) override { sent.append(object); }
+
+    void receive(const QJsonObject &object) { emit received(object); }
+
+    QList<QJsonObject> sent;
+};
+
+// implements the second interface, exchanging serialized messages
+class FakeClientBackendV2 : public QMcpClientBackendInterfaceV2
+{
+    Q_OBJECT
+public:
+    using QMcpClientBackendInterfaceV2::QMcpClientBackendInterfaceV2;
+
+    void start(const QString &) override { emit started(); }
+    void writeMessage(QByteArray &&message) override { written.append(std::move(message)); }
+
+    void receive(const QByteArray &message) { emit messageReceived(message); }
+
+    // the last written message as JSON
+    QJsonDocument lastDocument() const
+    {
+        return written.isEmpty() ? QJsonDocument() : QJsonDocument::fromJson(written.last());
+    }
+
+    QList<QByteArray> written;
+};
+
+class FakeClientBackendPlugin : public QMcpClientBackendPlugin
+{
+    Q_OBJECT
+    Q_PLUGIN_METADATA(IID QMcpClientBackendPluginFactoryInterface_iid FILE "fakeclientbackend.json")
+public:
+    QMcpClientBackendInterface *create(const QString &key, QObject *parent = nullptr) override
+    {
+        if (key == "fake"_L1)
+            return new FakeClientBackend(parent);
+        if (key == "fakev2"_L1)
+            return new FakeClientBackendV2(parent);
+        return nullptr;
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // FAKECLIENTBACKEND_H
@@ -6,12 +6,17 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QEventLoop>
+#include <QtCore/QJsonArray>
 #include <QtCore/QTimer>
+#include <QtCore/QtPlugin>
 
 #include <QtMcpClient/QMcpClient>
 #include <QtMcpCommon>
 
 #include "../../mcpcommon/testhelper.h"
+#include "../fakeclientbackend.h"
+
+Q_IMPORT_PLUGIN(FakeClientBackendPlugin)
 
 class tst_QMcpClient : public QObject
 {
@@ -24,6 +29,9 @@ private slots:
     void testInitialize();
     void testListTools();
     void testCallTool();
+    void testCancelRequest();
+    void testCancelLateResponse();
+    void testBatch();
 
 private:
     QMcpInitializeResult initialize();
@@ -145,5 +153,129 @@ void tst_QMcpClient::testCallTool()
     QVERIFY2(received, "Call tool request timed out");
 }
 
+void tst_QMcpClient::testCancelRequest()
+{
+    QVERIFY(!QMcpRequestHandle().isValid());
+    QVERIFY(!QMcpRequestHandle().cancel());
+
+    initialize();
+
+    QMcpCallToolRequest request;
+    auto params = request.params();
+    params.setName("longRunningOperation");
+    QJsonObject args;
+    args.insert("duration", 1);
+    args.insert("steps", 1);
+    params.setArguments(args);
+    request.setParams(params);
+
+    bool called = false;
+    const auto handle = m_client->request(request, [&](const QMcpCallToolResult &, const QMcpJSONRPCErrorError *) {
+        called = true;
+    });
+    QVERIFY(handle.isValid());
+    QVERIFY(handle.cancel("Test"_L1));
+    QVERIFY(!handle.cancel());
+
+    // the callback is not called, even if the server answers
+    QTest::qWait(2000);
+    QVERIFY(!called);
+
+    // the client is still usable
+    QEventLoop loop;
+    bool received = false;
+    m_client->request(QMcpListToolsRequest(), [&](const QMcpListToolsResult &, const QMcpJSONRPCErrorError *) {
+        received = true;
+        loop.quit();
+    });
+    QTimer::singleShot(SERVER_TIMEOUT, &loop, &QEventLoop::quit);
+    loop.exec();
+    QVERIFY2(received, "List tools request timed out");
+}
+
+void tst_QMcpClient::testCancelLateResponse()
+{
+    QMcpClient client(u"fakev2"_s);
+    auto *backend = client.findChild<FakeClientBackendV2 *>();
+    QVERIFY(backend);
+
+    int answered = 0;
+    const auto handle = client.request(QMcpPingRequest(), [&answered](const QMcpEmptyResult &, const QMcpJSONRPCErrorError *) {
+        answered++;
+    });
+    QCOMPARE(backend->written.size(), 1);
+    const auto id = backend->lastDocument().object().value("id"_L1);
+    QVERIFY(handle.cancel());
+    QCOMPARE(backend->written.size(), 2);
+    QCOMPARE(backend->lastDocument().object().value("method"_L1).toString(), u"notifications/cancelled"_s);
+
+    // the server answered before it saw the cancellation
+    const QJsonObject response {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "id"_L1, id },
+        { "result"_L1, QJsonObject() },
+    };
+    backend->receive(QJsonDocument(response).toJson(QJsonDocument::Compact));
+    QCOMPARE(answered, 0);
+    QCOMPARE(backend->written.size(), 2);
+}
+
+void tst_QMcpClient::testBatch()
+{
+    QMcpClient client(u"fakev2"_s);
+    auto *backend = client.findChild<FakeClientBackendV2 *>();
+    QVERIFY(backend);
+
+    // nothing to send
+    client.endBatch();
+    client.beginBatch();
+    client.endBatch();
+    QCOMPARE(backend->written.size(), 0);
+
+    QList<int> answered;
+    client.beginBatch();
+    client.request(QMcpPingRequest(), [&answered](const QMcpEmptyResult &, const QMcpJSONRPCErrorError *) {
+        answered.append(1);
+    });
+    client.notify(QMcpRootsListChangedNotification());
+    client.request(QMcpPingRequest(), [&answered](const QMcpEmptyResult &, const QMcpJSONRPCErrorError *) {
+        answered.append(2);
+    });
+    QCOMPARE(backend->written.size(), 0);
+    client.endBatch();
+
+    // sent as one array
+    QCOMPARE(backend->written.size(), 1);
+    const auto batch = backend->lastDocument().array();
+    QCOMPARE(batch.size(), 3);
+    QCOMPARE(batch.at(1).toObject().value("method"_L1).toString(), u"notifications/roots/list_changed"_s);
+    const auto first = batch.at(0).toObject().value("id"_L1);
+    const auto second = batch.at(2).toObject().value("id"_L1);
+    QVERIFY(first != second);
+
+    // answered in any order
+    const auto response = [](const QJsonValue &id) {
+        return QJsonObject {
+            { "jsonrpc"_L1, "2.0"_L1 },
+            { "id"_L1, id },
+            { "result"_L1, QJsonObject() },
+        };
+    };
+    backend->receive(QJsonDocument(QJsonArray { response(second), response(first) }).toJson(QJsonDocument::Compact));
+    QCOMPARE(answered, QList<int>({ 2, 1 }));
+
+    // backends of the first interface get the messages one by one
+    QMcpClient client1(u"fake"_s);
+    auto *backend1 = client1.findChild<FakeClientBackend *>();
+    QVERIFY(backend1);
+    client1.beginBatch();
+    client1.request(QMcpPingRequest());
+    client1.notify(QMcpRootsListChangedNotification());
+    QCOMPARE(backend1->sent.size(), 0);
+    client1.endBatch();
+    QCOMPARE(backend1->sent.size(), 2);
+    QCOMPARE(backend1->sent.at(0).value("method"_L1).toString(), u"ping"_s);
+}
+
 QTEST_MAIN(tst_QMcpClient)
 #include "tst_qmcpclient.moc"
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QtPlugin>
+#include <QtMcpClient/qmcpclient.h>
+#include <QtMcpCommon/QMcpEmptyResult>
+#include <QtMcpCommon/QMcpPingRequest>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtTest/QTest>
+#include "../fakeclientbackend.h"
+
+Q_IMPORT_PLUGIN(FakeClientBackendPlugin)
+
+class tst_QMcpClientBackendInterface : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void receivedObject();
+    void messageReceived();
+    void writeMessage();
+};
+
+static QJsonObject pingResponse(const QJsonValue &id)
+{
+    return QJsonObject {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "id"_L1, id },
+        { "result"_L1, QJsonObject() },
+    };
+}
+
+void tst_QMcpClientBackendInterface::receivedObject()
+{
+    QMcpClient client(u"fake"_s);
+    auto *backend = client.findChild<FakeClientBackend *>();
+    QVERIFY(backend);
+    QVERIFY(!qobject_cast<QMcpClientBackendInterfaceV2 *>(backend));
+
+    int answered = 0;
+    client.request(QMcpPingRequest(), [&answered](const QMcpEmptyResult &, const QMcpJSONRPCErrorError *error) {
+        QVERIFY(!error);
+        answered++;
+    });
+
+    // the request is handed over as an object
+    QCOMPARE(backend->sent.size(), 1);
+    const auto request = backend->sent.at(0);
+    QCOMPARE(request.value("method"_L1).toString(), u"ping"_s);
+    QVERIFY(!request.value("id"_L1).isNull());
+
+    backend->receive(pingResponse(request.value("id"_L1)));
+    QCOMPARE(answered, 1);
+}
+
+void tst_QMcpClientBackendInterface::messageReceived()
+{
+    QMcpClient client(u"fakev2"_s);
+    auto *backend = client.findChild<FakeClientBackendV2 *>();
+    QVERIFY(backend);
+
+    int answered = 0;
+    const auto callback = [&answered](const QMcpEmptyResult &, const QMcpJSONRPCErrorError *error) {
+        QVERIFY(!error);
+        answered++;
+    };
+
+    // the request is written as JSON text
+    client.request(QMcpPingRequest(), callback);
+    QCOMPARE(backend->written.size(), 1);
+    auto request = backend->lastDocument().object();
+    QCOMPARE(request.value("method"_L1).toString(), u"ping"_s);
+
+    backend->receive(QMcpJsonWriter::toJson(pingResponse(request.value("id"_L1))));
+    QCOMPARE(answered, 1);
+
+    // CBOR is read as well
+    client.request(QMcpPingRequest(), callback);
+    QCOMPARE(backend->written.size(), 2);
+    request = backend->lastDocument().object();
+    backend->receive(QMcpJsonWriter::toCbor(pingResponse(request.value("id"_L1))));
+    QCOMPARE(answered, 2);
+}
+
+void tst_QMcpClientBackendInterface::writeMessage()
+{
+    FakeClientBackendV2 backend;
+
+    // the QJsonObject slots end up in writeMessage()
+    backend.send(pingResponse(1));
+    QCOMPARE(backend.written.size(), 1);
+    QCOMPARE(backend.written.at(0), QMcpJsonWriter::toJson(pingResponse(1)));
+
+    const QJsonObject notification {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "method"_L1, "notifications/initialized"_L1 },
+    };
+    backend.notify(notification);
+    QCOMPARE(backend.written.size(), 2);
+    QCOMPARE(backend.lastDocument().object(), notification);
+}
+
+QTEST_MAIN(tst_QMcpClientBackendInterface)
+#include "tst_qmcpclientbackendinterface.moc"
@@ -5,6 +5,7 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonParseError>
 #include <QtMcpCommon/QMcpAnyOf>
+#include <QtMcpCommon/QMcpClientRequest>
 #include <QtTest/QTest>
 
 // Test gadget classes for anyOf testing
@@ -130,6 +131,9 @@ private slots:
     void convert();
     void copy_data();
     void copy();
+    void discriminator_data();
+    void discriminator();
+    void activeAlternative();
 };
 
 void tst_QMcpAnyOf::defaultValues()
@@ -221,5 +225,72 @@ void tst_QMcpAnyOf::copy()
     QCOMPARE(anyOf3.toJsonObject(), QJsonObject::fromVariantMap(expectedData));
 }
 
+void tst_QMcpAnyOf::discriminator_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QByteArray>("expectedType");
+
+    QTest::newRow("ping") << R"({
+        "jsonrpc": "2.0",
+        "id": 1,
+        "method": "ping"
+    })"_ba
+    << "pingRequest"_ba;
+
+    QTest::newRow("tools/call") << R"({
+        "jsonrpc": "2.0",
+        "id": 2,
+        "method": "tools/call",
+        "params": { "name": "echo", "arguments": { "text": "hi" } }
+    })"_ba
+    << "callToolRequest"_ba;
+
+    // members unknown to the alternative do not defeat the method lookup
+    QTest::newRow("tools/list with extension") << R"({
+        "jsonrpc": "2.0",
+        "id": 3,
+        "method": "tools/list",
+        "x-extension": true
+    })"_ba
+    << "listToolsRequest"_ba;
+}
+
+void tst_QMcpAnyOf::discriminator()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QByteArray, expectedType);
+
+    QMcpClientRequest request;
+    QVERIFY(request.fromJsonObject(QJsonDocument::fromJson(json).object()));
+    QCOMPARE(request.refType(), expectedType);
+}
+
+void tst_QMcpAnyOf::activeAlternative()
+{
+    QMcpClientRequest request;
+    QVERIFY(request.isNull());
+
+    // a default constructed alternative still becomes the active one
+    request.setPingRequest(QMcpPingRequest());
+    QCOMPARE(request.refType(), "pingRequest"_ba);
+
+    QMcpCallToolRequestParams params;
+    params.setName("echo"_L1);
+    QMcpCallToolRequest callTool;
+    callTool.setParams(params);
+    request.setCallToolRequest(callTool);
+    QCOMPARE(request.refType(), "callToolRequest"_ba);
+    QCOMPARE(request.callToolRequest().params().name(), u"echo"_s);
+
+    // other alternatives read as default constructed values
+    QCOMPARE(request.pingRequest(), QMcpPingRequest());
+
+    // copies keep the active alternative
+    const QMcpClientRequest copy = request;
+    request.setPingRequest(QMcpPingRequest());
+    QCOMPARE(copy.refType(), "callToolRequest"_ba);
+    QCOMPARE(copy.callToolRequest().params().name(), u"echo"_s);
+}
+
 QTEST_MAIN(tst_QMcpAnyOf)
 #include "tst_qmcpanyof.moc"
@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QRandomGenerator>
+#include <QtMcpCommon/QMcpImageContent>
+#include <QtMcpCommon/qmcpbase64.h>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtTest/QTest>
+
+class tst_QMcpBase64 : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+    void unpadded();
+    void invalid_data();
+    void invalid();
+    void append();
+    void content();
+    void writer();
+};
+
+static QByteArray randomData(qsizetype size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (auto &c : data)
+        c = char(QRandomGenerator::global()->bounded(256));
+    return data;
+}
+
+void tst_QMcpBase64::roundTrip_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    // every tail length around the vector block sizes
+    for (int size = 0; size <= 130; size++)
+        QTest::addRow("%d", size) << randomData(size);
+    QTest::newRow("large") << randomData(1 << 20);
+    QTest::newRow("zeros") << QByteArray(1000, '\0');
+    QTest::newRow("ones") << QByteArray(1000, '\xff');
+}
+
+void tst_QMcpBase64::roundTrip()
+{
+    QFETCH(QByteArray, data);
+
+    const auto encoded = QMcpBase64::encode(data);
+    QCOMPARE(encoded, data.toBase64());
+    QCOMPARE(encoded.size(), QMcpBase64::encodedSize(data.size()));
+
+    bool ok = false;
+    QCOMPARE(QMcpBase64::decode(encoded, &ok), data);
+    QVERIFY(ok);
+}
+
+void tst_QMcpBase64::unpadded()
+{
+    for (int size = 0; size <= 70; size++) {
+        const auto data = randomData(size);
+        const auto encoded = data.toBase64(QByteArray::OmitTrailingEquals);
+        bool ok = false;
+        QCOMPARE(QMcpBase64::decode(encoded, &ok), data);
+        QVERIFY(ok);
+    }
+}
+
+void tst_QMcpBase64::invalid_data()
+{
+    QTest::addColumn<QByteArray>("base64");
+
+    QTest::newRow("single") << "Q"_ba;
+    QTest::newRow("short padding") << "QQ="_ba;
+    QTest::newRow("excess padding") << "Q==="_ba;
+    QTest::newRow("inner padding") << "QQ==QQ=="_ba;
+    QTest::newRow("space") << "SGVsbG8g d29ybGQ="_ba;
+    QTest::newRow("url alphabet") << "SGVsbG8-_29ybGQ="_ba;
+    // invalid characters inside the blocks handled by the vector code
+    auto block = randomData(200).toBase64();
+    block[150] = '\n';
+    QTest::newRow("newline") << block;
+    block[150] = '\x80';
+    QTest::newRow("non-ascii") << block;
+}
+
+void tst_QMcpBase64::invalid()
+{
+    QFETCH(QByteArray, base64);
+
+    bool ok = true;
+    QVERIFY(QMcpBase64::decode(base64, &ok).isEmpty());
+    QVERIFY(!ok);
+}
+
+void tst_QMcpBase64::append()
+{
+    QByteArray out = "prefix:"_ba;
+    QMcpBase64::encode("Hello, world!"_ba, &out);
+    QCOMPARE(out, "prefix:SGVsbG8sIHdvcmxkIQ=="_ba);
+}
+
+void tst_QMcpBase64::content()
+{
+    const auto data = randomData(100);
+    QMcpImageContent image;
+    image.setData(data.toBase64());
+    QCOMPARE(image.decodedData(), data);
+}
+
+void tst_QMcpBase64::writer()
+{
+    const auto data = randomData(1000);
+    QMcpJsonWriter writer;
+    writer.beginObject();
+    writer.writeKey("data"_L1);
+    writer.writeBase64(data);
+    writer.endObject();
+
+    const auto object = QJsonDocument::fromJson(writer.data()).object();
+    QCOMPARE(object.value("data"_L1).toString().toLatin1(), data.toBase64());
+}
+
+QTEST_MAIN(tst_QMcpBase64)
+#include "tst_qmcpbase64.moc"
@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtMcpCommon/QMcpBuilder>
+#include <QtMcpCommon/QMcpCallToolResult>
+#include <QtMcpCommon/QMcpListToolsResult>
+#include <QtMcpCommon/QMcpTextContent>
+#include <QtMcpCommon/QMcpTool>
+#include <QtMcpCommon/QMcpToolInputSchema>
+#include <QtTest/QTest>
+
+class tst_QMcpBuilder : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void set();
+    void edit();
+    void append();
+};
+
+void tst_QMcpBuilder::set()
+{
+    QString name = u"echo"_s;
+    const auto *data = name.constData();
+    auto tool = QMcpBuilder<QMcpTool>()
+        .set(&QMcpTool::setName, std::move(name))
+        .set(&QMcpTool::setDescription, u"Echoes the input"_s)
+        .build();
+    QCOMPARE(tool.name(), u"echo"_s);
+    // moved, not copied
+    QCOMPARE(tool.name().constData(), data);
+    QCOMPARE(tool.description(), u"Echoes the input"_s);
+
+    // setters without an rvalue overload
+    auto result = QMcpBuilder<QMcpCallToolResult>()
+        .set(&QMcpCallToolResult::setIsError, true)
+        .build();
+    QVERIFY(result.isError());
+    QVERIFY(result.toJsonObject().value("isError"_L1).toBool());
+}
+
+void tst_QMcpBuilder::edit()
+{
+    QMcpTool tool;
+    tool.setName(u"echo"_s);
+    auto edited = QMcpBuilder<QMcpTool>(std::move(tool))
+        .edit(&QMcpTool::takeInputSchema, &QMcpTool::setInputSchema, [](QMcpToolInputSchema &schema) {
+            schema.appendRequired(u"text"_s);
+        })
+        .build();
+    QCOMPARE(edited.name(), u"echo"_s);
+    QCOMPARE(edited.inputSchema().required(), QList<QString> { u"text"_s });
+}
+
+void tst_QMcpBuilder::append()
+{
+    QMcpTool tool;
+    tool.setName(u"a"_s);
+    auto result = QMcpBuilder<QMcpListToolsResult>()
+        .set(&QMcpListToolsResult::appendTool, std::move(tool))
+        .set(&QMcpListToolsResult::appendTool, QMcpTool())
+        .build();
+    const auto tools = result.tools();
+    QCOMPARE(tools.size(), 2);
+    QCOMPARE(tools.at(0).name(), u"a"_s);
+
+    QMcpTextContent text;
+    text.setText(u"done"_s);
+    auto callResult = QMcpBuilder<QMcpCallToolResult>()
+        .set(&QMcpCallToolResult::appendContent, QMcpCallToolResultContent(text))
+        .build();
+    QCOMPARE(callResult.content().size(), 1);
+}
+
+QTEST_MAIN(tst_QMcpBuilder)
+#include "tst_qmcpbuilder.moc"
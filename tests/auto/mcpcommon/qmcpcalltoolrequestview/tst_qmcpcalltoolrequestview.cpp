@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonDocument>
+#include <QtMcpCommon/QMcpCallToolRequest>
+#include <QtMcpCommon/qmcpcalltoolrequestview.h>
+#include <QtTest/QTest>
+
+class tst_QMcpCallToolRequestView : public QObject
+{
+    Q_OBJECT
+private slots:
+    void read_data();
+    void read();
+    void missingFields();
+    void toGadget();
+};
+
+void tst_QMcpCallToolRequestView::read_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("arguments") << R"({
+        "jsonrpc": "2.0",
+        "id": 1,
+        "method": "tools/call",
+        "params": {
+            "name": "processImage",
+            "arguments": { "width": 800, "filters": ["blur", "sharpen"] }
+        }
+    })"_ba;
+    QTest::newRow("string id") << R"({
+        "jsonrpc": "2.0",
+        "id": "abc",
+        "method": "tools/call",
+        "params": { "name": "echo" }
+    })"_ba;
+}
+
+void tst_QMcpCallToolRequestView::read()
+{
+    QFETCH(QByteArray, json);
+    const auto object = QJsonDocument::fromJson(json).object();
+
+    QMcpCallToolRequest request;
+    QVERIFY(request.fromJsonObject(object));
+    const QMcpCallToolRequestView view(object);
+
+    // the view reads the same values as the parsed gadget
+    QCOMPARE(view.id(), request.id());
+    QCOMPARE(view.method(), request.method());
+    QCOMPARE(view.params().name(), request.params().name());
+    QCOMPARE(view.params().arguments(), request.params().arguments());
+}
+
+void tst_QMcpCallToolRequestView::missingFields()
+{
+    const QMcpCallToolRequestView view;
+    QVERIFY(view.isEmpty());
+    QVERIFY(view.id().isNull());
+    QVERIFY(view.params().name().isEmpty());
+    QVERIFY(view.params().arguments().isEmpty());
+}
+
+void tst_QMcpCallToolRequestView::toGadget()
+{
+    const auto object = QJsonDocument::fromJson(R"({
+        "jsonrpc": "2.0",
+        "id": 2,
+        "method": "tools/call",
+        "params": { "name": "echo", "arguments": { "text": "hi" } }
+    })"_ba).object();
+
+    const QMcpCallToolRequestView view(object);
+    const auto request = view.toGadget<QMcpCallToolRequestView::Gadget>();
+    QCOMPARE(request.params().name(), u"echo"_s);
+    QCOMPARE(request.toJsonObject(), object);
+}
+
+QTEST_MAIN(tst_QMcpCallToolRequestView)
+#include "tst_qmcpcalltoolrequestview.moc"
@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QCborArray>
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#include <QtCore/QJsonArray>
+#include <QtCore/QRegularExpression>
+#include <QtMcpCommon/QMcpAudioContent>
+#include <QtMcpCommon/QMcpBlobResourceContents>
+#include <QtMcpCommon/QMcpTool>
+#include <QtMcpCommon/qmcpbase64.h>
+#include <QtMcpCommon/qmcpcbor.h>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtTest/QTest>
+
+class tst_QMcpCbor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void isCbor();
+    void jsonObject();
+    void gadget();
+    void blob();
+    void audio();
+    void stream();
+    void invalid();
+};
+
+void tst_QMcpCbor::isCbor()
+{
+    QVERIFY(QMcpCbor::isCbor(QMcpJsonWriter::toCbor(QJsonObject())));
+    QVERIFY(QMcpCbor::isCbor(QMcpJsonWriter::toCbor(QJsonObject { { "a"_L1, 1 } })));
+    QVERIFY(!QMcpCbor::isCbor(QMcpJsonWriter::toJson(QJsonObject { { "a"_L1, 1 } })));
+    QVERIFY(!QMcpCbor::isCbor(QByteArray()));
+}
+
+void tst_QMcpCbor::jsonObject()
+{
+    const QJsonObject object {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "id"_L1, 42 },
+        { "negative"_L1, -7 },
+        { "large"_L1, qint64(1) << 40 },
+        { "fraction"_L1, 0.1 },
+        { "half"_L1, 0.5 },
+        { "flag"_L1, true },
+        { "nothing"_L1, QJsonValue() },
+        { "text"_L1, u"Grüße \"quoted\"\n"_s },
+        { "list"_L1, QJsonArray { 1, "two"_L1, QJsonObject { { "three"_L1, 3 } } } },
+        { "empty"_L1, QJsonObject() },
+    };
+
+    const auto cbor = QMcpJsonWriter::toCbor(object);
+    // readable by any CBOR decoder
+    QCOMPARE(QCborValue::fromCbor(cbor).toMap().toJsonObject(), object);
+
+    bool ok = false;
+    QCOMPARE(QMcpCbor::toJsonObject(cbor, &ok), object);
+    QVERIFY(ok);
+
+    // smaller than the JSON text
+    QVERIFY(cbor.size() < QMcpJsonWriter::toJson(object).size());
+}
+
+void tst_QMcpCbor::gadget()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    tool.setDescription("Echoes the input"_L1);
+
+    const auto cbor = QMcpJsonWriter::toCbor(tool);
+    QCOMPARE(QMcpCbor::toJsonObject(cbor), tool.toJsonObject());
+    QCOMPARE(QMcpJsonWriter::encode(tool, QtMcp::Encoding::Cbor), cbor);
+    QCOMPARE(QMcpJsonWriter::encode(tool, QtMcp::Encoding::Json), QMcpJsonWriter::toJson(tool));
+
+    QMcpTool parsed;
+    QVERIFY(parsed.fromJsonObject(QMcpCbor::toJsonObject(cbor)));
+    QCOMPARE(parsed, tool);
+}
+
+void tst_QMcpCbor::blob()
+{
+    QByteArray data;
+    for (int i = 0; i < 1000; i++)
+        data.append(char(i * 7));
+
+    QMcpBlobResourceContents contents;
+    contents.setUri(QUrl("file:///data.bin"_L1));
+    contents.setBlob(QMcpBase64::encode(data));
+
+    const auto cbor = QMcpJsonWriter::toCbor(contents);
+    // the blob is carried as raw bytes
+    const auto map = QCborValue::fromCbor(cbor).toMap();
+    QVERIFY(map.value("blob"_L1).isByteArray());
+    QCOMPARE(map.value("blob"_L1).toByteArray(), data);
+    QVERIFY(cbor.size() < data.size() + 100);
+
+    // and read back as base64 text
+    QMcpBlobResourceContents parsed;
+    QVERIFY(parsed.fromJsonObject(QMcpCbor::toJsonObject(cbor)));
+    QCOMPARE(parsed.blob(), contents.blob());
+    QCOMPARE(parsed.decodedBlob(), data);
+
+    // the JSON text still holds base64
+    QCOMPARE(contents.toJsonObject().value("blob"_L1).toString().toLatin1(), contents.blob());
+}
+
+void tst_QMcpCbor::audio()
+{
+    const auto data = QByteArray("RIFF....WAVEfmt ");
+    QMcpAudioContent audio;
+    audio.setData(QMcpBase64::encode(data));
+    audio.setMimeType("audio/wav"_L1);
+
+    const auto cbor = QMcpJsonWriter::toCbor(audio);
+    const auto map = QCborValue::fromCbor(cbor).toMap();
+    QCOMPARE(map.value("data"_L1).toByteArray(), data);
+    QCOMPARE(map.value("type"_L1).toString(), u"audio"_s);
+    QCOMPARE(QMcpCbor::toJsonObject(cbor), audio.toJsonObject());
+}
+
+void tst_QMcpCbor::stream()
+{
+    const QJsonObject first { { "method"_L1, "ping"_L1 }, { "id"_L1, 1 } };
+    const QJsonObject second { { "method"_L1, "notifications/initialized"_L1 } };
+    const auto firstCbor = QMcpJsonWriter::toCbor(first);
+    const auto stream = firstCbor + QMcpJsonWriter::toCbor(second);
+
+    QJsonObject message;
+    // incomplete
+    QCOMPARE(QMcpCbor::read(QByteArrayView(stream).first(firstCbor.size() - 1), &message), 0);
+    QCOMPARE(QMcpCbor::read(QByteArrayView(), &message), 0);
+
+    auto size = QMcpCbor::read(stream, &message);
+    QCOMPARE(size, firstCbor.size());
+    QCOMPARE(message, first);
+
+    size = QMcpCbor::read(QByteArrayView(stream).sliced(size), &message);
+    QCOMPARE(size, stream.size() - firstCbor.size());
+    QCOMPARE(message, second);
+
+    // the size is found without decoding
+    QCOMPARE(QMcpCbor::messageSize(stream), firstCbor.size());
+    QCOMPARE(QMcpCbor::messageSize(QByteArrayView(stream).first(firstCbor.size() - 1)), 0);
+    QCOMPARE(QMcpCbor::messageSize(QByteArrayView(stream).sliced(firstCbor.size())), stream.size() - firstCbor.size());
+}
+
+void tst_QMcpCbor::invalid()
+{
+    QJsonObject message;
+    // an array instead of a map
+    QTest::ignoreMessage(QtWarningMsg, "CBOR message is not a map");
+    QCOMPARE(QMcpCbor::read(QCborValue(QCborArray { 1 }).toCbor(), &message), -1);
+    QTest::ignoreMessage(QtWarningMsg, "CBOR message is not a map");
+    QCOMPARE(QMcpCbor::messageSize(QCborValue(QCborArray { 1 }).toCbor()), -1);
+
+    bool ok = true;
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("CBOR parse error"));
+    // a map of one entry holding a reserved initial byte
+    QMcpCbor::toJsonObject(QByteArray::fromHex("a16161fc"), &ok);
+    QVERIFY(!ok);
+}
+
+QTEST_MAIN(tst_QMcpCbor)
+#include "tst_qmcpcbor.moc"
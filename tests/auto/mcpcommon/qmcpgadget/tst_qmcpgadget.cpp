@@ -0,0 +1,299 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QHash>
+#include <QtMcpCommon/private/qmcpgadget_p.h>
+#include <QtMcpCommon/QMcpCallToolResult>
+#include <QtMcpCommon/QMcpCallToolResultContent>
+#include <QtMcpCommon/QMcpImageContent>
+#include <QtMcpCommon/QMcpJsonWriter>
+#include <QtMcpCommon/QMcpListToolsResult>
+#include <QtMcpCommon/QMcpTextContent>
+#include <QtMcpCommon/QMcpTool>
+#include <QtMcpCommon/QMcpToolInputSchema>
+#include <QtTest/QTest>
+
+class tst_QMcpGadget : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void listElements();
+    void repeatedConversion_data();
+    void repeatedConversion();
+    void unmodifiedProperties();
+    void modifiedProperties();
+    void moveSetters();
+    void takeProperty();
+    void appendToList();
+    void equality();
+    void hashing();
+    void gadgetAsKey();
+    void generatedSerializers_data();
+    void generatedSerializers();
+};
+
+void tst_QMcpGadget::listElements()
+{
+    const auto json = R"({
+        "tools": [
+            { "name": "a", "inputSchema": { "type": "object" } },
+            { "name": "b", "description": "second", "inputSchema": { "type": "object" } }
+        ]
+    })"_ba;
+    const auto object = QJsonDocument::fromJson(json).object();
+
+    QMcpListToolsResult result;
+    QVERIFY(result.fromJsonObject(object));
+    const auto tools = result.tools();
+    QCOMPARE(tools.size(), 2);
+
+    // elements are real QMcpTool instances, not sliced base gadgets
+    const auto array = object.value("tools"_L1).toArray();
+    QCOMPARE(tools.at(0).metaObject(), &QMcpTool::staticMetaObject);
+    QCOMPARE(tools.at(0).toJsonObject(), array.at(0).toObject());
+    QCOMPARE(tools.at(1).toJsonObject(), array.at(1).toObject());
+}
+
+void tst_QMcpGadget::repeatedConversion_data()
+{
+    QTest::addColumn<QtMcp::ProtocolVersion>("protocolVersion");
+
+    QTest::newRow("2024-11-05") << QtMcp::ProtocolVersion::v2024_11_05;
+    QTest::newRow("2025-03-26") << QtMcp::ProtocolVersion::v2025_03_26;
+}
+
+void tst_QMcpGadget::repeatedConversion()
+{
+    QFETCH(QtMcp::ProtocolVersion, protocolVersion);
+
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    tool.setDescription("Echoes the input"_L1);
+
+    const auto first = tool.toJsonObject(protocolVersion);
+    for (int i = 0; i < 3; i++)
+        QCOMPARE(tool.toJsonObject(protocolVersion), first);
+
+    QMcpTool copy;
+    QVERIFY(copy.fromJsonObject(first, protocolVersion));
+    QCOMPARE(copy.toJsonObject(protocolVersion), first);
+}
+
+void tst_QMcpGadget::unmodifiedProperties()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+
+    const auto object = tool.toJsonObject();
+    QVERIFY(object.contains("name"_L1));
+    QVERIFY(object.contains("inputSchema"_L1));
+    QVERIFY(!object.contains("description"_L1));
+}
+
+void tst_QMcpGadget::modifiedProperties()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    tool.setDescription("Echoes the input"_L1);
+
+    // copies share the modified state
+    const QMcpTool copy = tool;
+    QCOMPARE(copy.toJsonObject().value("description"_L1).toString(), u"Echoes the input"_s);
+
+    // an explicitly set value is serialized even when it equals the default
+    tool.setDescription(QString());
+    QVERIFY(tool.toJsonObject().contains("description"_L1));
+    QCOMPARE(copy.toJsonObject().value("description"_L1).toString(), u"Echoes the input"_s);
+
+    // parsed values are serialized again
+    QMcpTool parsed;
+    QVERIFY(parsed.fromJsonObject(copy.toJsonObject()));
+    QCOMPARE(parsed.toJsonObject(), copy.toJsonObject());
+}
+
+void tst_QMcpGadget::moveSetters()
+{
+    QMcpTool tool;
+    QString name = u"echo"_s;
+    const auto *data = name.constData();
+    tool.setName(std::move(name));
+    QCOMPARE(tool.name(), u"echo"_s);
+    // the string data is moved, not copied
+    QCOMPARE(tool.name().constData(), data);
+    QVERIFY(tool.toJsonObject().contains("name"_L1));
+
+    // once modified, a value is moved in without comparing it
+    QString same = u"echo"_s;
+    const auto *sameData = same.constData();
+    tool.setName(std::move(same));
+    QCOMPARE(tool.name().constData(), sameData);
+
+    // moving in an equal value does not mark the property as modified
+    QMcpTool other;
+    other.setDescription(QString());
+    QVERIFY(!other.toJsonObject().contains("description"_L1));
+}
+
+void tst_QMcpGadget::takeProperty()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    QMcpToolInputSchema inputSchema;
+    inputSchema.setRequired({ u"text"_s });
+    tool.setInputSchema(inputSchema);
+
+    const QMcpTool copy = tool;
+    auto taken = tool.takeInputSchema();
+    QCOMPARE(taken.required(), QList<QString> { u"text"_s });
+    QVERIFY(tool.inputSchema().required().isEmpty());
+    // copies are not affected
+    QCOMPARE(copy.inputSchema().required(), QList<QString> { u"text"_s });
+
+    taken.appendRequired(u"count"_s);
+    tool.setInputSchema(std::move(taken));
+    QCOMPARE(tool.inputSchema().required(), (QList<QString> { u"text"_s, u"count"_s }));
+
+    // a taken property is left out until it is set again
+    tool.setDescription("Echoes the input"_L1);
+    QVERIFY(tool.toJsonObject().contains("description"_L1));
+    QCOMPARE(tool.takeDescription(), u"Echoes the input"_s);
+    QVERIFY(!tool.toJsonObject().contains("description"_L1));
+    tool.setDescription("Echoes the input"_L1);
+    QVERIFY(tool.toJsonObject().contains("description"_L1));
+}
+
+void tst_QMcpGadget::appendToList()
+{
+    QMcpListToolsResult result;
+    QMcpTool tool;
+    tool.setName("a"_L1);
+    result.appendTool(tool);
+    result.appendTool(QMcpTool());
+    result.emplaceTool().setName("c"_L1);
+
+    const auto tools = result.tools();
+    QCOMPARE(tools.size(), 3);
+    QCOMPARE(tools.at(0).name(), u"a"_s);
+    QCOMPARE(tools.at(2).name(), u"c"_s);
+
+    const auto array = result.toJsonObject().value("tools"_L1).toArray();
+    QCOMPARE(array.size(), 3);
+    QCOMPARE(array.at(2).toObject().value("name"_L1).toString(), u"c"_s);
+}
+
+void tst_QMcpGadget::equality()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    QMcpTool other;
+    other.setName("echo"_L1);
+    QCOMPARE(tool, other);
+
+    other.setDescription("Echoes the input"_L1);
+    QVERIFY(tool != other);
+
+    // nested gadgets are compared member by member as well
+    QMcpToolInputSchema schema;
+    schema.setRequired({ u"text"_s });
+    tool.setInputSchema(schema);
+    QVERIFY(tool != other);
+    other.setDescription(QString());
+    other.setInputSchema(schema);
+    QCOMPARE(tool, other);
+
+    QMcpTextContent text;
+    text.setText("echo"_L1);
+    QMcpCallToolResultContent content(text);
+    QMcpCallToolResultContent otherContent(text);
+    QCOMPARE(content, otherContent);
+    text.setText("other"_L1);
+    otherContent = QMcpCallToolResultContent(text);
+    QVERIFY(content != otherContent);
+}
+
+void tst_QMcpGadget::hashing()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    QMcpTool other;
+    other.setName("echo"_L1);
+    QCOMPARE(qHash(tool), qHash(other));
+    QCOMPARE(qHash(tool, 42), qHash(other, 42));
+
+    // the memoized hash is dropped on modification
+    const auto hash = qHash(tool);
+    tool.setDescription("Echoes the input"_L1);
+    QVERIFY(qHash(tool) != hash);
+    QVERIFY(tool != other);
+    tool.setDescription(QString());
+    QCOMPARE(qHash(tool), hash);
+    QCOMPARE(tool, other);
+
+    // a copy shares the hash until it is modified
+    auto copy = tool;
+    QCOMPARE(qHash(copy), hash);
+    copy.setName("copy"_L1);
+    QVERIFY(qHash(copy) != hash);
+    QCOMPARE(qHash(tool), hash);
+}
+
+void tst_QMcpGadget::gadgetAsKey()
+{
+    QHash<QMcpTool, int> hash;
+    for (int i = 0; i < 10; i++) {
+        QMcpTool tool;
+        tool.setName(QString::number(i));
+        hash.insert(tool, i);
+    }
+    QCOMPARE(hash.size(), 10);
+
+    QMcpTool key;
+    key.setName(u"7"_s);
+    QCOMPARE(hash.value(key, -1), 7);
+    key.setName(u"10"_s);
+    QCOMPARE(hash.value(key, -1), -1);
+}
+
+void tst_QMcpGadget::generatedSerializers_data()
+{
+    repeatedConversion_data();
+}
+
+void tst_QMcpGadget::generatedSerializers()
+{
+    QFETCH(QtMcp::ProtocolVersion, protocolVersion);
+
+    const auto *plan = QMcpGadgetPlan::get(&QMcpCallToolResult::staticMetaObject, protocolVersion);
+    QVERIFY(plan->serializer);
+    // classes reimplementing the conversion keep the generic one
+    QVERIFY(!QMcpGadgetPlan::get(&QMcpImageContent::staticMetaObject, protocolVersion)->serializer);
+    QVERIFY(!QMcpGadgetPlan::get(&QMcpCallToolResultContent::staticMetaObject, protocolVersion)->serializer);
+
+    QMcpTextContent text;
+    text.setText("echo"_L1);
+    QMcpCallToolResult result;
+    result.appendContent(QMcpCallToolResultContent(text));
+
+    const auto json = R"({
+        "content": [ { "type": "text", "text": "echo" } ]
+    })"_ba;
+    const auto expected = QJsonDocument::fromJson(json).object();
+    QCOMPARE(result.toJsonObject(protocolVersion), expected);
+
+    // only modified properties are added
+    result.setIsError(true);
+    auto withError = expected;
+    withError.insert("isError"_L1, true);
+    QCOMPARE(result.toJsonObject(protocolVersion), withError);
+
+    // the writer produces the same object
+    QMcpJsonWriter writer;
+    result.writeJson(writer, protocolVersion);
+    QCOMPARE(QJsonDocument::fromJson(writer.data()).object(), withError);
+}
+
+QTEST_MAIN(tst_QMcpGadget)
+#include "tst_qmcpgadget.moc"
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QThread>
+#include <QtMcpCommon/QMcpCallToolRequest>
+#include <QtMcpCommon/QMcpCallToolResult>
+#include <QtMcpCommon/QMcpTextContent>
+#include <QtMcpCommon/qmcpgadgetarena.h>
+#include <QtTest/QTest>
+
+class tst_QMcpGadgetArena : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void allocation();
+    void outliveArena();
+    void nested();
+    void otherThread();
+    void retainedSize();
+};
+
+static QJsonObject requestObject()
+{
+    return QJsonDocument::fromJson(R"({
+        "jsonrpc": "2.0",
+        "id": 1,
+        "method": "tools/call",
+        "params": { "name": "echo", "arguments": { "text": "hi" } }
+    })"_ba).object();
+}
+
+void tst_QMcpGadgetArena::allocation()
+{
+    QMcpGadgetArena arena;
+    QCOMPARE(arena.size(), 0);
+
+    QMcpCallToolRequest request;
+    QVERIFY(request.fromJsonObject(requestObject()));
+    QVERIFY(arena.size() > 0);
+    QCOMPARE(request.toJsonObject(), requestObject());
+}
+
+void tst_QMcpGadgetArena::outliveArena()
+{
+    QMcpCallToolRequest request;
+    QMcpCallToolResult result;
+    {
+        QMcpGadgetArena arena;
+        QVERIFY(request.fromJsonObject(requestObject()));
+
+        QMcpTextContent text;
+        text.setText("hi"_L1);
+        QMcpCallToolResultContent content;
+        content.setTextContent(text);
+        result.setContent({ content });
+    }
+
+    // the gadgets keep the memory of the arena alive
+    QCOMPARE(request.toJsonObject(), requestObject());
+    QCOMPARE(result.content().first().textContent().text(), u"hi"_s);
+
+    // detaching after the arena is gone allocates normally
+    auto params = request.params();
+    params.setName("other"_L1);
+    request.setParams(params);
+    QCOMPARE(request.params().name(), u"other"_s);
+}
+
+void tst_QMcpGadgetArena::nested()
+{
+    QMcpGadgetArena outer;
+    qsizetype outerSize = 0;
+    {
+        QMcpGadgetArena inner;
+        QMcpTextContent text;
+        text.setText("inner"_L1);
+        QVERIFY(inner.size() > 0);
+        outerSize = outer.size();
+    }
+    QMcpTextContent text;
+    text.setText("outer"_L1);
+    QVERIFY(outer.size() > outerSize);
+}
+
+void tst_QMcpGadgetArena::otherThread()
+{
+    QMcpCallToolRequest request;
+    {
+        QMcpGadgetArena arena;
+        QVERIFY(request.fromJsonObject(requestObject()));
+    }
+
+    // the last reference may go away on any thread
+    QString name;
+    QScopedPointer<QThread> thread(QThread::create([&name, request = std::move(request)]() mutable {
+        name = request.params().name();
+        request = QMcpCallToolRequest();
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QCOMPARE(name, u"echo"_s);
+}
+
+void tst_QMcpGadgetArena::retainedSize()
+{
+    const auto baseline = QMcpGadgetArena::retainedSize();
+    {
+        QMcpGadgetArena arena;
+        QMcpCallToolRequest request;
+        QVERIFY(request.fromJsonObject(requestObject()));
+    }
+    // nothing outlived the arena
+    QCOMPARE(QMcpGadgetArena::retainedSize(), baseline);
+
+    QMcpCallToolRequest request;
+    {
+        QMcpGadgetArena arena;
+        QVERIFY(request.fromJsonObject(requestObject()));
+        QCOMPARE(QMcpGadgetArena::retainedSize(), baseline);
+    }
+    QVERIFY(QMcpGadgetArena::retainedSize() > baseline);
+
+    // released with the last gadget
+    request = QMcpCallToolRequest();
+    QCOMPARE(QMcpGadgetArena::retainedSize(), baseline);
+}
+
+QTEST_MAIN(tst_QMcpGadgetArena)
+#include "tst_qmcpgadgetarena.moc"
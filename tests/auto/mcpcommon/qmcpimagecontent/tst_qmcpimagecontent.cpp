@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QBuffer>
+#include <QtCore/QJsonDocument>
+#include <QtGui/QImage>
+#include <QtMcpCommon/QMcpImageContent>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtTest/QTest>
+
+class tst_QMcpImageContent : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void lazyEncoding();
+    void memoizedData();
+    void streaming_data();
+    void streaming();
+    void encode();
+    void setData();
+};
+
+static QImage testImage()
+{
+    QImage image(64, 48, QImage::Format_RGB32);
+    for (int y = 0; y < image.height(); y++) {
+        for (int x = 0; x < image.width(); x++)
+            image.setPixel(x, y, qRgb(x * 4, y * 5, (x + y) * 2));
+    }
+    return image;
+}
+
+static QByteArray saved(const QImage &image, const char *format, int quality = -1)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QBuffer::WriteOnly);
+    image.save(&buffer, format, quality);
+    return data.toBase64();
+}
+
+void tst_QMcpImageContent::lazyEncoding()
+{
+    const auto image = testImage();
+    const QMcpImageContent content(image);
+    QCOMPARE(content.image(), image);
+    QCOMPARE(content.mimeType(), u"image/png"_s);
+    QCOMPARE(content.data(), saved(image, "PNG"));
+    // reading the data does not consume the image
+    QCOMPARE(content.image(), image);
+}
+
+void tst_QMcpImageContent::memoizedData()
+{
+    const auto image = testImage();
+    QMcpImageContent content(image);
+    const QMcpImageContent copy = content;
+
+    // the image is encoded once, for the copies sharing it as well
+    const auto data = content.data();
+    QCOMPARE(data, saved(image, "PNG"));
+    QCOMPARE(content.data().constData(), data.constData());
+    QCOMPARE(copy.data().constData(), data.constData());
+
+    // a new image is encoded again
+    const auto mirrored = image.mirrored();
+    content.setImage(mirrored);
+    QCOMPARE(content.data(), saved(mirrored, "PNG"));
+    QCOMPARE(copy.data(), data);
+}
+
+void tst_QMcpImageContent::streaming_data()
+{
+    QTest::addColumn<QByteArray>("format");
+    QTest::addColumn<int>("quality");
+    QTest::addColumn<QString>("mimeType");
+
+    QTest::newRow("png") << "PNG"_ba << -1 << u"image/png"_s;
+    QTest::newRow("fast png") << "PNG"_ba << 90 << u"image/png"_s;
+    QTest::newRow("jpeg") << "JPEG"_ba << 75 << u"image/jpeg"_s;
+    QTest::newRow("jpg") << "jpg"_ba << 75 << u"image/jpeg"_s;
+}
+
+void tst_QMcpImageContent::streaming()
+{
+    QFETCH(QByteArray, format);
+    QFETCH(int, quality);
+    QFETCH(QString, mimeType);
+
+    const auto image = testImage();
+    const QMcpImageContent content(image, format, quality);
+    QCOMPARE(content.mimeType(), mimeType);
+
+    const auto object = QJsonDocument::fromJson(QMcpJsonWriter::toJson(content)).object();
+    QCOMPARE(object, content.toJsonObject());
+    QCOMPARE(object.value("data"_L1).toString().toLatin1(), saved(image, format.constData(), quality));
+    QCOMPARE(object.value("mimeType"_L1).toString(), mimeType);
+}
+
+void tst_QMcpImageContent::encode()
+{
+    const auto image = testImage();
+    QMcpImageContent content(image);
+    const QMcpImageContent copy = content;
+
+    QVERIFY(content.encode());
+    QVERIFY(content.image().isNull());
+    QCOMPARE(content.data(), saved(image, "PNG"));
+    QCOMPARE(QImage::fromData(content.decodedData(), "PNG").size(), image.size());
+
+    // copies keep their own pending image
+    QCOMPARE(copy.image(), image);
+}
+
+void tst_QMcpImageContent::setData()
+{
+    QMcpImageContent content(testImage());
+    content.setData("SGVsbG8="_ba);
+    QVERIFY(content.image().isNull());
+    QCOMPARE(content.data(), "SGVsbG8="_ba);
+    QCOMPARE(QJsonDocument::fromJson(QMcpJsonWriter::toJson(content)).object().value("data"_L1).toString(), u"SGVsbG8="_s);
+}
+
+QTEST_MAIN(tst_QMcpImageContent)
+#include "tst_qmcpimagecontent.moc"
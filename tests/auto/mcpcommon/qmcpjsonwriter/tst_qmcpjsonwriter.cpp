@@ -0,0 +1,164 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtMcpCommon/QMcpCallToolResult>
+#include <QtMcpCommon/QMcpJSONRPCErrorError>
+#include <QtMcpCommon/QMcpListToolsResult>
+#include <QtMcpCommon/QMcpTextContent>
+#include <QtMcpCommon/QMcpTool>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtTest/QTest>
+
+class tst_QMcpJsonWriter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void gadget_data();
+    void gadget();
+    void strings_data();
+    void strings();
+    void numbers();
+    void nesting();
+    void response();
+    void error();
+};
+
+static QJsonObject parse(const QByteArray &json)
+{
+    QJsonParseError error;
+    const auto document = QJsonDocument::fromJson(json, &error);
+    if (error.error != QJsonParseError::NoError)
+        qWarning() << error.errorString() << json;
+    return document.object();
+}
+
+void tst_QMcpJsonWriter::gadget_data()
+{
+    QTest::addColumn<QtMcp::ProtocolVersion>("protocolVersion");
+
+    QTest::newRow("2024-11-05") << QtMcp::ProtocolVersion::v2024_11_05;
+    QTest::newRow("2025-03-26") << QtMcp::ProtocolVersion::v2025_03_26;
+}
+
+void tst_QMcpJsonWriter::gadget()
+{
+    QFETCH(QtMcp::ProtocolVersion, protocolVersion);
+
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    tool.setDescription("Echoes the input"_L1);
+    QMcpListToolsResult tools;
+    tools.setTools({ tool, QMcpTool() });
+    QCOMPARE(parse(QMcpJsonWriter::toJson(tools, protocolVersion)), tools.toJsonObject(protocolVersion));
+
+    // any-of alternatives are written as the active alternative
+    QMcpTextContent text;
+    text.setText("Hello, world!"_L1);
+    QMcpCallToolResultContent content;
+    content.setTextContent(text);
+    QMcpCallToolResult result;
+    result.setContent({ content });
+    result.setIsError(true);
+    QCOMPARE(parse(QMcpJsonWriter::toJson(result, protocolVersion)), result.toJsonObject(protocolVersion));
+}
+
+void tst_QMcpJsonWriter::strings_data()
+{
+    QTest::addColumn<QString>("string");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("ascii") << u"plain text"_s;
+    QTest::newRow("quotes") << u"say \"hi\" \\ bye"_s;
+    QTest::newRow("control") << u"a\nb\tc\r\b\f\x01\x1f"_s;
+    QTest::newRow("latin1") << u"café"_s;
+    QTest::newRow("bmp") << u"日本語"_s;
+    QTest::newRow("surrogates") << u"\U0001F600 smile"_s;
+    QTest::newRow("long") << QString(u"é\"x"_s).repeated(500);
+}
+
+void tst_QMcpJsonWriter::strings()
+{
+    QFETCH(QString, string);
+
+    QMcpJsonWriter writer;
+    writer.beginObject();
+    writer.writeKey(string);
+    writer.writeString(string);
+    writer.writeKey("utf8"_L1);
+    writer.writeUtf8String(string.toUtf8());
+    writer.endObject();
+
+    const auto object = parse(writer.data());
+    QCOMPARE(object.value(string).toString(), string);
+    QCOMPARE(object.value("utf8"_L1).toString(), string);
+}
+
+void tst_QMcpJsonWriter::numbers()
+{
+    QMcpJsonWriter writer;
+    writer.writeArray({ 0, -3, 1.5, 1e100, qint64(1) << 53 });
+    QCOMPARE(writer.data(), "[0,-3,1.5,1e+100,9007199254740992]"_ba);
+
+    QMcpJsonWriter nonFinite;
+    nonFinite.writeDouble(qInf());
+    QCOMPARE(nonFinite.data(), "null"_ba);
+}
+
+void tst_QMcpJsonWriter::nesting()
+{
+    QMcpJsonWriter writer;
+    writer.beginObject();
+    writer.writeKey("a"_L1);
+    writer.beginArray();
+    writer.beginObject();
+    writer.endObject();
+    writer.writeNull();
+    writer.beginArray();
+    writer.endArray();
+    writer.endArray();
+    writer.writeKey("b"_L1);
+    writer.writeBool(false);
+    writer.endObject();
+    QCOMPARE(writer.data(), R"({"a":[{},null,[]],"b":false})"_ba);
+}
+
+void tst_QMcpJsonWriter::response()
+{
+    QMcpTool tool;
+    tool.setName("echo"_L1);
+    QMcpListToolsResult result;
+    result.setTools({ tool });
+
+    QByteArray buffer;
+    QMcpJsonWriter writer(&buffer);
+    writer.writeResponse(7, result);
+    const auto object = parse(buffer);
+    QCOMPARE(object.value("jsonrpc"_L1).toString(), u"2.0"_s);
+    QCOMPARE(object.value("id"_L1).toInt(), 7);
+    QCOMPARE(object.value("result"_L1).toObject(), result.toJsonObject());
+
+    // a pre-serialized result is embedded verbatim
+    QMcpJsonWriter raw;
+    raw.writeResponse(7, QMcpJsonWriter::toJson(result));
+    QCOMPARE(raw.data(), buffer);
+}
+
+void tst_QMcpJsonWriter::error()
+{
+    QMcpJSONRPCErrorError error;
+    error.setCode(-32601);
+    error.setMessage("Method not found"_L1);
+
+    QMcpJsonWriter writer;
+    writer.writeError(QJsonValue(), error);
+    const auto object = parse(writer.data());
+    QCOMPARE(object.value("jsonrpc"_L1).toString(), u"2.0"_s);
+    QVERIFY(object.value("id"_L1).isNull());
+    QCOMPARE(object.value("error"_L1).toObject(), error.toJsonObject());
+}
+
+QTEST_MAIN(tst_QMcpJsonWriter)
+#include "tst_qmcpjsonwriter.moc"
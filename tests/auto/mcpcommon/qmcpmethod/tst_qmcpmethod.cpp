@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtMcpCommon/QMcpCallToolRequest>
+#include <QtMcpCommon/QMcpCancelledNotification>
+#include <QtMcpCommon/QMcpCompleteRequest>
+#include <QtMcpCommon/QMcpCreateMessageRequest>
+#include <QtMcpCommon/QMcpGetPromptRequest>
+#include <QtMcpCommon/QMcpInitializeRequest>
+#include <QtMcpCommon/QMcpInitializedNotification>
+#include <QtMcpCommon/QMcpListPromptsRequest>
+#include <QtMcpCommon/QMcpListResourceTemplatesRequest>
+#include <QtMcpCommon/QMcpListResourcesRequest>
+#include <QtMcpCommon/QMcpListRootsRequest>
+#include <QtMcpCommon/QMcpListToolsRequest>
+#include <QtMcpCommon/QMcpLoggingMessageNotification>
+#include <QtMcpCommon/QMcpPingRequest>
+#include <QtMcpCommon/QMcpProgressNotification>
+#include <QtMcpCommon/QMcpPromptListChangedNotification>
+#include <QtMcpCommon/QMcpReadResourceRequest>
+#include <QtMcpCommon/QMcpResourceListChangedNotification>
+#include <QtMcpCommon/QMcpResourceUpdatedNotification>
+#include <QtMcpCommon/QMcpRootsListChangedNotification>
+#include <QtMcpCommon/QMcpSetLevelRequest>
+#include <QtMcpCommon/QMcpSubscribeRequest>
+#include <QtMcpCommon/QMcpToolListChangedNotification>
+#include <QtMcpCommon/QMcpUnsubscribeRequest>
+#include <QtMcpCommon/qmcpmethod.h>
+#include <QtTest/QTest>
+
+class tst_QMcpMethod : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void names();
+    void gadgets();
+    void unknown_data();
+    void unknown();
+    void table();
+};
+
+void tst_QMcpMethod::names()
+{
+    for (int i = 0; i < QMcpMethod::KnownCount; i++) {
+        const auto id = QMcpMethod::Id(i);
+        const auto name = QMcpMethod::name(id);
+        QVERIFY(!name.isEmpty());
+        QCOMPARE(QMcpMethod::id(QByteArrayView(name.data(), name.size())), id);
+        QCOMPARE(QMcpMethod::id(QString(name)), id);
+    }
+    QVERIFY(QMcpMethod::name(QMcpMethod::Unknown).isEmpty());
+    QVERIFY(QMcpMethod::name(QMcpMethod::KnownCount).isEmpty());
+}
+
+void tst_QMcpMethod::gadgets()
+{
+    // the IDs cover every message the gadgets define
+    const QString methods[] = {
+        QMcpCallToolRequest().method(),
+        QMcpCancelledNotification().method(),
+        QMcpCompleteRequest().method(),
+        QMcpCreateMessageRequest().method(),
+        QMcpGetPromptRequest().method(),
+        QMcpInitializeRequest().method(),
+        QMcpInitializedNotification().method(),
+        QMcpListPromptsRequest().method(),
+        QMcpListResourceTemplatesRequest().method(),
+        QMcpListResourcesRequest().method(),
+        QMcpListRootsRequest().method(),
+        QMcpListToolsRequest().method(),
+        QMcpLoggingMessageNotification().method(),
+        QMcpPingRequest().method(),
+        QMcpProgressNotification().method(),
+        QMcpPromptListChangedNotification().method(),
+        QMcpReadResourceRequest().method(),
+        QMcpResourceListChangedNotification().method(),
+        QMcpResourceUpdatedNotification().method(),
+        QMcpRootsListChangedNotification().method(),
+        QMcpSetLevelRequest().method(),
+        QMcpSubscribeRequest().method(),
+        QMcpToolListChangedNotification().method(),
+        QMcpUnsubscribeRequest().method(),
+    };
+    QCOMPARE(std::size(methods), size_t(QMcpMethod::KnownCount));
+    for (const auto &method : methods) {
+        const auto id = QMcpMethod::id(method);
+        QVERIFY2(id != QMcpMethod::Unknown, qPrintable(method));
+        QCOMPARE(QMcpMethod::name(id), method);
+    }
+}
+
+void tst_QMcpMethod::unknown_data()
+{
+    QTest::addColumn<QString>("method");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("custom") << u"example/custom"_s;
+    QTest::newRow("prefix") << u"tools/lis"_s;
+    QTest::newRow("suffix") << u"tools/listx"_s;
+    QTest::newRow("case") << u"Initialize"_s;
+    QTest::newRow("non-ascii") << u"tools/lïst"_s;
+}
+
+void tst_QMcpMethod::unknown()
+{
+    QFETCH(QString, method);
+
+    QCOMPARE(QMcpMethod::id(method), QMcpMethod::Unknown);
+    QCOMPARE(QMcpMethod::id(method.toUtf8()), QMcpMethod::Unknown);
+}
+
+void tst_QMcpMethod::table()
+{
+    QMcpMethodTable table;
+    QCOMPARE(table.size(), qsizetype(QMcpMethod::KnownCount));
+    QCOMPARE(table.find(u"example/custom"), -1);
+
+    // known methods keep their ID
+    QCOMPARE(table.intern(u"tools/call"_s), int(QMcpMethod::ToolsCall));
+    QCOMPARE(table.size(), qsizetype(QMcpMethod::KnownCount));
+
+    // custom methods are appended
+    const auto custom = table.intern(u"example/custom"_s);
+    QCOMPARE(custom, int(QMcpMethod::KnownCount));
+    QCOMPARE(table.intern(u"example/custom"_s), custom);
+    QCOMPARE(table.intern(u"example/other"_s), custom + 1);
+    QCOMPARE(table.size(), qsizetype(QMcpMethod::KnownCount + 2));
+
+    QCOMPARE(table.find(u"example/custom"), custom);
+    QCOMPARE(table.find(QByteArrayView("example/other")), custom + 1);
+    QCOMPARE(table.find(QByteArrayView("tools/list")), int(QMcpMethod::ToolsList));
+    QCOMPARE(table.find(u"example/missing"), -1);
+}
+
+QTEST_MAIN(tst_QMcpMethod)
+#include "tst_qmcpmethod.moc"
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonDocument>
+#include <QtMcpCommon/QMcpToolInputSchema>
+#include <QtMcpCommon/QMcpToolInputValidator>
+#include <QtTest/QTest>
+
+class tst_QMcpToolInputValidator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void validate_data();
+    void validate();
+    void defaultConstructed();
+    void manyRequired();
+};
+
+void tst_QMcpToolInputValidator::validate_data()
+{
+    QTest::addColumn<QByteArray>("schema");
+    QTest::addColumn<QByteArray>("arguments");
+    QTest::addColumn<QString>("errorMessage");
+
+    const auto schema = R"({
+        "type": "object",
+        "properties": {
+            "text": { "type": "string", "minLength": 1, "maxLength": 5 },
+            "count": { "type": "integer", "minimum": 0, "exclusiveMaximum": 10 },
+            "ratio": { "type": "number" },
+            "flag": { "type": "bool" },
+            "mode": { "type": "string", "enum": ["fast", "slow"] },
+            "tags": { "type": "array", "maxItems": 2 },
+            "value": { "type": ["string", "null"] }
+        },
+        "required": ["text", "count"]
+    })"_ba;
+
+    QTest::newRow("valid") << schema << R"({ "text": "abc", "count": 3 })"_ba << QString();
+    QTest::newRow("all") << schema << R"({ "text": "abc", "count": 0, "ratio": 2, "flag": true,
+        "mode": "slow", "tags": ["a"], "value": null, "other": {} })"_ba << QString();
+    QTest::newRow("missing") << schema << R"({ "text": "abc" })"_ba
+                             << u"Missing required argument 'count'"_s;
+    QTest::newRow("type") << schema << R"({ "text": 1, "count": 3 })"_ba
+                          << u"Invalid argument 'text': expected string"_s;
+    QTest::newRow("integer") << schema << R"({ "text": "abc", "count": 1.5 })"_ba
+                             << u"Invalid argument 'count': expected integer"_s;
+    QTest::newRow("number") << schema << R"({ "text": "abc", "count": 1, "ratio": "1" })"_ba
+                            << u"Invalid argument 'ratio': expected number"_s;
+    QTest::newRow("minimum") << schema << R"({ "text": "abc", "count": -1 })"_ba
+                             << u"Invalid argument 'count': -1 is below the minimum of 0"_s;
+    QTest::newRow("exclusiveMaximum") << schema << R"({ "text": "abc", "count": 10 })"_ba
+                                      << u"Invalid argument 'count': 10 is above the maximum of 10"_s;
+    QTest::newRow("minLength") << schema << R"({ "text": "", "count": 1 })"_ba
+                               << u"Invalid argument 'text': length 0 is out of range"_s;
+    QTest::newRow("maxLength") << schema << R"({ "text": "abcdef", "count": 1 })"_ba
+                               << u"Invalid argument 'text': length 6 is out of range"_s;
+    QTest::newRow("enum") << schema << R"({ "text": "abc", "count": 1, "mode": "medium" })"_ba
+                          << u"Invalid argument 'mode': value is not one of the allowed values"_s;
+    QTest::newRow("maxItems") << schema << R"({ "text": "abc", "count": 1, "tags": [1, 2, 3] })"_ba
+                              << u"Invalid argument 'tags': size 3 is out of range"_s;
+    QTest::newRow("types") << schema << R"({ "text": "abc", "count": 1, "value": 1 })"_ba
+                           << u"Invalid argument 'value': expected null or string"_s;
+
+    // required arguments without a description
+    QTest::newRow("undescribed") << R"({ "type": "object", "required": ["id"] })"_ba
+                                 << R"({ "name": "x" })"_ba
+                                 << u"Missing required argument 'id'"_s;
+    // lengths are in code points, not UTF-16 units
+    const auto character = R"({ "type": "object", "properties": { "c": { "type": "string", "maxLength": 1 } } })"_ba;
+    QTest::newRow("code point") << character << R"({ "c": "\ud83d\ude00" })"_ba << QString();
+    QTest::newRow("code points") << character << R"({ "c": "\ud83d\ude00\ud83d\ude00" })"_ba
+                                 << u"Invalid argument 'c': length 2 is out of range"_s;
+    QTest::newRow("const") << R"({ "type": "object", "properties": { "v": { "const": 2 } } })"_ba
+                           << R"({ "v": 3 })"_ba
+                           << u"Invalid argument 'v': value is not one of the allowed values"_s;
+}
+
+void tst_QMcpToolInputValidator::validate()
+{
+    QFETCH(QByteArray, schema);
+    QFETCH(QByteArray, arguments);
+    QFETCH(QString, errorMessage);
+
+    QMcpToolInputSchema inputSchema;
+    QVERIFY(inputSchema.fromJsonObject(QJsonDocument::fromJson(schema).object()));
+    const QMcpToolInputValidator validator(inputSchema);
+
+    QString message;
+    QCOMPARE(validator.validate(QJsonDocument::fromJson(arguments).object(), &message), errorMessage.isEmpty());
+    QCOMPARE(message, errorMessage);
+}
+
+void tst_QMcpToolInputValidator::defaultConstructed()
+{
+    const QMcpToolInputValidator validator;
+    QVERIFY(validator.validate(QJsonObject { { "any"_L1, 1 } }));
+
+    // copies share the compiled schema
+    QMcpToolInputSchema inputSchema;
+    inputSchema.setRequired({ u"id"_s });
+    auto copy = validator;
+    copy = QMcpToolInputValidator(inputSchema);
+    QVERIFY(!copy.validate(QJsonObject()));
+    QVERIFY(validator.validate(QJsonObject()));
+}
+
+void tst_QMcpToolInputValidator::manyRequired()
+{
+    // more arguments than bits in one word of the mask
+    QMcpToolInputSchema inputSchema;
+    QList<QString> required;
+    QJsonObject arguments;
+    for (int i = 0; i < 100; i++) {
+        const auto key = u"arg%1"_s.arg(i, 3, 10, '0'_L1);
+        required.append(key);
+        arguments.insert(key, i);
+    }
+    inputSchema.setRequired(required);
+    const QMcpToolInputValidator validator(inputSchema);
+    QVERIFY(validator.validate(arguments));
+
+    arguments.remove("arg070"_L1);
+    QString message;
+    QVERIFY(!validator.validate(arguments, &message));
+    QCOMPARE(message, u"Missing required argument 'arg070'"_s);
+}
+
+QTEST_MAIN(tst_QMcpToolInputValidator)
+#include "tst_qmcptoolinputvalidator.moc"
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef FAKESERVERBACKEND_H
+#define FAKESERVERBACKEND_H
+
+#include <QtCore/QJsonDocument>
+#include <QtMcpServer/qmcpserverbackendinterface.h>
+#include <QtMcpServer/qmcpserverbackendplugin.h>
+
+QT_BEGIN_NAMESPACE
+
+// Backends without a transport, built into the tests as a static plugin.
+// The tests inject the messages of a client and inspect what the server
+// sent back.
+
+// implements the first interface, exchanging QJsonObject
+class FakeServerBackend : public QMcpServerBackendInterface
+{
+    Q_OBJECT
+public:
+    using QMcpServerBackendInterface::QMcpServerBackendInterface;
+
+    void start(const QString &) override { emit started(); }
+    void send(const QUuid &session, const QJsonObject &object) override { sent.append({ session, object }); }
+    void notify(const QUuid &session, const QJsonObject &object) override { sent.append({ session, object }); }
+
+    void openSession(const QUuid &session) { emit newSessionStarted(session); }
+    void receive(const QUuid &session, const QJsonObject &object) { emit received(session, object); }
+
+    QList<std::pair<QUuid, QJsonObject>> sent;
+};
+
+// implements the second interface, exchanging serialized messages
+class FakeServerBackendV2 : public QMcpServerBackendInterfaceV2
+{
+    Q_OBJECT
+public:
+    using QMcpServerBackendInterfaceV2::QMcpServerBackendInterfaceV2;
+
+    void start(const QString &) override { emit started(); }
+    void writeMessage(const QUuid &session, QByteArray &&message) override { written.append({ session, std::move(message) }); }
+    void writeResponse(const QUuid &session, const QList<QJsonValue> &ids, QByteArray &&message) override
+    {
+        if (message.isEmpty())
+            released.append(ids);
+        else
+            answered.append(ids);
+        QMcpServerBackendInterfaceV2::writeResponse(session, ids, std::move(message));
+    }
+
+    void openSession(const QUuid &session) { emit newSessionStarted(session); }
+    void receive(const QUuid &session, const QByteArray &message) { emit messageReceived(session, message); }
+
+    // the last written message as JSON
+    QJsonDocument lastDocument() const
+    {
+        return written.isEmpty() ? QJsonDocument() : QJsonDocument::fromJson(written.last().second);
+    }
+
+    QList<std::pair<QUuid, QByteArray>> written;
+    // the IDs of every response written
+    QList<QList<QJsonValue>> answered;
+    // the IDs of the requests left without response
+    QList<QList<QJsonValue>> released;
+};
+
+class FakeServerBackendPlugin : public QMcpServerBackendPlugin
+{
+    Q_OBJECT
+    Q_PLUGIN_METADATA(IID QMcpServerBackendPluginFactoryInterface_iid FILE "fakeserverbackend.json")
+public:
+    QMcpServerBackendInterface *create(const QString &key, QObject *parent = nullptr) override
+    {
+        if (key == "fake"_L1)
+            return new FakeServerBackend(parent);
+        if (key == "fakev2"_L1)
+            return new FakeServerBackendV2(parent);
+        return nullptr;
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // FAKESERVERBACKEND_H
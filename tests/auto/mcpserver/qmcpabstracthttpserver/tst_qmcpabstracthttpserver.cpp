@@ -1,6 +1,7 @@
 // Copyright (C) 2025 Signal Slot Inc.
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
+#include <QSignalSpy>
 #include <QTest>
 #include <QtCore/QUrlQuery>
 #include <QtCore/QTimer>
@@ -85,6 +86,7 @@ private slots:
     void testPost_data();
     void testPost();
     void testSse();
+    void testSseDisconnected();
 
 private:
     QNetworkAccessManager nam;
@@ -273,5 +275,25 @@ void tst_QMcpAbstractHttpServer::testSse()
     qDebug() << __LINE__ << receivedData;
 }
 
+void tst_QMcpAbstractHttpServer::testSseDisconnected()
+{
+    QSignalSpy spy(server, &QMcpAbstractHttpServer::sessionDisconnected);
+
+    QUrl sseUrl("http://127.0.0.1/sse");
+    sseUrl.setPort(port);
+    QNetworkRequest sseRequest(sseUrl);
+    sseRequest.setRawHeader("Accept", "text/event-stream");
+
+    QNetworkReply *sseReply = nam.get(sseRequest);
+    QTRY_VERIFY(sseReply->bytesAvailable() > 0);
+    QCOMPARE(spy.count(), 0);
+
+    // the session ends with its event stream
+    sseReply->abort();
+    sseReply->deleteLater();
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!spy.at(0).at(0).value<QUuid>().isNull());
+}
+
 QTEST_MAIN(tst_QMcpAbstractHttpServer)
 #include "tst_qmcpabstracthttpserver.moc"
@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QThread>
+#include <QtMcpServer/qmcpcancellationtoken.h>
+#include <QtTest/QTest>
+
+#include <atomic>
+
+class tst_QMcpCancellationToken : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cancel();
+    void callbacks();
+    void copies();
+    void current();
+    void threads();
+};
+
+void tst_QMcpCancellationToken::cancel()
+{
+    QMcpCancellationToken token;
+    QVERIFY(!token.isCancelled());
+    token.cancel();
+    QVERIFY(token.isCancelled());
+    token.cancel();
+    QVERIFY(token.isCancelled());
+}
+
+void tst_QMcpCancellationToken::callbacks()
+{
+    QMcpCancellationToken token;
+    QList<int> called;
+    token.onCancelled([&called]() { called.append(1); });
+    token.onCancelled([&called]() { called.append(2); });
+    QVERIFY(called.isEmpty());
+
+    token.cancel();
+    QCOMPARE(called, QList<int>({ 1, 2 }));
+
+    // called once
+    token.cancel();
+    QCOMPARE(called.size(), 2);
+
+    // right away once cancelled
+    token.onCancelled([&called]() { called.append(3); });
+    QCOMPARE(called, QList<int>({ 1, 2, 3 }));
+}
+
+void tst_QMcpCancellationToken::copies()
+{
+    QMcpCancellationToken token;
+    const auto copy = token;
+    QMcpCancellationToken other;
+    copy.cancel();
+    QVERIFY(token.isCancelled());
+    QVERIFY(!other.isCancelled());
+}
+
+void tst_QMcpCancellationToken::current()
+{
+    // outside of a request handler
+    QVERIFY(!QMcpCancellationToken::current().isCancelled());
+}
+
+void tst_QMcpCancellationToken::threads()
+{
+    QMcpCancellationToken token;
+    std::atomic<int> called = 0;
+    std::atomic<bool> stopped = false;
+
+    auto *worker = QThread::create([token, &stopped]() {
+        while (!token.isCancelled())
+            QThread::yieldCurrentThread();
+        stopped = true;
+    });
+    worker->start();
+    token.onCancelled([&called]() { called++; });
+
+    auto *canceller = QThread::create([token]() { token.cancel(); });
+    canceller->start();
+    QVERIFY(canceller->wait(5000));
+    QVERIFY(worker->wait(5000));
+    delete canceller;
+    delete worker;
+
+    QVERIFY(stopped);
+    QCOMPARE(called.load(), 1);
+}
+
+QTEST_MAIN(tst_QMcpCancellationToken)
+#include "tst_qmcpcancellationtoken.moc"
@@ -0,0 +1,129 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+#include <QtMcpServer/qmcpprogressreporter.h>
+#include <QtTest/QTest>
+
+class tst_QMcpProgressReporter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void inactive();
+    void coalesce();
+    void interval();
+    void flush();
+    void close();
+    void threads();
+
+private:
+    struct Sent {
+        qreal progress;
+        qreal total;
+    };
+    QMcpProgressReporter reporter(int interval, QList<Sent> *sent);
+};
+
+QMcpProgressReporter tst_QMcpProgressReporter::reporter(int interval, QList<Sent> *sent)
+{
+    return QMcpProgressReporter(this, interval, [sent](qreal progress, qreal total) {
+        QCOMPARE(QThread::currentThread(), qApp->thread());
+        sent->append({ progress, total });
+    });
+}
+
+void tst_QMcpProgressReporter::inactive()
+{
+    QMcpProgressReporter reporter;
+    QVERIFY(!reporter.isActive());
+    reporter.report(1, 2);
+    reporter.flush();
+    QVERIFY(!QMcpProgressReporter::current().isActive());
+}
+
+void tst_QMcpProgressReporter::coalesce()
+{
+    QList<Sent> sent;
+    const auto progress = reporter(1000, &sent);
+    QVERIFY(progress.isActive());
+
+    // the first value goes out with the next event loop run
+    for (int i = 1; i <= 100; i++)
+        progress.report(i, 100);
+    QVERIFY(sent.isEmpty());
+    QTRY_COMPARE(sent.size(), 1);
+    QCOMPARE(sent.at(0).progress, 100);
+    QCOMPARE(sent.at(0).total, 100);
+}
+
+void tst_QMcpProgressReporter::interval()
+{
+    QList<Sent> sent;
+    const auto progress = reporter(200, &sent);
+    progress.report(1);
+    QTRY_COMPARE(sent.size(), 1);
+
+    // the next values wait for the interval
+    progress.report(2);
+    progress.report(3);
+    QTest::qWait(50);
+    QCOMPARE(sent.size(), 1);
+    QTRY_COMPARE(sent.size(), 2);
+    QCOMPARE(sent.at(1).progress, 3);
+    QCOMPARE(sent.at(1).total, 0);
+}
+
+void tst_QMcpProgressReporter::flush()
+{
+    QList<Sent> sent;
+    const auto progress = reporter(1000, &sent);
+    progress.report(1);
+    QTRY_COMPARE(sent.size(), 1);
+
+    // the last value does not wait for the interval
+    progress.report(2);
+    progress.flush();
+    QCOMPARE(sent.size(), 2);
+    QCOMPARE(sent.at(1).progress, 2);
+
+    // nor is it sent twice
+    progress.flush();
+    QTest::qWait(50);
+    QCOMPARE(sent.size(), 2);
+}
+
+void tst_QMcpProgressReporter::close()
+{
+    QList<Sent> sent;
+    const auto progress = reporter(0, &sent);
+    progress.report(1);
+    progress.close();
+    progress.report(2);
+    progress.flush();
+    QTest::qWait(50);
+    QVERIFY(sent.isEmpty());
+}
+
+void tst_QMcpProgressReporter::threads()
+{
+    QList<Sent> sent;
+    const auto progress = reporter(0, &sent);
+
+    auto *worker = QThread::create([progress]() {
+        for (int i = 1; i <= 1000; i++)
+            progress.report(i, 1000);
+    });
+    worker->start();
+    QVERIFY(worker->wait(5000));
+    delete worker;
+
+    // the latest value arrives, in order
+    QTRY_VERIFY(!sent.isEmpty() && sent.last().progress == 1000);
+    for (qsizetype i = 1; i < sent.size(); i++)
+        QVERIFY(sent.at(i - 1).progress < sent.at(i).progress);
+}
+
+QTEST_MAIN(tst_QMcpProgressReporter)
+#include "tst_qmcpprogressreporter.moc"
@@ -0,0 +1,185 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtMcpServer/private/qmcpregistry_p.h>
+#include <QtTest/QTest>
+
+class Tools : public QObject
+{
+    Q_OBJECT
+public:
+    Q_INVOKABLE QString echo(const QString &text) const { return text; }
+    Q_INVOKABLE int add(int a, int b) const { return a + b; }
+};
+
+class tst_QMcpRegistry : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tools();
+    void removeTools();
+    void copy();
+    void resources();
+    void prompts();
+};
+
+static QMcpTool makeTool(const QString &name)
+{
+    QMcpTool tool;
+    tool.setName(name);
+    return tool;
+}
+
+static QStringList names(const QList<QMcpTool> &tools)
+{
+    QStringList ret;
+    for (const auto &tool : tools)
+        ret.append(tool.name());
+    return ret;
+}
+
+void tst_QMcpRegistry::tools()
+{
+    Tools toolSet;
+    QMcpRegistry registry;
+    registry.addTools(QMcpRegistry::toolSetTools(&toolSet, {}));
+    registry.addTool(QMcpRegistry::dynamicTool(makeTool("zeta"_L1), [](const QJsonObject &) {
+        return QList<QMcpCallToolResultContent>();
+    }));
+    registry.addTool(QMcpRegistry::dynamicTool(makeTool("echo"_L1), [](const QJsonObject &) {
+        return QList<QMcpCallToolResultContent>();
+    }));
+
+    // sorted by name
+    QCOMPARE(names(registry.toolList()), QStringList({ "add"_L1, "echo"_L1, "echo"_L1, "zeta"_L1 }));
+
+    const auto *add = registry.tool("add"_L1);
+    QVERIFY(add);
+    QCOMPARE(add->kind, QMcpRegistry::Tool::Method);
+    QCOMPARE(add->object, &toolSet);
+    QCOMPARE(add->tool.inputSchema().required(), QStringList({ "a"_L1, "b"_L1 }));
+    QString message;
+    QVERIFY(!add->validator.validate(QJsonObject { { "a"_L1, 1 } }, &message));
+    QVERIFY(!message.isEmpty());
+
+    // a dynamic tool is called before a method of the same name
+    const auto *echo = registry.tool("echo"_L1);
+    QVERIFY(echo);
+    QCOMPARE(echo->kind, QMcpRegistry::Tool::Dynamic);
+    QVERIFY(echo->handler);
+
+    QVERIFY(!registry.tool("missing"_L1));
+}
+
+void tst_QMcpRegistry::removeTools()
+{
+    Tools toolSet;
+    QMcpRegistry registry;
+    registry.addTools(QMcpRegistry::toolSetTools(&toolSet, {}));
+    registry.addTool(QMcpRegistry::dynamicTool(makeTool("echo"_L1), [](const QJsonObject &) {
+        return QList<QMcpCallToolResultContent>();
+    }));
+
+    const auto isDynamic = [](const QMcpRegistry::Tool &tool) {
+        return tool.kind == QMcpRegistry::Tool::Dynamic;
+    };
+    QVERIFY(registry.removeTools(isDynamic));
+    QVERIFY(!registry.removeTools(isDynamic));
+    // the method is found again
+    QCOMPARE(registry.tool("echo"_L1)->kind, QMcpRegistry::Tool::Method);
+
+    QVERIFY(registry.removeTools([&toolSet](const QMcpRegistry::Tool &tool) {
+        return tool.object == &toolSet;
+    }));
+    QVERIFY(registry.toolList().isEmpty());
+    QVERIFY(!registry.tool("add"_L1));
+}
+
+void tst_QMcpRegistry::copy()
+{
+    QMcpRegistry registry;
+    registry.addTool(QMcpRegistry::dynamicTool(makeTool("one"_L1), {}));
+
+    QMcpRegistry next = registry;
+    const auto toolsRevision = next.toolsRevision();
+    const auto promptsRevision = next.promptsRevision();
+    next.addTool(QMcpRegistry::dynamicTool(makeTool("two"_L1), {}));
+
+    // the original does not change
+    QCOMPARE(names(registry.toolList()), QStringList({ "one"_L1 }));
+    QVERIFY(!registry.tool("two"_L1));
+    QCOMPARE(names(next.toolList()), QStringList({ "one"_L1, "two"_L1 }));
+    QVERIFY(next.tool("two"_L1));
+
+    // only the revision of what changed moves
+    QVERIFY(next.toolsRevision() > toolsRevision);
+    QCOMPARE(next.promptsRevision(), promptsRevision);
+    QVERIFY(next.revision() > registry.revision());
+}
+
+void tst_QMcpRegistry::resources()
+{
+    QMcpRegistry registry;
+
+    QMcpResource resource;
+    resource.setUri(QUrl("file:///readme.md"_L1));
+    resource.setName("readme"_L1);
+    registry.addResource(QMcpRegistry::dynamicResource(resource, {}));
+
+    QMcpResourceTemplate resourceTemplate;
+    resourceTemplate.setUriTemplate("file:///users/{id}/profile.json"_L1);
+    resourceTemplate.setName("profile"_L1);
+    registry.addResource(QMcpRegistry::dynamicResourceTemplate(resourceTemplate, {}));
+    QCOMPARE(registry.resources().size(), 2);
+
+    const auto *readme = registry.resource("file:///readme.md"_L1);
+    QVERIFY(readme);
+    QVERIFY(!readme->isTemplate);
+    QCOMPARE(readme->resource.name(), "readme"_L1);
+
+    // kept as registered, not percent-encoded
+    const auto *profile = registry.resource("file:///users/{id}/profile.json"_L1);
+    QVERIFY(profile);
+    QVERIFY(profile->isTemplate);
+    QVERIFY(profile->pattern.isValid());
+    QVERIFY(profile->pattern.match("file:///users/42/profile.json"_L1).hasMatch());
+    QVERIFY(!profile->pattern.match("file:///users/42/settings.json"_L1).hasMatch());
+    QVERIFY(!profile->pattern.match("file:///users/a/b/profile.json"_L1).hasMatch());
+    // the dot is not a wildcard
+    QVERIFY(!profile->pattern.match("file:///users/42/profileXjson"_L1).hasMatch());
+
+    // registering the same URI again replaces the resource
+    resource.setName("readme2"_L1);
+    registry.addResource(QMcpRegistry::dynamicResource(resource, {}));
+    QCOMPARE(registry.resources().size(), 2);
+    QCOMPARE(registry.resource("file:///readme.md"_L1)->resource.name(), "readme2"_L1);
+
+    QVERIFY(registry.removeResource("file:///readme.md"_L1));
+    QVERIFY(!registry.removeResource("file:///readme.md"_L1));
+    QVERIFY(!registry.resource("file:///readme.md"_L1));
+    QVERIFY(registry.resource("file:///users/{id}/profile.json"_L1));
+}
+
+void tst_QMcpRegistry::prompts()
+{
+    QMcpRegistry registry;
+
+    QMcpPrompt prompt;
+    prompt.setName("greeting"_L1);
+    registry.addPrompt({ prompt, [](const QString &, const QJsonObject &) {
+        return QList<QMcpPromptMessage>();
+    } });
+    QVERIFY(registry.prompt("greeting"_L1));
+    QVERIFY(registry.prompt("greeting"_L1)->handler);
+    QVERIFY(!registry.prompt("farewell"_L1));
+
+    const auto revision = registry.promptsRevision();
+    QVERIFY(registry.removePrompts("greeting"_L1));
+    QVERIFY(registry.promptsRevision() > revision);
+    QVERIFY(!registry.removePrompts("greeting"_L1));
+    QVERIFY(registry.prompts().isEmpty());
+}
+
+QTEST_MAIN(tst_QMcpRegistry)
+#include "tst_qmcpregistry.moc"
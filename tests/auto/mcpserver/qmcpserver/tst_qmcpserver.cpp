@@ -2,13 +2,24 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <QtCore/QEventLoop>
+#include <QtCore/QJsonArray>
+#include <QtCore/QPromise>
 #include <QtCore/QTimer>
+#include <QtCore/QtPlugin>
 #include <QtMcpCommon/QMcpNotification>
 #include <QtMcpCommon/QMcpRequest>
 #include <QtMcpCommon/QMcpResult>
+#include <QtMcpCommon/qmcpgadgetarena.h>
 #include <QtMcpServer/QMcpServer>
+#include <QtTest/QSignalSpy>
 #include <QtTest/QTest>
 
+#include <optional>
+
+#include "../fakeserverbackend.h"
+
+Q_IMPORT_PLUGIN(FakeServerBackendPlugin)
+
 QT_BEGIN_NAMESPACE
 
 class EchoRequest : public QMcpRequest
@@ -75,6 +86,14 @@ private slots:
     void testBasicServer();
     void testRequestHandler();
     void testNotificationHandler();
+    void testRequestExecution();
+    void testProgressInterval();
+    void testRequestTimeout();
+    void testSessionIdleTimeout();
+    void testGadgetArena();
+    void testBatch();
+    void testBatchCancelled();
+    void testCancelled();
 
 private:
     static const int TIMEOUT = 1000; // 1 second
@@ -139,5 +158,231 @@ void tst_QMcpServer::testNotificationHandler()
     m_server->notify(QUuid(), notification);
 }
 
+void tst_QMcpServer::testRequestExecution()
+{
+    QCOMPARE(m_server->requestExecution(), QMcpServer::Direct);
+    QCOMPARE(m_server->threadPoolSize(), 0);
+    QCOMPARE(m_server->maxQueuedRequests(), 1024);
+
+    QSignalSpy executionSpy(m_server, &QMcpServer::requestExecutionChanged);
+    m_server->setRequestExecution(QMcpServer::PooledSerialPerSession);
+    m_server->setRequestExecution(QMcpServer::PooledSerialPerSession);
+    QCOMPARE(executionSpy.count(), 1);
+    QCOMPARE(m_server->requestExecution(), QMcpServer::PooledSerialPerSession);
+
+    QSignalSpy sizeSpy(m_server, &QMcpServer::threadPoolSizeChanged);
+    m_server->setThreadPoolSize(2);
+    QCOMPARE(sizeSpy.count(), 1);
+    QCOMPARE(m_server->threadPoolSize(), 2);
+
+    QSignalSpy queueSpy(m_server, &QMcpServer::maxQueuedRequestsChanged);
+    m_server->setMaxQueuedRequests(16);
+    QCOMPARE(queueSpy.count(), 1);
+    QCOMPARE(m_server->maxQueuedRequests(), 16);
+}
+
+void tst_QMcpServer::testProgressInterval()
+{
+    QCOMPARE(m_server->progressInterval(), 100);
+
+    QSignalSpy spy(m_server, &QMcpServer::progressIntervalChanged);
+    m_server->setProgressInterval(250);
+    m_server->setProgressInterval(250);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_server->progressInterval(), 250);
+}
+
+void tst_QMcpServer::testRequestTimeout()
+{
+    QCOMPARE(m_server->requestTimeout(), 60000);
+
+    QSignalSpy spy(m_server, &QMcpServer::requestTimeoutChanged);
+    m_server->setRequestTimeout(0);
+    m_server->setRequestTimeout(0);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_server->requestTimeout(), 0);
+}
+
+void tst_QMcpServer::testSessionIdleTimeout()
+{
+    QCOMPARE(m_server->sessionIdleTimeout(), 0);
+
+    QSignalSpy spy(m_server, &QMcpServer::sessionIdleTimeoutChanged);
+    m_server->setSessionIdleTimeout(30000);
+    m_server->setSessionIdleTimeout(30000);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_server->sessionIdleTimeout(), 30000);
+
+    m_server->setSessionIdleTimeout(0);
+    QCOMPARE(spy.count(), 2);
+}
+
+void tst_QMcpServer::testGadgetArena()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+    QVERIFY(!server.isGadgetArenaEnabled());
+
+    QList<EchoRequest> retained;
+    server.addRequestHandler([&retained](const QUuid &, const EchoRequest &request, QMcpJSONRPCErrorError *) {
+        // kept past the message
+        retained.append(request);
+        return EchoResult();
+    });
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+
+    // without an arena, a retained request holds no arena memory
+    const auto baseline = QMcpGadgetArena::retainedSize();
+    backend->receive(session, R"({"jsonrpc":"2.0","id":1,"method":"test.echo"})"_ba);
+    QCOMPARE(retained.size(), 1);
+    QCOMPARE(backend->written.size(), 1);
+    QCOMPARE(QMcpGadgetArena::retainedSize(), baseline);
+
+    // with one, it keeps the arena alive until it is gone
+    QSignalSpy spy(&server, &QMcpServer::gadgetArenaEnabledChanged);
+    server.setGadgetArenaEnabled(true);
+    server.setGadgetArenaEnabled(true);
+    QCOMPARE(spy.count(), 1);
+    backend->receive(session, R"({"jsonrpc":"2.0","id":2,"method":"test.echo"})"_ba);
+    QCOMPARE(retained.size(), 2);
+    QCOMPARE(backend->written.size(), 2);
+    QVERIFY(QMcpGadgetArena::retainedSize() > baseline);
+    retained.clear();
+    QCOMPARE(QMcpGadgetArena::retainedSize(), baseline);
+}
+
+void tst_QMcpServer::testBatch()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+
+    server.addRequestHandler([](const QUuid &, const EchoRequest &, QMcpJSONRPCErrorError *) {
+        return EchoResult();
+    });
+    int notified = 0;
+    server.addNotificationHandler([&notified](const QUuid &, const TestNotification &) {
+        notified++;
+    });
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+
+    // requests and notifications, the requests answered in one array
+    backend->receive(session, R"([
+        {"jsonrpc":"2.0","id":1,"method":"ping"},
+        {"jsonrpc":"2.0","method":"test.notification"},
+        {"jsonrpc":"2.0","id":2,"method":"test.echo"}
+    ])"_ba);
+    QCOMPARE(notified, 1);
+    QCOMPARE(backend->written.size(), 1);
+    auto responses = backend->lastDocument().array();
+    QCOMPARE(responses.size(), 2);
+    QCOMPARE(responses.at(0).toObject().value("id"_L1).toInt(), 1);
+    QVERIFY(responses.at(0).toObject().contains("result"_L1));
+    QCOMPARE(responses.at(1).toObject().value("id"_L1).toInt(), 2);
+    QVERIFY(responses.at(1).toObject().contains("result"_L1));
+
+    // notifications only get no response
+    backend->receive(session, R"([{"jsonrpc":"2.0","method":"test.notification"}])"_ba);
+    QCOMPARE(notified, 2);
+    QCOMPARE(backend->written.size(), 1);
+
+    // an empty batch is a single invalid request
+    backend->receive(session, "[]"_ba);
+    QCOMPARE(backend->written.size(), 2);
+    const auto error = backend->lastDocument().object();
+    QVERIFY(error.value("id"_L1).isNull());
+    QCOMPARE(error.value("error"_L1).toObject().value("code"_L1).toInt(), -32600);
+
+    // an entry that is not an object is answered with an error in place
+    backend->receive(session, R"([1, {"jsonrpc":"2.0","id":3,"method":"ping"}])"_ba);
+    QCOMPARE(backend->written.size(), 3);
+    responses = backend->lastDocument().array();
+    QCOMPARE(responses.size(), 2);
+    QVERIFY(responses.at(0).toObject().value("id"_L1).isNull());
+    QCOMPARE(responses.at(0).toObject().value("error"_L1).toObject().value("code"_L1).toInt(), -32600);
+    QCOMPARE(responses.at(1).toObject().value("id"_L1).toInt(), 3);
+}
+
+void tst_QMcpServer::testBatchCancelled()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+
+    // answered only when the test says so
+    std::optional<QPromise<EchoResult>> promise;
+    server.addRequestHandler([&promise](const QUuid &, const EchoRequest &, QMcpJSONRPCErrorError *) {
+        promise.emplace();
+        promise->start();
+        return promise->future();
+    });
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+
+    // the batch waits for its last request
+    backend->receive(session, R"([
+        {"jsonrpc":"2.0","id":1,"method":"test.echo"},
+        {"jsonrpc":"2.0","id":2,"method":"ping"}
+    ])"_ba);
+    QVERIFY(promise);
+    QCOMPARE(backend->written.size(), 0);
+
+    // and is answered without it once it is cancelled
+    backend->receive(session, R"({"jsonrpc":"2.0","method":"notifications/cancelled","params":{"requestId":1}})"_ba);
+    QCOMPARE(backend->written.size(), 1);
+    const auto responses = backend->lastDocument().array();
+    QCOMPARE(responses.size(), 1);
+    QCOMPARE(responses.at(0).toObject().value("id"_L1).toInt(), 2);
+
+    // a late result is dropped
+    promise->addResult(EchoResult());
+    promise->finish();
+    QTest::qWait(10);
+    QCOMPARE(backend->written.size(), 1);
+}
+
+void tst_QMcpServer::testCancelled()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+
+    // answered only when the test says so
+    std::optional<QPromise<EchoResult>> promise;
+    server.addRequestHandler([&promise](const QUuid &, const EchoRequest &, QMcpJSONRPCErrorError *) {
+        promise.emplace();
+        promise->start();
+        return promise->future();
+    });
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+
+    backend->receive(session, R"({"jsonrpc":"2.0","id":1,"method":"test.echo"})"_ba);
+    QVERIFY(promise);
+
+    // the backend is told the request goes unanswered
+    backend->receive(session, R"({"jsonrpc":"2.0","method":"notifications/cancelled","params":{"requestId":1}})"_ba);
+    QCOMPARE(backend->written.size(), 0);
+    QCOMPARE(backend->released.size(), 1);
+    QCOMPARE(backend->released.at(0), QList<QJsonValue>({ 1 }));
+
+    // a late result is dropped
+    promise->addResult(EchoResult());
+    promise->finish();
+    QTest::qWait(10);
+    QCOMPARE(backend->written.size(), 0);
+    QCOMPARE(backend->released.size(), 1);
+
+    // so is a batch all of whose requests were cancelled
+    backend->receive(session, R"([{"jsonrpc":"2.0","id":2,"method":"test.echo"}])"_ba);
+    backend->receive(session, R"({"jsonrpc":"2.0","method":"notifications/cancelled","params":{"requestId":2}})"_ba);
+    QCOMPARE(backend->written.size(), 0);
+    QCOMPARE(backend->released.size(), 2);
+    QCOMPARE(backend->released.at(1), QList<QJsonValue>({ 2 }));
+}
+
 QTEST_MAIN(tst_QMcpServer)
 #include "tst_qmcpserver.moc"
@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QtPlugin>
+#include <QtMcpCommon/qmcpcbor.h>
+#include <QtMcpCommon/qmcpjsonwriter.h>
+#include <QtMcpServer/qmcpserver.h>
+#include <QtTest/QTest>
+#include "../fakeserverbackend.h"
+
+Q_IMPORT_PLUGIN(FakeServerBackendPlugin)
+
+class tst_QMcpServerBackendInterface : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void receivedObject();
+    void messageReceived();
+    void writeMessage();
+    void writeResponse();
+};
+
+static QJsonObject pingRequest(int id)
+{
+    return QJsonObject {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "id"_L1, id },
+        { "method"_L1, "ping"_L1 },
+    };
+}
+
+static QJsonObject pingResponse(int id)
+{
+    return QJsonObject {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "id"_L1, id },
+        { "result"_L1, QJsonObject() },
+    };
+}
+
+void tst_QMcpServerBackendInterface::receivedObject()
+{
+    QMcpServer server(u"fake"_s);
+    auto *backend = server.findChild<FakeServerBackend *>();
+    QVERIFY(backend);
+    QVERIFY(!qobject_cast<QMcpServerBackendInterfaceV2 *>(backend));
+
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+    backend->receive(session, pingRequest(1));
+
+    // the serialized response is parsed back for send()
+    QCOMPARE(backend->sent.size(), 1);
+    QCOMPARE(backend->sent.at(0).first, session);
+    QCOMPARE(backend->sent.at(0).second, pingResponse(1));
+}
+
+void tst_QMcpServerBackendInterface::messageReceived()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+    backend->receive(session, QMcpJsonWriter::toJson(pingRequest(1)));
+    QCOMPARE(backend->written.size(), 1);
+    QCOMPARE(backend->written.at(0).first, session);
+    QCOMPARE(backend->lastDocument().object(), pingResponse(1));
+
+    // CBOR is read as well, the response stays JSON until it was negotiated
+    backend->receive(session, QMcpJsonWriter::toCbor(pingRequest(2)));
+    QCOMPARE(backend->written.size(), 2);
+    QVERIFY(!QMcpCbor::isCbor(backend->written.at(1).second));
+    QCOMPARE(backend->lastDocument().object(), pingResponse(2));
+}
+
+void tst_QMcpServerBackendInterface::writeMessage()
+{
+    FakeServerBackendV2 backend;
+    const auto session = QUuid::createUuid();
+
+    // the QJsonObject slots end up in writeMessage()
+    backend.send(session, pingResponse(1));
+    QCOMPARE(backend.written.size(), 1);
+    QCOMPARE(backend.written.at(0).first, session);
+    QCOMPARE(backend.written.at(0).second, QMcpJsonWriter::toJson(pingResponse(1)));
+
+    const QJsonObject notification {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "method"_L1, "notifications/tools/list_changed"_L1 },
+    };
+    backend.notify(session, notification);
+    QCOMPARE(backend.written.size(), 2);
+    QCOMPARE(backend.lastDocument().object(), notification);
+}
+
+void tst_QMcpServerBackendInterface::writeResponse()
+{
+    QMcpServer server(u"fakev2"_s);
+    auto *backend = server.findChild<FakeServerBackendV2 *>();
+    QVERIFY(backend);
+
+    const auto session = QUuid::createUuid();
+    backend->openSession(session);
+
+    // the backend is told which requests a response answers
+    backend->receive(session, QMcpJsonWriter::toJson(pingRequest(1)));
+    QCOMPARE(backend->answered.size(), 1);
+    QCOMPARE(backend->answered.at(0), QList<QJsonValue>({ 1 }));
+
+    // a batch is answered at once, notifications are left out
+    const QJsonObject notification {
+        { "jsonrpc"_L1, "2.0"_L1 },
+        { "method"_L1, "notifications/initialized"_L1 },
+    };
+    const QJsonArray batch { pingRequest(2), notification, pingRequest(3) };
+    backend->receive(session, QJsonDocument(batch).toJson(QJsonDocument::Compact));
+    QCOMPARE(backend->answered.size(), 2);
+    QCOMPARE(backend->answered.at(1), QList<QJsonValue>({ 2, 3 }));
+    QCOMPARE(backend->written.size(), 2);
+    QVERIFY(backend->lastDocument().isArray());
+}
+
+QTEST_MAIN(tst_QMcpServerBackendInterface)
+#include "tst_qmcpserverbackendinterface.moc"
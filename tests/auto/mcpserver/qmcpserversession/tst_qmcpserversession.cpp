@@ -59,6 +59,7 @@ private slots:
     // Tool management
     void testTools();
     void testCallTool();
+    void testCallToolInvalidParams();
 
     // Root management
     void testRoots();
@@ -315,6 +316,38 @@ void tst_QMcpServerSession::testCallTool()
     QVERIFY(result.isEmpty());
 }
 
+void tst_QMcpServerSession::testCallToolInvalidParams()
+{
+    QMcpTool tool;
+    tool.setName(QStringLiteral("echo"));
+    QMcpToolInputSchema inputSchema;
+    inputSchema.setProperties(QJsonObject { { "text"_L1, QJsonObject { { "type"_L1, "string"_L1 } } } });
+    inputSchema.setRequired({ QStringLiteral("text") });
+    tool.setInputSchema(inputSchema);
+
+    int calls = 0;
+    m_session->registerDynamicTool(tool, [&calls](const QJsonObject &params) {
+        calls++;
+        return QList<QMcpCallToolResultContent> { QMcpTextContent(params.value("text"_L1).toString()) };
+    });
+
+    bool ok = false;
+    QString message;
+    auto result = m_session->callTool(QStringLiteral("echo"), QJsonObject { { "text"_L1, 1 } }, &ok, &message);
+    QVERIFY(!ok);
+    QVERIFY(result.isEmpty());
+    QCOMPARE(message, QStringLiteral("Invalid argument 'text': expected string"));
+    // the handler is not called for invalid parameters
+    QCOMPARE(calls, 0);
+
+    message.clear();
+    result = m_session->callTool(QStringLiteral("echo"), QJsonObject { { "text"_L1, "hi"_L1 } }, &ok, &message);
+    QVERIFY(ok);
+    QVERIFY(message.isEmpty());
+    QCOMPARE(calls, 1);
+    QCOMPARE(result.size(), 1);
+}
+
 void tst_QMcpServerSession::testRoots()
 {
     QVERIFY(m_session->roots().isEmpty());
@@ -0,0 +1,243 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QFuture>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QPromise>
+#include <QtMcpCommon/QMcpRequest>
+#include <QtMcpCommon/QMcpResult>
+#include <QtMcpServer/QMcpServer>
+#include <QtNetwork/QTcpSocket>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class EchoRequest : public QMcpRequest
+{
+    Q_GADGET
+public:
+    EchoRequest() : QMcpRequest(new Private) {}
+    QString method() const override { return QStringLiteral("test.echo"); }
+
+    const QMetaObject* metaObject() const override {
+        return &staticMetaObject;
+    }
+
+protected:
+    struct Private : public QMcpRequest::Private {
+        Private *clone() const override { return new Private(*this); }
+    };
+};
+
+class EchoResult : public QMcpResult
+{
+    Q_GADGET
+public:
+    EchoResult() : QMcpResult(new Private) {}
+
+    const QMetaObject* metaObject() const override {
+        return &staticMetaObject;
+    }
+protected:
+    struct Private : public QMcpResult::Private {
+        Private *clone() const override { return new Private(*this); }
+    };
+};
+
+QT_END_NAMESPACE
+
+class tst_QMcpServerSse : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void streamableHttpResponses();
+    void requestIds();
+    void cancelledRequest();
+};
+
+// a streamable HTTP client connection, one POST at a time
+class Connection
+{
+public:
+    Connection()
+    {
+        socket.connectToHost(u"127.0.0.1"_s, port);
+    }
+
+    void post(const QByteArray &body, const QByteArray &session = QByteArray())
+    {
+        QByteArray request = "POST /mcp HTTP/1.1\r\n"
+                             "Content-Type: application/json\r\n"
+                             "Accept: application/json, text/event-stream\r\n"_ba;
+        if (!session.isEmpty())
+            request += "Mcp-Session-Id: " + session + "\r\n";
+        request += "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n" + body;
+        socket.write(request);
+        buffer.clear();
+    }
+
+    // reads what arrived, returns whether the response is complete
+    bool read()
+    {
+        buffer += socket.readAll();
+        const auto end = buffer.indexOf("\r\n\r\n");
+        if (end < 0)
+            return false;
+        header = buffer.left(end);
+        return buffer.size() >= end + 4 + headerValue("Content-Length").toLongLong();
+    }
+
+    QByteArray headerValue(const QByteArray &name) const
+    {
+        const auto lines = header.split('\n');
+        for (const auto &line : lines) {
+            if (line.startsWith(name + ':'))
+                return line.mid(name.size() + 1).trimmed();
+        }
+        return QByteArray();
+    }
+
+    int status() const
+    {
+        return header.split(' ').value(1).toInt();
+    }
+
+    QJsonDocument document() const
+    {
+        return QJsonDocument::fromJson(buffer.mid(header.size() + 4));
+    }
+
+    QJsonObject body() const
+    {
+        return document().object();
+    }
+
+    static constexpr quint16 port = 10102;
+
+private:
+    QTcpSocket socket;
+    QByteArray buffer;
+    QByteArray header;
+};
+
+void tst_QMcpServerSse::streamableHttpResponses()
+{
+    QMcpServer server(u"sse"_s);
+    QSignalSpy started(&server, &QMcpServer::started);
+    server.start(u"127.0.0.1:%1"_s.arg(Connection::port));
+    QTRY_COMPARE(started.count(), 1);
+
+    // answered when the test says so, reporting progress before
+    std::vector<QPromise<EchoResult>> promises;
+    server.addRequestHandler([&promises](const QUuid &, const EchoRequest &, QMcpJSONRPCErrorError *) {
+        QMcpProgressReporter::current().report(1, 2);
+        auto &promise = promises.emplace_back();
+        promise.start();
+        return promise.future();
+    });
+
+    // a POST without a session starts one
+    Connection first;
+    first.post(R"({"jsonrpc":"2.0","id":1,"method":"ping"})"_ba);
+    QTRY_VERIFY(first.read());
+    const auto session = first.headerValue("Mcp-Session-Id");
+    QVERIFY(!session.isEmpty());
+    QCOMPARE(first.body().value("id"_L1).toInt(), 1);
+
+    Connection second;
+    second.post(R"({"jsonrpc":"2.0","id":2,"method":"test.echo","params":{"_meta":{"progressToken":"p"}}})"_ba, session);
+    QTRY_COMPARE(promises.size(), size_t(1));
+    Connection third;
+    third.post(R"({"jsonrpc":"2.0","id":3,"method":"test.echo"})"_ba, session);
+    QTRY_COMPARE(promises.size(), size_t(2));
+
+    // answered in the opposite order, each on the POST of its request; the
+    // progress has no stream to go to and takes no POST
+    promises.at(1).addResult(EchoResult());
+    promises.at(1).finish();
+    QTRY_VERIFY(third.read());
+    QCOMPARE(third.body().value("id"_L1).toInt(), 3);
+    QVERIFY(third.body().contains("result"_L1));
+
+    promises.at(0).addResult(EchoResult());
+    promises.at(0).finish();
+    QTRY_VERIFY(second.read());
+    QCOMPARE(second.body().value("id"_L1).toInt(), 2);
+    QVERIFY(second.body().contains("result"_L1));
+}
+
+void tst_QMcpServerSse::requestIds()
+{
+    QMcpServer server(u"sse"_s);
+    QSignalSpy started(&server, &QMcpServer::started);
+    server.start(u"127.0.0.1:%1"_s.arg(Connection::port));
+    QTRY_COMPARE(started.count(), 1);
+
+    Connection first;
+    first.post(R"({"jsonrpc":"2.0","id":1,"method":"ping"})"_ba);
+    QTRY_VERIFY(first.read());
+    const auto session = first.headerValue("Mcp-Session-Id");
+    QVERIFY(!session.isEmpty());
+
+    // the IDs are read like QMcpServer reads them, escapes, white space and
+    // all, the notification waits for no response
+    Connection batch;
+    batch.post(R"([ {"jsonrpc":"2.0", "id" : "a\"b", "method":"ping"} ,)"
+               R"( {"jsonrpc":"2.0","method":"notifications/initialized"},)"
+               R"( {"jsonrpc":"2.0","id":1.5,"method":"ping","params":{"x":[null,true,-1e3]}} ])"_ba, session);
+    QTRY_VERIFY(batch.read());
+    QCOMPARE(batch.status(), 200);
+    const auto responses = batch.document().array();
+    QCOMPARE(responses.size(), 2);
+    QCOMPARE(responses.at(0).toObject().value("id"_L1).toString(), u"a\"b"_s);
+    QCOMPARE(responses.at(1).toObject().value("id"_L1).toDouble(), 1.5);
+
+    // what is not JSON is refused before QMcpServer sees it
+    Connection invalid;
+    invalid.post(R"({"jsonrpc":"2.0","id":2,"method":"ping")"_ba, session);
+    QTRY_VERIFY(invalid.read());
+    QCOMPARE(invalid.status(), 400);
+}
+
+void tst_QMcpServerSse::cancelledRequest()
+{
+    QMcpServer server(u"sse"_s);
+    QSignalSpy started(&server, &QMcpServer::started);
+    server.start(u"127.0.0.1:%1"_s.arg(Connection::port));
+    QTRY_COMPARE(started.count(), 1);
+
+    // never answered
+    std::vector<QPromise<EchoResult>> promises;
+    server.addRequestHandler([&promises](const QUuid &, const EchoRequest &, QMcpJSONRPCErrorError *) {
+        auto &promise = promises.emplace_back();
+        promise.start();
+        return promise.future();
+    });
+
+    Connection first;
+    first.post(R"({"jsonrpc":"2.0","id":1,"method":"ping"})"_ba);
+    QTRY_VERIFY(first.read());
+    const auto session = first.headerValue("Mcp-Session-Id");
+    QVERIFY(!session.isEmpty());
+
+    Connection request;
+    request.post(R"({"jsonrpc":"2.0","id":2,"method":"test.echo"})"_ba, session);
+    QTRY_COMPARE(promises.size(), size_t(1));
+
+    // the POST of the cancelled request ends without a response
+    Connection cancel;
+    cancel.post(R"({"jsonrpc":"2.0","method":"notifications/cancelled","params":{"requestId":2}})"_ba, session);
+    QTRY_VERIFY(cancel.read());
+    QCOMPARE(cancel.status(), 202);
+    QTRY_VERIFY(request.read());
+    QCOMPARE(request.status(), 202);
+    QCOMPARE(request.headerValue("Mcp-Session-Id"), session);
+}
+
+QTEST_MAIN(tst_QMcpServerSse)
+#include "tst_qmcpserversse.moc"
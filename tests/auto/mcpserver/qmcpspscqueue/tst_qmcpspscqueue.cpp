@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+#include <QtMcpServer/private/qmcpspscqueue_p.h>
+#include <QtTest/QTest>
+
+#include <memory>
+
+class tst_QMcpSpscQueue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void order();
+    void moveOnly();
+    void threads();
+    void channel();
+};
+
+void tst_QMcpSpscQueue::order()
+{
+    QMcpSpscQueue<QByteArray> queue;
+    QVERIFY(queue.isEmpty());
+
+    QByteArray value;
+    QVERIFY(!queue.pop(&value));
+
+    queue.push("a"_ba);
+    queue.push("b"_ba);
+    QVERIFY(!queue.isEmpty());
+    QVERIFY(queue.pop(&value));
+    QCOMPARE(value, "a"_ba);
+    queue.push("c"_ba);
+    QVERIFY(queue.pop(&value));
+    QCOMPARE(value, "b"_ba);
+    QVERIFY(queue.pop(&value));
+    QCOMPARE(value, "c"_ba);
+    QVERIFY(queue.isEmpty());
+
+    // left over values are destroyed with the queue
+    queue.push("d"_ba);
+}
+
+void tst_QMcpSpscQueue::moveOnly()
+{
+    QMcpSpscQueue<std::unique_ptr<int>> queue;
+    queue.push(std::make_unique<int>(42));
+    std::unique_ptr<int> value;
+    QVERIFY(queue.pop(&value));
+    QVERIFY(value);
+    QCOMPARE(*value, 42);
+}
+
+void tst_QMcpSpscQueue::threads()
+{
+    constexpr int count = 100000;
+    QMcpSpscQueue<int> queue;
+
+    auto *producer = QThread::create([&queue]() {
+        for (int i = 0; i < count; i++)
+            queue.push(int(i));
+    });
+    producer->start();
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        int value;
+        if (!queue.pop(&value)) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+        ordered = ordered && value == expected;
+        expected++;
+    }
+    QVERIFY(producer->wait(5000));
+    delete producer;
+    QVERIFY(ordered);
+    QVERIFY(queue.isEmpty());
+}
+
+void tst_QMcpSpscQueue::channel()
+{
+    constexpr int count = 1000;
+    QList<int> received;
+    QMcpSpscChannel<int> channel([&received](int &&value) {
+        QCOMPARE(QThread::currentThread(), qApp->thread());
+        received.append(value);
+    });
+
+    auto *producer = QThread::create([&channel]() {
+        for (int i = 0; i < count; i++)
+            channel.post(int(i));
+    });
+    producer->start();
+    QVERIFY(producer->wait(5000));
+    delete producer;
+
+    // delivered by the event loop of the thread of the channel
+    QTRY_COMPARE(received.size(), count);
+    for (int i = 0; i < count; i++)
+        QCOMPARE(received.at(i), i);
+
+    // values can be taken without waiting for the event loop
+    channel.post(count);
+    channel.flush();
+    QCOMPARE(received.size(), count + 1);
+}
+
+QTEST_MAIN(tst_QMcpSpscQueue)
+#include "tst_qmcpspscqueue.moc"
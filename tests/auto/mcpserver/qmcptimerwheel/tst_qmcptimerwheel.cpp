@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QHash>
+#include <QtMcpServer/private/qmcptimerwheel_p.h>
+#include <QtTest/QTest>
+
+#include <algorithm>
+
+class tst_QMcpTimerWheel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void expire();
+    void turns();
+    void many();
+};
+
+void tst_QMcpTimerWheel::expire()
+{
+    QMcpTimerWheel<int> wheel(8);
+    QVERIFY(wheel.isEmpty());
+
+    wheel.schedule(1, 1);
+    wheel.schedule(2, 3);
+    // expires with the next tick at the earliest
+    wheel.schedule(3, 0);
+    QCOMPARE(wheel.size(), qsizetype(3));
+
+    auto expired = wheel.advance();
+    std::sort(expired.begin(), expired.end());
+    QCOMPARE(expired, QList<int>({ 1, 3 }));
+    QVERIFY(wheel.advance().isEmpty());
+    QCOMPARE(wheel.advance(), QList<int>({ 2 }));
+    QVERIFY(wheel.isEmpty());
+}
+
+void tst_QMcpTimerWheel::turns()
+{
+    // longer than a turn of the wheel
+    QMcpTimerWheel<int> wheel(4);
+    wheel.schedule(1, 4);
+    wheel.schedule(2, 5);
+    wheel.schedule(3, 9);
+
+    QList<int> ticks;
+    for (int tick = 1; !wheel.isEmpty(); tick++) {
+        for (int key : wheel.advance())
+            ticks.append(key * 100 + tick);
+    }
+    QCOMPARE(ticks, QList<int>({ 104, 205, 309 }));
+}
+
+void tst_QMcpTimerWheel::many()
+{
+    QMcpTimerWheel<int> wheel(16);
+    QHash<int, int> due;
+    int now = 0;
+    for (int key = 0; key < 1000; key++) {
+        const int ticks = 1 + (key * 37) % 50;
+        wheel.schedule(key, ticks);
+        due.insert(key, now + ticks);
+        if (key % 3 == 0) {
+            now++;
+            for (int expired : wheel.advance())
+                QCOMPARE(due.take(expired), now);
+        }
+    }
+    while (!wheel.isEmpty()) {
+        now++;
+        for (int expired : wheel.advance())
+            QCOMPARE(due.take(expired), now);
+    }
+    QVERIFY(due.isEmpty());
+}
+
+QTEST_MAIN(tst_QMcpTimerWheel)
+#include "tst_qmcptimerwheel.moc"
@@ -0,0 +1,170 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QMutex>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSet>
+#include <QtCore/QThread>
+#include <QtMcpServer/private/qmcpworkstealingpool_p.h>
+#include <QtTest/QTest>
+
+#include <atomic>
+
+class tst_QMcpWorkStealingPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void runsAll();
+    void threads();
+    void nested();
+    void strand();
+    void strandsInParallel();
+    void maxQueued();
+    void destructorDrains();
+};
+
+void tst_QMcpWorkStealingPool::runsAll()
+{
+    QMcpWorkStealingPool pool(4);
+    QCOMPARE(pool.threadCount(), 4);
+
+    std::atomic<int> count = 0;
+    for (int i = 0; i < 1000; i++)
+        QVERIFY(pool.tryStart([&count]() { count++; }));
+    QVERIFY(pool.waitForDone(5000));
+    QCOMPARE(count.load(), 1000);
+    QCOMPARE(pool.queued(), qsizetype(0));
+}
+
+void tst_QMcpWorkStealingPool::threads()
+{
+    QMcpWorkStealingPool pool(3);
+
+    // every task holds its worker until all three run
+    QSemaphore running;
+    QSemaphore release;
+    QMutex mutex;
+    QSet<QThread *> threads;
+    for (int i = 0; i < 3; i++) {
+        QVERIFY(pool.tryStart([&]() {
+            {
+                QMutexLocker locker(&mutex);
+                threads.insert(QThread::currentThread());
+            }
+            running.release();
+            release.acquire();
+        }));
+    }
+    QVERIFY(running.tryAcquire(3, 5000));
+    release.release(3);
+    QVERIFY(pool.waitForDone(5000));
+    QCOMPARE(threads.size(), 3);
+    QVERIFY(!threads.contains(QThread::currentThread()));
+}
+
+void tst_QMcpWorkStealingPool::nested()
+{
+    // a worker blocked in a task does not hold up the tasks it started
+    QMcpWorkStealingPool pool(2);
+    QSemaphore done;
+    std::atomic<int> started = 0;
+    std::atomic<bool> finished = false;
+    QVERIFY(pool.tryStart([&]() {
+        for (int i = 0; i < 10; i++)
+            started += pool.tryStart([&done]() { done.release(); });
+        finished = done.tryAcquire(10, 5000);
+    }));
+    QVERIFY(pool.waitForDone(5000));
+    QCOMPARE(started.load(), 10);
+    QVERIFY(finished);
+}
+
+void tst_QMcpWorkStealingPool::strand()
+{
+    QMcpWorkStealingPool pool(4);
+    auto strand = std::make_shared<QMcpWorkStealingPool::Strand>();
+
+    QList<int> order;
+    std::atomic<int> running = 0;
+    bool overlapped = false;
+    for (int i = 0; i < 100; i++) {
+        QVERIFY(pool.tryStart(strand, [&, i]() {
+            if (running++ > 0)
+                overlapped = true;
+            order.append(i);
+            running--;
+        }));
+    }
+    QVERIFY(pool.waitForDone(5000));
+    QVERIFY(!overlapped);
+    QCOMPARE(order.size(), 100);
+    for (int i = 0; i < order.size(); i++)
+        QCOMPARE(order.at(i), i);
+}
+
+void tst_QMcpWorkStealingPool::strandsInParallel()
+{
+    // a blocked strand does not hold up another one
+    QMcpWorkStealingPool pool(2);
+    auto blocked = std::make_shared<QMcpWorkStealingPool::Strand>();
+    auto other = std::make_shared<QMcpWorkStealingPool::Strand>();
+
+    QSemaphore release;
+    QSemaphore done;
+    QVERIFY(pool.tryStart(blocked, [&release]() { release.acquire(); }));
+    QVERIFY(pool.tryStart(blocked, [&done]() { done.release(); }));
+    QVERIFY(pool.tryStart(other, [&done]() { done.release(); }));
+
+    QVERIFY(done.tryAcquire(1, 5000));
+    QVERIFY(!done.tryAcquire(1, 100));
+    release.release();
+    QVERIFY(done.tryAcquire(1, 5000));
+    QVERIFY(pool.waitForDone(5000));
+}
+
+void tst_QMcpWorkStealingPool::maxQueued()
+{
+    QMcpWorkStealingPool pool(1, 2);
+    QCOMPARE(pool.maxQueued(), qsizetype(2));
+
+    QSemaphore running;
+    QSemaphore release;
+    QVERIFY(pool.tryStart([&]() {
+        running.release();
+        release.acquire();
+    }));
+    QVERIFY(running.tryAcquire(1, 5000));
+
+    // the running task no longer counts
+    std::atomic<int> count = 0;
+    QVERIFY(pool.tryStart([&count]() { count++; }));
+    QVERIFY(pool.tryStart([&count]() { count++; }));
+    QVERIFY(!pool.tryStart([&count]() { count++; }));
+    QCOMPARE(pool.queued(), qsizetype(2));
+
+    QVERIFY(!pool.waitForDone(50));
+    release.release();
+    QVERIFY(pool.waitForDone(5000));
+    QCOMPARE(count.load(), 2);
+    QVERIFY(pool.tryStart([&count]() { count++; }));
+    QVERIFY(pool.waitForDone(5000));
+    QCOMPARE(count.load(), 3);
+}
+
+void tst_QMcpWorkStealingPool::destructorDrains()
+{
+    std::atomic<int> count = 0;
+    {
+        QMcpWorkStealingPool pool(2);
+        auto strand = std::make_shared<QMcpWorkStealingPool::Strand>();
+        for (int i = 0; i < 50; i++) {
+            QVERIFY(pool.tryStart([&count]() { count++; }));
+            QVERIFY(pool.tryStart(strand, [&count]() { count++; }));
+        }
+    }
+    QCOMPARE(count.load(), 100);
+}
+
+QTEST_MAIN(tst_QMcpWorkStealingPool)
+#include "tst_qmcpworkstealingpool.moc"
@@ -0,0 +1,92 @@
+// Copyright (C) 2025 Signal Slot Inc.
+// SPDX-License-Identifier: LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QRandomGenerator>
+#include <QtMcpCommon/qmcpbase64.h>
+#include <QtTest/QTest>
+
+// Each row reports the time per call for its payload size; the QByteArray
+// functions are measured on the same rows for comparison.
+class tst_QMcpBase64 : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encode_data();
+    void encode();
+    void toBase64_data() { encode_data(); }
+    void toBase64();
+    void decode_data();
+    void decode();
+    void fromBase64_data() { decode_data(); }
+    void fromBase64();
+};
+
+static QByteArray randomData(qsizetype size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (auto &c : data)
+        c = char(QRandomGenerator::global()->bounded(256));
+    return data;
+}
+
+void tst_QMcpBase64::encode_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("1KiB") << randomData(1 << 10);
+    QTest::newRow("64KiB") << randomData(1 << 16);
+    QTest::newRow("4MiB") << randomData(1 << 22);
+}
+
+void tst_QMcpBase64::encode()
+{
+    QFETCH(QByteArray, data);
+
+    QBENCHMARK {
+        const auto encoded = QMcpBase64::encode(data);
+        Q_UNUSED(encoded);
+    }
+}
+
+void tst_QMcpBase64::toBase64()
+{
+    QFETCH(QByteArray, data);
+
+    QBENCHMARK {
+        const auto encoded = data.toBase64();
+        Q_UNUSED(encoded);
+    }
+}
+
+void tst_QMcpBase64::decode_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("1KiB") << randomData(1 << 10).toBase64();
+    QTest::newRow("64KiB") << randomData(1 << 16).toBase64();
+    QTest::newRow("4MiB") << randomData(1 << 22).toBase64();
+}
+
+void tst_QMcpBase64::decode()
+{
+    QFETCH(QByteArray, data);
+
+    QBENCHMARK {
+        const auto decoded = QMcpBase64::decode(data);
+        Q_UNUSED(decoded);
+    }
+}
+
+void tst_QMcpBase64::fromBase64()
+{
+    QFETCH(QByteArray, data);
+
+    QBENCHMARK {
+        const auto decoded = QByteArray::fromBase64(data);
+        Q_UNUSED(decoded);
+    }
+}
+
+QTEST_MAIN(tst_QMcpBase64)
+#include "tst_bench_qmcpbase64.moc"